@@ -0,0 +1,23 @@
+cmake_minimum_required (VERSION 3.16.2)
+
+project(argon_benchmarks)
+
+# Measurements are meaningless without optimizations, asserts stay enabled
+add_compile_options("$<$<COMPILE_LANGUAGE:CXX>:-O2>")
+
+# The math library picks its SIMD or scalar path at compile time (AR_SIMD follows __AVX__).
+# Rebuild with the option off to compare them, math_bench labels each run with the path.
+# The batch kernels dispatch at runtime in both builds.
+option(ARGON_MATH_SIMD "Build the math library with its SIMD path" ON)
+if (ARGON_MATH_SIMD)
+	add_compile_options("$<$<COMPILE_LANGUAGE:CXX>:-mavx>")
+else()
+	add_compile_options("$<$<COMPILE_LANGUAGE:CXX>:-mno-avx>")
+endif()
+
+add_subdirectory(fundamental)
+add_subdirectory(data_structures)
+add_subdirectory(math)
+add_subdirectory(benchmarks/benchmark)
+add_subdirectory(benchmarks/data_structures_bench)
+add_subdirectory(benchmarks/math_bench)
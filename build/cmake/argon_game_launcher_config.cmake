@@ -6,6 +6,7 @@ message(OPENGL FOUND VAL ${OPENGL_FOUND})
 
 add_subdirectory(fundamental)
 add_subdirectory(data_structures)
+add_subdirectory(memory)
 add_subdirectory(math)
 add_subdirectory(engine_core)
 add_subdirectory(third_party/gl)
@@ -2,12 +2,26 @@ cmake_minimum_required (VERSION 3.16.2)
 
 project (argon_unit_testing)
 
+# The math library picks its SIMD or scalar path at compile time (AR_SIMD follows __AVX__).
+# Rebuild with the option off to run the math tests on the scalar path.
+option(ARGON_MATH_SIMD "Build the math library with its SIMD path" ON)
+if (NOT ARGON_MATH_SIMD)
+	add_compile_options("$<$<COMPILE_LANGUAGE:CXX>:-mno-avx>")
+endif()
+
 add_subdirectory(fundamental)
 add_subdirectory(data_structures)
+add_subdirectory(memory)
 add_subdirectory(math)
+add_subdirectory(engine_core)
 add_subdirectory(third_party/gl)
 add_subdirectory(third_party/glfw)
 add_subdirectory(third_party/gtest)
+add_subdirectory(third_party/rttr)
 add_subdirectory(third_party/sole)
 add_subdirectory(unit_testing/data_structures_test)
+add_subdirectory(unit_testing/engine_core_test)
+add_subdirectory(unit_testing/fundamental_test)
+add_subdirectory(unit_testing/math_test)
+add_subdirectory(unit_testing/memory_test)
 add_subdirectory(unit_testing/test_launcher)
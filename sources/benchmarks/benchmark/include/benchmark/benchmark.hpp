@@ -0,0 +1,122 @@
+#pragma once
+
+#include <chrono>
+#include <ctime>
+#include <initializer_list>
+#include <string>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
+#include <fundamental/types.hpp>
+
+// Minimal harness modeled after Google Benchmark. Benchmarks are registered statically,
+// every argument set is run until the accumulated time reaches the minimal time.
+//
+// Command line:
+//  --benchmark_filter=<substring>  run only the benchmarks which names contain the substring
+//  --benchmark_min_time=<seconds>  minimal measured time of every run, 0.5 by default
+//  --benchmark_format=<console|json>
+//  --benchmark_out=<file>          additionally writes the json report into the file
+namespace argon::benchmark
+{
+class AR_SYM_EXPORT State final
+{
+public:
+	using ClockType = std::chrono::steady_clock;
+
+	State(sizet maxIterations, const vector<int64> &args);
+
+	// Starts the timer on the first call and stops it after the last iteration
+	bool keepRunning();
+
+	void pauseTiming();
+	void resumeTiming();
+
+	int64 range(sizet index = 0) const;
+
+	sizet getIterations() const { return m_maxIterations; }
+
+	void setItemsProcessed(int64 items) { m_itemsProcessed = items; }
+	int64 getItemsProcessed() const { return m_itemsProcessed; }
+
+	void setLabel(const std::string &label) { m_label = label; }
+	const std::string& getLabel() const { return m_label; }
+
+	// Accumulated while the timer was running
+	float64 getRealTime() const { return m_realTime; }
+	float64 getCpuTime() const { return m_cpuTime; }
+	// Timestamp counter ticks, which run at the nominal frequency of the processor
+	float64 getCycles() const { return m_cycles; }
+
+private:
+	void _startTimer();
+	void _stopTimer();
+
+	const vector<int64> &m_args;
+	std::string m_label;
+	ClockType::time_point m_realStart;
+	std::clock_t m_cpuStart;
+	uint64 m_cycleStart;
+	sizet m_maxIterations;
+	sizet m_iteration;
+	int64 m_itemsProcessed;
+	float64 m_realTime;
+	float64 m_cpuTime;
+	float64 m_cycles;
+	bool m_running;
+	bool m_started;
+	AR_ATTR_UNUSED byte _pad[6];
+};
+
+using BenchmarkFunction = void (*)(State &state);
+
+class AR_SYM_EXPORT Benchmark final
+{
+public:
+	Benchmark(const char *name, BenchmarkFunction function);
+
+	Benchmark* arg(int64 value);
+	Benchmark* args(std::initializer_list<int64> values);
+	// start, start * multiplier, ... and the limit itself
+	Benchmark* range(int64 start, int64 limit, int64 multiplier = 8);
+
+	const std::string& getName() const { return m_name; }
+	BenchmarkFunction getFunction() const { return m_function; }
+	const vector<vector<int64>>& getArgs() const { return m_args; }
+
+private:
+	std::string m_name;
+	BenchmarkFunction m_function;
+	vector<vector<int64>> m_args;
+};
+
+AR_SYM_EXPORT Benchmark* registerBenchmark(const char *name, BenchmarkFunction function);
+AR_SYM_EXPORT int32 runBenchmarks(int32 argc, char **argv);
+
+// Forces the value to be computed and kept
+template <typename T>
+inline void doNotOptimize(T &&value)
+{
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Forces all pending memory writes to be performed
+inline void clobberMemory()
+{
+	asm volatile("" : : : "memory");
+}
+} // namespace argon::benchmark
+
+#define AR_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define AR_BENCHMARK_CONCAT(a, b) AR_BENCHMARK_CONCAT_IMPL(a, b)
+
+#define AR_BENCHMARK(function) \
+	static ::argon::benchmark::Benchmark *AR_BENCHMARK_CONCAT(s_benchmark_, __LINE__) \
+		AR_ATTR_UNUSED = ::argon::benchmark::registerBenchmark(#function, function)
+
+#define AR_BENCHMARK_TEMPLATE(function, ...) \
+	static ::argon::benchmark::Benchmark *AR_BENCHMARK_CONCAT(s_benchmark_, __LINE__) \
+		AR_ATTR_UNUSED = ::argon::benchmark::registerBenchmark( \
+			#function "<" #__VA_ARGS__ ">", function<__VA_ARGS__>)
@@ -0,0 +1,394 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include <x86intrin.h>
+
+#include "benchmark.hpp"
+
+namespace argon::benchmark
+{
+namespace
+{
+struct Options
+{
+	std::string m_filter;
+	std::string m_format = "console";
+	std::string m_out;
+	float64 m_minTime = 0.5;
+};
+
+struct RunResult
+{
+	std::string m_name;
+	std::string m_label;
+	sizet m_iterations;
+	float64 m_realTime;
+	float64 m_cpuTime;
+	float64 m_cycles;
+	int64 m_itemsProcessed;
+};
+
+inline constexpr sizet MAX_ITERATIONS = 1000000000u;
+
+vector<std::unique_ptr<Benchmark>>& getRegistry()
+{
+	static vector<std::unique_ptr<Benchmark>> s_registry;
+	return s_registry;
+}
+
+bool parseFlag(const char *arg, const char *flag, std::string &value)
+{
+	const sizet length = std::strlen(flag);
+	if (std::strncmp(arg, flag, length) != 0 || arg[length] != '=')
+	{
+		return false;
+	}
+
+	value = arg + length + 1;
+	return true;
+}
+
+Options parseOptions(int32 argc, char **argv)
+{
+	Options options;
+	std::string minTime;
+
+	for (int32 i = 1; i < argc; ++i)
+	{
+		if (parseFlag(argv[i], "--benchmark_filter", options.m_filter)
+			|| parseFlag(argv[i], "--benchmark_format", options.m_format)
+			|| parseFlag(argv[i], "--benchmark_out", options.m_out))
+		{
+			continue;
+		}
+
+		if (parseFlag(argv[i], "--benchmark_min_time", minTime))
+		{
+			options.m_minTime = std::atof(minTime.c_str());
+			continue;
+		}
+
+		AR_LOG_ERROR("Unknown argument ", argv[i]);
+	}
+
+	return options;
+}
+
+std::string getRunName(const Benchmark &benchmark, const vector<int64> &args)
+{
+	std::string name = benchmark.getName();
+	for (const auto arg : args)
+	{
+		name += "/" + std::to_string(arg);
+	}
+
+	return name;
+}
+
+RunResult run(const Benchmark &benchmark, const vector<int64> &args, float64 minTime)
+{
+	sizet iterations = 1;
+
+	for (;;)
+	{
+		State state(iterations, args);
+		benchmark.getFunction()(state);
+
+		const float64 elapsed = state.getRealTime();
+		if (elapsed >= minTime || iterations >= MAX_ITERATIONS)
+		{
+			return {getRunName(benchmark, args), state.getLabel(), iterations,
+				elapsed * 1e9 / static_cast<float64>(iterations),
+				state.getCpuTime() * 1e9 / static_cast<float64>(iterations),
+				state.getCycles() / static_cast<float64>(iterations),
+				state.getItemsProcessed()};
+		}
+
+		// Aim slightly above the minimal time, but do not grow too fast on noisy short runs
+		const float64 multiplier = elapsed > 0.0 ? std::min(10.0, minTime * 1.4 / elapsed) : 10.0;
+		iterations = std::min(MAX_ITERATIONS, std::max(iterations + 1,
+			static_cast<sizet>(static_cast<float64>(iterations) * multiplier)));
+	}
+}
+
+float64 getItemsPerSecond(const RunResult &result)
+{
+	return result.m_realTime > 0.0 && result.m_itemsProcessed > 0
+		? static_cast<float64>(result.m_itemsProcessed) * 1e9
+			/ (result.m_realTime * static_cast<float64>(result.m_iterations))
+		: 0.0;
+}
+
+float64 getNsPerItem(const RunResult &result)
+{
+	return result.m_itemsProcessed > 0
+		? result.m_realTime * static_cast<float64>(result.m_iterations)
+			/ static_cast<float64>(result.m_itemsProcessed)
+		: 0.0;
+}
+
+// Cycles are TSC reference cycles, they don't follow the frequency scaling
+float64 getItemsPerCycle(const RunResult &result)
+{
+	return result.m_cycles > 0.0 && result.m_itemsProcessed > 0
+		? static_cast<float64>(result.m_itemsProcessed)
+			/ (result.m_cycles * static_cast<float64>(result.m_iterations))
+		: 0.0;
+}
+
+void printConsole(const RunResult &result)
+{
+	std::printf("%-60s %14.1f ns %14.1f ns %12zu", result.m_name.c_str(), result.m_realTime,
+		result.m_cpuTime, result.m_iterations);
+
+	if (const float64 itemsPerSecond = getItemsPerSecond(result); itemsPerSecond > 0.0)
+	{
+		std::printf(" %12.3fM items/s %10.3f ns/item %8.3f items/cycle", itemsPerSecond / 1e6,
+			getNsPerItem(result), getItemsPerCycle(result));
+	}
+
+	std::printf(" %s\n", result.m_label.c_str());
+	std::fflush(stdout);
+}
+
+std::string escapeJson(const std::string &value)
+{
+	std::string result;
+	for (const char c : value)
+	{
+		if (c == '"' || c == '\\')
+		{
+			result += '\\';
+		}
+
+		result += c;
+	}
+
+	return result;
+}
+
+// Same layout as the Google Benchmark reports, so the existing comparison tools can read it
+std::string toJson(const vector<RunResult> &results, const char *executable)
+{
+	std::ostringstream stream;
+	stream.precision(12);
+
+	const std::time_t now = std::time(nullptr);
+	char date[64];
+	std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+	stream << "{\n";
+	stream << "  \"context\": {\n";
+	stream << "    \"date\": \"" << date << "\",\n";
+	stream << "    \"executable\": \"" << escapeJson(executable) << "\",\n";
+	stream << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef NDEBUG
+	stream << "    \"library_build_type\": \"release\"\n";
+#else
+	stream << "    \"library_build_type\": \"debug\"\n";
+#endif // ifdef NDEBUG
+	stream << "  },\n";
+	stream << "  \"benchmarks\": [\n";
+
+	for (sizet i = 0; i < results.size(); ++i)
+	{
+		const RunResult &result = results[i];
+
+		stream << "    {\n";
+		stream << "      \"name\": \"" << escapeJson(result.m_name) << "\",\n";
+		stream << "      \"run_name\": \"" << escapeJson(result.m_name) << "\",\n";
+		stream << "      \"run_type\": \"iteration\",\n";
+		stream << "      \"iterations\": " << result.m_iterations << ",\n";
+		stream << "      \"real_time\": " << result.m_realTime << ",\n";
+		stream << "      \"cpu_time\": " << result.m_cpuTime << ",\n";
+		stream << "      \"time_unit\": \"ns\"";
+
+		if (const float64 itemsPerSecond = getItemsPerSecond(result); itemsPerSecond > 0.0)
+		{
+			stream << ",\n      \"items_per_second\": " << itemsPerSecond;
+			stream << ",\n      \"ns_per_item\": " << getNsPerItem(result);
+			stream << ",\n      \"items_per_cycle\": " << getItemsPerCycle(result);
+		}
+
+		if (!result.m_label.empty())
+		{
+			stream << ",\n      \"label\": \"" << escapeJson(result.m_label) << "\"";
+		}
+
+		stream << "\n    }" << (i + 1 < results.size() ? "," : "") << "\n";
+	}
+
+	stream << "  ]\n";
+	stream << "}\n";
+
+	return stream.str();
+}
+} // namespace
+
+State::State(sizet maxIterations, const vector<int64> &args)
+	: m_args(args)
+	, m_cpuStart(0)
+	, m_cycleStart(0)
+	, m_maxIterations(maxIterations)
+	, m_iteration(0)
+	, m_itemsProcessed(0)
+	, m_realTime(0.0)
+	, m_cpuTime(0.0)
+	, m_cycles(0.0)
+	, m_running(false)
+	, m_started(false)
+{
+}
+
+bool State::keepRunning()
+{
+	if (!m_started)
+	{
+		m_started = true;
+		_startTimer();
+	}
+
+	if (m_iteration < m_maxIterations)
+	{
+		++m_iteration;
+		return true;
+	}
+
+	_stopTimer();
+	return false;
+}
+
+void State::pauseTiming()
+{
+	_stopTimer();
+}
+
+void State::resumeTiming()
+{
+	_startTimer();
+}
+
+int64 State::range(sizet index) const
+{
+	AR_CRITICAL(index < m_args.size(), "Benchmark argument is out of range");
+	return m_args[index];
+}
+
+void State::_startTimer()
+{
+	AR_ASSERT(!m_running);
+
+	m_running = true;
+	m_realStart = ClockType::now();
+	m_cpuStart = std::clock();
+	m_cycleStart = __rdtsc();
+}
+
+void State::_stopTimer()
+{
+	if (!m_running)
+	{
+		return;
+	}
+
+	m_running = false;
+	m_realTime += std::chrono::duration<float64>(ClockType::now() - m_realStart).count();
+	m_cpuTime += static_cast<float64>(std::clock() - m_cpuStart) / CLOCKS_PER_SEC;
+	m_cycles += static_cast<float64>(__rdtsc() - m_cycleStart);
+}
+
+Benchmark::Benchmark(const char *name, BenchmarkFunction function)
+	: m_name(name)
+	, m_function(function)
+{
+}
+
+Benchmark* Benchmark::arg(int64 value)
+{
+	m_args.push_back({value});
+	return this;
+}
+
+Benchmark* Benchmark::args(std::initializer_list<int64> values)
+{
+	m_args.emplace_back(values);
+	return this;
+}
+
+Benchmark* Benchmark::range(int64 start, int64 limit, int64 multiplier)
+{
+	AR_CRITICAL(start > 0 && start <= limit && multiplier > 1, "Benchmark range is not valid");
+
+	for (int64 value = start; value < limit; value *= multiplier)
+	{
+		arg(value);
+	}
+
+	return arg(limit);
+}
+
+Benchmark* registerBenchmark(const char *name, BenchmarkFunction function)
+{
+	auto &registry = getRegistry();
+	registry.push_back(std::make_unique<Benchmark>(name, function));
+
+	return registry.back().get();
+}
+
+int32 runBenchmarks(int32 argc, char **argv)
+{
+	const Options options = parseOptions(argc, argv);
+	const bool console = options.m_format != "json";
+	vector<RunResult> results;
+
+	if (console)
+	{
+		std::printf("%-60s %17s %17s %12s\n", "Benchmark", "Time", "CPU", "Iterations");
+	}
+
+	const vector<vector<int64>> noArgs(1);
+
+	for (const auto &benchmark : getRegistry())
+	{
+		for (const auto &args : benchmark->getArgs().empty() ? noArgs : benchmark->getArgs())
+		{
+			if (getRunName(*benchmark, args).find(options.m_filter) == std::string::npos)
+			{
+				continue;
+			}
+
+			results.push_back(run(*benchmark, args, options.m_minTime));
+			if (console)
+			{
+				printConsole(results.back());
+			}
+		}
+	}
+
+	const std::string json = toJson(results, argc > 0 ? argv[0] : "");
+	if (!console)
+	{
+		std::printf("%s", json.c_str());
+	}
+
+	if (!options.m_out.empty())
+	{
+		std::ofstream file(options.m_out);
+		if (!file)
+		{
+			AR_LOG_ERROR("Cannot open ", options.m_out);
+			return 1;
+		}
+
+		file << json;
+	}
+
+	return 0;
+}
+} // namespace argon::benchmark
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <algorithm>
+#include <random>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/types.hpp>
+
+namespace argon::bench
+{
+inline constexpr int64 MIN_SIZE = 1 << 10;
+inline constexpr int64 MAX_SIZE = 10000000;
+
+// Size of a small component, e.g. a position with padding
+struct Payload
+{
+	float32 m_data[4];
+};
+
+// Fixed seed, so the access pattern is the same between the runs
+template <typename T>
+void shuffle(vector<T> &values)
+{
+	std::mt19937 generator(42u);
+	std::shuffle(values.begin(), values.end(), generator);
+}
+} // namespace argon::bench
@@ -0,0 +1,162 @@
+#include <memory>
+#include <random>
+
+#include <benchmark/benchmark.hpp>
+
+#include <data_structures/flat_hash_map.hpp>
+#include <data_structures/standard_containers.hpp>
+
+#include "bench_utils.hpp"
+
+namespace
+{
+using namespace argon;
+
+using FlatMap = flat_hash_map<uint64, bench::Payload>;
+using StdMap = unordered_map<uint64, bench::Payload>;
+
+// Random keys, the sequential ones favor the identity std::hash
+vector<uint64> makeKeys(sizet count, uint64 seed)
+{
+	std::mt19937_64 generator(seed);
+	vector<uint64> keys(count);
+
+	for (uint64 &key : keys)
+	{
+		key = generator();
+	}
+
+	return keys;
+}
+
+template <typename TMap>
+std::unique_ptr<TMap> fill(const vector<uint64> &keys)
+{
+	auto map = std::make_unique<TMap>();
+	for (const uint64 key : keys)
+	{
+		(*map)[key] = bench::Payload{{1.f, 2.f, 3.f, 4.f}};
+	}
+
+	return map;
+}
+
+template <typename TMap>
+void hashMapInsert(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	const vector<uint64> keys = makeKeys(count, 42u);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto map = std::make_unique<TMap>();
+		state.resumeTiming();
+
+		for (const uint64 key : keys)
+		{
+			benchmark::doNotOptimize(map->emplace(key, bench::Payload{}));
+		}
+
+		state.pauseTiming();
+		map.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+template <typename TMap>
+void hashMapFind(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	vector<uint64> keys = makeKeys(count, 42u);
+	const auto map = fill<TMap>(keys);
+	bench::shuffle(keys);
+
+	while (state.keepRunning())
+	{
+		for (const uint64 key : keys)
+		{
+			benchmark::doNotOptimize(map->find(key));
+		}
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+template <typename TMap>
+void hashMapFindMissing(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	const auto map = fill<TMap>(makeKeys(count, 42u));
+	const vector<uint64> missing = makeKeys(count, 7u);
+
+	while (state.keepRunning())
+	{
+		for (const uint64 key : missing)
+		{
+			benchmark::doNotOptimize(map->find(key));
+		}
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+template <typename TMap>
+void hashMapErase(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	vector<uint64> keys = makeKeys(count, 42u);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto map = fill<TMap>(keys);
+		bench::shuffle(keys);
+		state.resumeTiming();
+
+		for (const uint64 key : keys)
+		{
+			benchmark::doNotOptimize(map->erase(key));
+		}
+
+		state.pauseTiming();
+		map.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+template <typename TMap>
+void hashMapIterate(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	const auto map = fill<TMap>(makeKeys(count, 42u));
+
+	while (state.keepRunning())
+	{
+		float32 sum = 0.f;
+		for (const auto &[key, value] : *map)
+		{
+			sum += value.m_data[0];
+		}
+
+		benchmark::doNotOptimize(sum);
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+} // namespace
+
+AR_BENCHMARK_TEMPLATE(hashMapInsert, FlatMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(hashMapInsert, StdMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(hashMapFind, FlatMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(hashMapFind, StdMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(hashMapFindMissing, FlatMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(hashMapFindMissing, StdMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(hashMapErase, FlatMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(hashMapErase, StdMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(hashMapIterate, FlatMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(hashMapIterate, StdMap)->range(bench::MIN_SIZE, bench::MAX_SIZE);
@@ -0,0 +1,6 @@
+#include <benchmark/benchmark.hpp>
+
+int main(int argc, char **argv)
+{
+	return argon::benchmark::runBenchmarks(argc, argv);
+}
@@ -0,0 +1,114 @@
+#include <memory>
+
+#include <benchmark/benchmark.hpp>
+
+#include <data_structures/sparse_storage.hpp>
+
+#include "bench_utils.hpp"
+
+namespace
+{
+using namespace argon;
+
+void slotGeneratorAcquire(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto generator = std::make_unique<SlotGenerator>();
+		state.resumeTiming();
+
+		for (sizet i = 0; i < count; ++i)
+		{
+			benchmark::doNotOptimize(generator->acquire());
+		}
+
+		state.pauseTiming();
+		generator.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+void slotGeneratorRelease(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	vector<SlotGenerator::Slot> slots(count);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto generator = std::make_unique<SlotGenerator>();
+		for (auto &slot : slots)
+		{
+			slot = generator->acquire();
+		}
+		bench::shuffle(slots);
+		state.resumeTiming();
+
+		for (const auto &slot : slots)
+		{
+			generator->release(slot);
+		}
+
+		state.pauseTiming();
+		generator.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+void slotGeneratorAcquireN(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	vector<SlotGenerator::Slot> slots(count);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto generator = std::make_unique<SlotGenerator>();
+		state.resumeTiming();
+
+		generator->acquireN(count, slots.data());
+		benchmark::clobberMemory();
+
+		state.pauseTiming();
+		generator.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+void slotGeneratorReleaseN(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	vector<SlotGenerator::Slot> slots(count);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto generator = std::make_unique<SlotGenerator>();
+		generator->acquireN(count, slots.data());
+		bench::shuffle(slots);
+		state.resumeTiming();
+
+		generator->releaseN(slots.data(), count);
+
+		state.pauseTiming();
+		generator.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+} // namespace
+
+AR_BENCHMARK(slotGeneratorAcquire)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(slotGeneratorRelease)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(slotGeneratorAcquireN)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(slotGeneratorReleaseN)->range(bench::MIN_SIZE, bench::MAX_SIZE);
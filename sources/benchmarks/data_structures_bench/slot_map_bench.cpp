@@ -0,0 +1,232 @@
+#include <memory>
+
+#include <benchmark/benchmark.hpp>
+
+#include <data_structures/slot_map.hpp>
+
+#include "bench_utils.hpp"
+
+namespace
+{
+using namespace argon;
+
+template <uint32 OBJECTS_PER_PAGE, typename StoragePolicy>
+using Map = SlotMap<bench::Payload, OBJECTS_PER_PAGE, StoragePolicy>;
+
+template <typename TMap>
+vector<typename TMap::Slot> fill(TMap &map, sizet count)
+{
+	vector<typename TMap::Slot> slots;
+	slots.reserve(count);
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		slots.push_back(map.allocate());
+	}
+
+	return slots;
+}
+
+template <uint32 OBJECTS_PER_PAGE, typename StoragePolicy = PagedSlotMapStorage>
+void slotMapAllocate(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto map = std::make_unique<Map<OBJECTS_PER_PAGE, StoragePolicy>>();
+		state.resumeTiming();
+
+		for (sizet i = 0; i < count; ++i)
+		{
+			benchmark::doNotOptimize(map->allocate());
+		}
+
+		state.pauseTiming();
+		map.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+template <uint32 OBJECTS_PER_PAGE, typename StoragePolicy = PagedSlotMapStorage>
+void slotMapErase(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto map = std::make_unique<Map<OBJECTS_PER_PAGE, StoragePolicy>>();
+		auto slots = fill(*map, count);
+		bench::shuffle(slots);
+		state.resumeTiming();
+
+		for (const auto &slot : slots)
+		{
+			map->erase(slot);
+		}
+
+		state.pauseTiming();
+		map.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+template <uint32 OBJECTS_PER_PAGE, typename StoragePolicy = PagedSlotMapStorage>
+void slotMapAllocateN(benchmark::State &state)
+{
+	using TMap = Map<OBJECTS_PER_PAGE, StoragePolicy>;
+
+	const sizet count = static_cast<sizet>(state.range(0));
+	vector<typename TMap::Slot> slots(count);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto map = std::make_unique<TMap>();
+		state.resumeTiming();
+
+		map->allocateN(count, slots.data());
+		benchmark::clobberMemory();
+
+		state.pauseTiming();
+		map.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+template <uint32 OBJECTS_PER_PAGE, typename StoragePolicy = PagedSlotMapStorage>
+void slotMapEraseN(benchmark::State &state)
+{
+	using TMap = Map<OBJECTS_PER_PAGE, StoragePolicy>;
+
+	const sizet count = static_cast<sizet>(state.range(0));
+	vector<typename TMap::Slot> slots(count);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto map = std::make_unique<TMap>();
+		map->allocateN(count, slots.data());
+		bench::shuffle(slots);
+		state.resumeTiming();
+
+		// Half of the objects, so the survivors have to be moved into the holes
+		map->eraseN(slots.data(), count / 2);
+
+		state.pauseTiming();
+		map.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * (count / 2)));
+}
+
+template <uint32 OBJECTS_PER_PAGE, typename StoragePolicy = PagedSlotMapStorage>
+void slotMapAt(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	auto map = std::make_unique<Map<OBJECTS_PER_PAGE, StoragePolicy>>();
+	auto slots = fill(*map, count);
+	bench::shuffle(slots);
+
+	while (state.keepRunning())
+	{
+		float32 sum = 0.f;
+		for (const auto &slot : slots)
+		{
+			sum += map->at(slot).m_data[0];
+		}
+
+		benchmark::doNotOptimize(sum);
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+template <uint32 OBJECTS_PER_PAGE, typename StoragePolicy = PagedSlotMapStorage>
+void slotMapIterate(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	auto map = std::make_unique<Map<OBJECTS_PER_PAGE, StoragePolicy>>();
+	fill(*map, count);
+
+	while (state.keepRunning())
+	{
+		float32 sum = 0.f;
+		for (const auto &object : *map)
+		{
+			sum += object.m_data[0];
+		}
+
+		benchmark::doNotOptimize(sum);
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+template <uint32 OBJECTS_PER_PAGE, typename StoragePolicy = PagedSlotMapStorage>
+void slotMapIterateBlocks(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	auto map = std::make_unique<Map<OBJECTS_PER_PAGE, StoragePolicy>>();
+	fill(*map, count);
+
+	while (state.keepRunning())
+	{
+		float32 sum = 0.f;
+		map->forEachBlock([&sum](const bench::Payload *begin, const bench::Payload *end)
+		{
+			for (; begin != end; ++begin)
+			{
+				sum += begin->m_data[0];
+			}
+		});
+
+		benchmark::doNotOptimize(sum);
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+} // namespace
+
+AR_BENCHMARK_TEMPLATE(slotMapAllocate, 16)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapAllocate, 64)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapAllocate, 256)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapAllocate, 1024)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapAllocate, 64, ContiguousSlotMapStorage)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK_TEMPLATE(slotMapErase, 16)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapErase, 64)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapErase, 256)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapErase, 1024)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapErase, 64, ContiguousSlotMapStorage)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK_TEMPLATE(slotMapAllocateN, 64)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapAllocateN, 64, ContiguousSlotMapStorage)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK_TEMPLATE(slotMapEraseN, 64)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapEraseN, 64, ContiguousSlotMapStorage)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK_TEMPLATE(slotMapAt, 16)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapAt, 64)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapAt, 256)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapAt, 1024)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapAt, 64, ContiguousSlotMapStorage)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK_TEMPLATE(slotMapIterate, 16)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapIterate, 64)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapIterate, 256)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapIterate, 1024)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapIterate, 64, ContiguousSlotMapStorage)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK_TEMPLATE(slotMapIterateBlocks, 16)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapIterateBlocks, 1024)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK_TEMPLATE(slotMapIterateBlocks, 64, ContiguousSlotMapStorage)->range(bench::MIN_SIZE, bench::MAX_SIZE);
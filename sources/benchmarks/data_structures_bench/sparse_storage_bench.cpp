@@ -0,0 +1,220 @@
+#include <memory>
+
+#include <benchmark/benchmark.hpp>
+
+#include <data_structures/sparse_storage.hpp>
+
+#include "bench_utils.hpp"
+
+namespace
+{
+using namespace argon;
+
+using Storage = SparseStorage<bench::Payload>;
+
+vector<SlotGenerator::Slot> acquireSlots(SlotGenerator &generator, sizet count)
+{
+	vector<SlotGenerator::Slot> slots(count);
+	for (auto &slot : slots)
+	{
+		slot = generator.acquire();
+	}
+
+	return slots;
+}
+
+void sparseStorageAssign(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	SlotGenerator generator;
+	const auto slots = acquireSlots(generator, count);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto storage = std::make_unique<Storage>();
+		state.resumeTiming();
+
+		for (const auto &slot : slots)
+		{
+			benchmark::doNotOptimize(storage->assign(slot));
+		}
+
+		state.pauseTiming();
+		storage.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+void sparseStorageErase(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	SlotGenerator generator;
+	auto slots = acquireSlots(generator, count);
+	bench::shuffle(slots);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto storage = std::make_unique<Storage>();
+		for (const auto &slot : slots)
+		{
+			storage->assign(slot);
+		}
+		state.resumeTiming();
+
+		for (const auto &slot : slots)
+		{
+			storage->erase(slot);
+		}
+
+		state.pauseTiming();
+		storage.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+void sparseStorageHas(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	SlotGenerator generator;
+	auto slots = acquireSlots(generator, count);
+	Storage storage;
+
+	// Every second slot has data, so both outcomes are measured
+	for (sizet i = 0; i < count; i += 2)
+	{
+		storage.assign(slots[i]);
+	}
+
+	bench::shuffle(slots);
+
+	while (state.keepRunning())
+	{
+		sizet found = 0;
+		for (const auto &slot : slots)
+		{
+			found += storage.has(slot) ? 1u : 0u;
+		}
+
+		benchmark::doNotOptimize(found);
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+void sparseStorageIterate(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	SlotGenerator generator;
+	const auto slots = acquireSlots(generator, count);
+	Storage storage;
+
+	for (const auto &slot : slots)
+	{
+		storage.assign(slot);
+	}
+
+	while (state.keepRunning())
+	{
+		float32 sum = 0.f;
+		for (const auto &object : storage)
+		{
+			sum += object.m_data[0];
+		}
+
+		benchmark::doNotOptimize(sum);
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+void sparseStorageCompact(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	SlotGenerator generator;
+	auto slots = acquireSlots(generator, count);
+	bench::shuffle(slots);
+
+	while (state.keepRunning())
+	{
+		state.pauseTiming();
+		auto storage = std::make_unique<Storage>();
+		for (const auto &slot : slots)
+		{
+			storage->assign(slot);
+		}
+		state.resumeTiming();
+
+		while (!storage->compact(count))
+		{
+		}
+
+		state.pauseTiming();
+		storage.reset();
+		state.resumeTiming();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+
+// Second argument: 0 - the storages are filled in different orders, 1 - both are compacted
+void sparseStorageJoin(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	SlotGenerator generator;
+	auto slots = acquireSlots(generator, count);
+	Storage lhs;
+	Storage rhs;
+
+	bench::shuffle(slots);
+	for (const auto &slot : slots)
+	{
+		lhs.assign(slot);
+	}
+
+	bench::shuffle(slots);
+	for (const auto &slot : slots)
+	{
+		rhs.assign(slot);
+	}
+
+	if (state.range(1))
+	{
+		while (!lhs.compact(count) || !rhs.compact(count))
+		{
+		}
+	}
+
+	while (state.keepRunning())
+	{
+		const bool aligned = rhs.sharesOrdering(lhs);
+		const SlotGenerator::Slot *lhsSlots = lhs.getSlots();
+		const bench::Payload *lhsData = lhs.getData();
+		const bench::Payload *rhsData = rhs.getData();
+
+		float32 sum = 0.f;
+		for (sizet i = 0, size = lhs.size(); i < size; ++i)
+		{
+			const bench::Payload &other = aligned ? rhsData[i] : *rhs.find(lhsSlots[i]);
+			sum += lhsData[i].m_data[0] * other.m_data[0];
+		}
+
+		benchmark::doNotOptimize(sum);
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+}
+} // namespace
+
+AR_BENCHMARK(sparseStorageAssign)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(sparseStorageErase)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(sparseStorageHas)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(sparseStorageIterate)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(sparseStorageCompact)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(sparseStorageJoin)->args({bench::MIN_SIZE, 0})->args({bench::MIN_SIZE, 1})
+	->args({1 << 20, 0})->args({1 << 20, 1});
@@ -0,0 +1,308 @@
+#include <benchmark/benchmark.hpp>
+
+#include <math/batch.hpp>
+#include <math/bounds.hpp>
+#include <math/bounds_x8.hpp>
+#include <math/quaternion_x8.hpp>
+#include <math/vector3x8.hpp>
+
+#include "bench_utils.hpp"
+
+namespace
+{
+using namespace argon;
+
+// A camera in the middle of the generated bounds, a part of them is visible
+math::Frustum makeFrustum()
+{
+	math::Matrix4 view;
+	math::Matrix4 projection;
+	view.setLookAtLH(math::Vector3(0.f, 0.f, -10.f), math::Vector3(0.f, 0.f, 0.f),
+		math::Vector3(0.f, 1.f, 0.f));
+	projection.setPerspectiveFovLH(16.f, 9.f, 1.f, 0.5f, 50.f);
+
+	return math::Frustum(projection * view);
+}
+
+math::Sphere makeSphere(bench::Random &random)
+{
+	return math::Sphere(random.getVector3() * 4.f, random.getFloat(0.f, 2.f));
+}
+
+math::Aabb makeAabb(bench::Random &random)
+{
+	const math::Vector3 center = random.getVector3() * 4.f;
+	const math::Vector3 extents(random.getFloat(0.f, 2.f), random.getFloat(0.f, 2.f),
+		random.getFloat(0.f, 2.f));
+
+	return math::Aabb(center - extents, center + extents);
+}
+
+// Per-object loops, the same work as the batch kernels, over arrays that outgrow the caches
+
+template <typename TResult, typename TFunc>
+void runLoop(benchmark::State &state, sizet count, TFunc &&op)
+{
+	vector<TResult> results(count);
+
+	while (state.keepRunning())
+	{
+		for (sizet i = 0; i < count; ++i)
+		{
+			results[i] = op(i);
+		}
+
+		benchmark::clobberMemory();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+	state.setLabel(bench::getPathLabel());
+}
+
+void matrix4MultiplyLoop(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const auto lhs = bench::generate<math::Matrix4>(count, [&]() { return random.getMatrix4(); });
+	const auto rhs = bench::generate<math::Matrix4>(count, [&]() { return random.getMatrix4(); });
+
+	runLoop<math::Matrix4>(state, count, [&](sizet i) { return lhs[i] * rhs[i]; });
+}
+
+void matrix4InvertLoop(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const auto m = bench::generate<math::Matrix4>(count, [&]() { return random.getMatrix4(); });
+
+	runLoop<math::Matrix4>(state, count, [&](sizet i) { return m[i].getInverted(); });
+}
+
+void matrix4InvertAffineLoop(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const auto m = bench::generate<math::Matrix4>(count, [&]() { return random.getMatrix4(); });
+
+	runLoop<math::Matrix4>(state, count, [&](sizet i) { return m[i].getInvertedAffine(); });
+}
+
+void matrix4InvertOrthonormalLoop(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const auto m = bench::generate<math::Matrix4>(count,
+		[&]() { return random.getRigidMatrix4(); });
+
+	runLoop<math::Matrix4>(state, count, [&](sizet i) { return m[i].getInvertedOrthonormal(); });
+}
+
+void transformPointsLoop(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const math::Matrix4 m = random.getMatrix4();
+	const auto points = bench::generate<math::Vector3>(count, [&]() { return random.getVector3(); });
+
+	runLoop<math::Vector3>(state, count, [&](sizet i) { return m * points[i]; });
+}
+
+void quaternionSlerpLoop(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const auto from = bench::generate<math::Quaternion>(count,
+		[&]() { return random.getQuaternion(); });
+	const auto to = bench::generate<math::Quaternion>(count,
+		[&]() { return random.getQuaternion(); });
+
+	runLoop<math::Quaternion>(state, count, [&](sizet i) { return from[i].slerp(to[i], 0.3f); });
+}
+
+template <typename TBounds, typename TGenerator>
+void cullLoop(benchmark::State &state, TGenerator &&generator)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const math::Frustum frustum = makeFrustum();
+	const auto bounds = bench::generate<TBounds>(count, [&]() { return generator(random); });
+	vector<uint32> visible(count);
+
+	while (state.keepRunning())
+	{
+		sizet numVisible = 0;
+		for (sizet i = 0; i < count; ++i)
+		{
+			if (frustum.isVisible(bounds[i]))
+			{
+				visible[numVisible++] = static_cast<uint32>(i);
+			}
+		}
+
+		benchmark::doNotOptimize(numVisible);
+		benchmark::clobberMemory();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+	state.setLabel(bench::getPathLabel());
+}
+
+void cullSpheresLoop(benchmark::State &state)
+{
+	cullLoop<math::Sphere>(state, &makeSphere);
+}
+
+void cullAabbsLoop(benchmark::State &state)
+{
+	cullLoop<math::Aabb>(state, &makeAabb);
+}
+
+// Batch kernels from math/batch.hpp, the ISA is selected at runtime
+
+void matrix4MultiplyBatch(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const auto lhs = bench::generate<math::Matrix4>(count, [&]() { return random.getMatrix4(); });
+	const auto rhs = bench::generate<math::Matrix4>(count, [&]() { return random.getMatrix4(); });
+	vector<math::Matrix4> results(count);
+
+	while (state.keepRunning())
+	{
+		math::multiplyBatch(lhs.data(), rhs.data(), results.data(), count);
+		benchmark::clobberMemory();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+	state.setLabel(bench::getPathLabel());
+}
+
+void transformPointsBatch(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const math::Matrix4 m = random.getMatrix4();
+	const auto points = bench::generate<math::Vector3>(count, [&]() { return random.getVector3(); });
+	vector<math::Vector3> results(count);
+
+	while (state.keepRunning())
+	{
+		math::transformPoints(m, points.data(), results.data(), count);
+		benchmark::clobberMemory();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+	state.setLabel(bench::getPathLabel());
+}
+
+void transformPointsX8Batch(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0)) / math::Vector3x8::LANES;
+	bench::Random random;
+	const math::Matrix4 m = random.getMatrix4();
+	const auto points = bench::generate<math::Vector3x8>(count, [&]()
+	{
+		math::Vector3x8 v;
+		for (int32 lane = 0; lane < math::Vector3x8::LANES; ++lane)
+		{
+			v.setLane(lane, random.getVector3());
+		}
+		return v;
+	});
+	vector<math::Vector3x8> results(count);
+
+	while (state.keepRunning())
+	{
+		math::transformPoints(m, points.data(), results.data(), count);
+		benchmark::clobberMemory();
+	}
+
+	state.setItemsProcessed(
+		static_cast<int64>(state.getIterations() * count * math::Vector3x8::LANES));
+	state.setLabel(bench::getPathLabel());
+}
+
+void quaternionSlerpBatch(benchmark::State &state)
+{
+	const sizet count = static_cast<sizet>(state.range(0)) / math::QuaternionX8::LANES;
+	bench::Random random;
+	const auto generator = [&]()
+	{
+		math::QuaternionX8 q;
+		for (int32 lane = 0; lane < math::QuaternionX8::LANES; ++lane)
+		{
+			q.setLane(lane, random.getQuaternion());
+		}
+		return q;
+	};
+	const auto from = bench::generate<math::QuaternionX8>(count, generator);
+	const auto to = bench::generate<math::QuaternionX8>(count, generator);
+	vector<math::QuaternionX8> results(count);
+
+	while (state.keepRunning())
+	{
+		math::slerpBatch(from.data(), to.data(), 0.3f, results.data(), count);
+		benchmark::clobberMemory();
+	}
+
+	state.setItemsProcessed(
+		static_cast<int64>(state.getIterations() * count * math::QuaternionX8::LANES));
+	state.setLabel(bench::getPathLabel());
+}
+template <typename TBoundsX8, typename TGenerator, typename TCull>
+void cullBatch(benchmark::State &state, TGenerator &&generator, TCull &&cull)
+{
+	const sizet count = static_cast<sizet>(state.range(0));
+	bench::Random random;
+	const math::Frustum frustum = makeFrustum();
+	const auto bounds = bench::generate<TBoundsX8>(count / TBoundsX8::LANES, [&]()
+	{
+		TBoundsX8 block;
+		for (int32 lane = 0; lane < TBoundsX8::LANES; ++lane)
+		{
+			block.setLane(lane, generator(random));
+		}
+		return block;
+	});
+	vector<uint32> visible(count);
+
+	while (state.keepRunning())
+	{
+		benchmark::doNotOptimize(cull(frustum, bounds.data(), count, visible.data()));
+		benchmark::clobberMemory();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * count));
+	state.setLabel(bench::getPathLabel());
+}
+
+void cullSpheresBatch(benchmark::State &state)
+{
+	cullBatch<math::SphereX8>(state, &makeSphere, &math::cullSpheres);
+}
+
+void cullAabbsBatch(benchmark::State &state)
+{
+	cullBatch<math::AabbX8>(state, &makeAabb, &math::cullAabbs);
+}
+} // namespace
+
+AR_BENCHMARK(matrix4MultiplyLoop)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(matrix4MultiplyBatch)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK(matrix4InvertLoop)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(matrix4InvertAffineLoop)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(matrix4InvertOrthonormalLoop)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK(transformPointsLoop)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(transformPointsBatch)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(transformPointsX8Batch)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK(quaternionSlerpLoop)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(quaternionSlerpBatch)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK(cullSpheresLoop)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(cullSpheresBatch)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+
+AR_BENCHMARK(cullAabbsLoop)->range(bench::MIN_SIZE, bench::MAX_SIZE);
+AR_BENCHMARK(cullAabbsBatch)->range(bench::MIN_SIZE, bench::MAX_SIZE);
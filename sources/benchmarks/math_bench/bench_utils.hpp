@@ -0,0 +1,115 @@
+#pragma once
+
+#include <random>
+
+#include <benchmark/benchmark.hpp>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/types.hpp>
+
+#include <math/matrix3.hpp>
+#include <math/matrix4.hpp>
+#include <math/quaternion.hpp>
+#include <math/vector2.hpp>
+#include <math/vector3.hpp>
+#include <math/vector4.hpp>
+
+namespace argon::bench
+{
+// Inputs and results of the per-operation benchmarks stay in L1, so the arithmetic is measured
+inline constexpr sizet NUM_VALUES = 512;
+
+inline constexpr int64 MIN_SIZE = 1 << 10;
+inline constexpr int64 MAX_SIZE = 1 << 20;
+
+// The SIMD and scalar paths are selected at compile time, see ARGON_MATH_SIMD
+inline const char* getPathLabel()
+{
+#ifdef AR_SIMD
+	return "simd";
+#else
+	return "scalar";
+#endif // ifdef AR_SIMD
+}
+
+// Fixed seed, so the inputs are the same between the runs and the builds
+class Random final
+{
+public:
+	Random() : m_generator(42u) {}
+
+	float32 getFloat(float32 min = -10.f, float32 max = 10.f)
+	{
+		return std::uniform_real_distribution<float32>(min, max)(m_generator);
+	}
+
+	math::Vector2 getVector2() { return math::Vector2(getFloat(), getFloat()); }
+	math::Vector3 getVector3() { return math::Vector3(getFloat(), getFloat(), getFloat()); }
+	math::Vector4 getVector4()
+	{
+		return math::Vector4(getFloat(), getFloat(), getFloat(), getFloat());
+	}
+
+	math::Quaternion getQuaternion()
+	{
+		return math::Quaternion(getVector3().getNormalized(), getFloat(-3.f, 3.f));
+	}
+
+	math::Matrix3 getMatrix3() { return math::Matrix3(getQuaternion()); }
+
+	math::Matrix4 getMatrix4()
+	{
+		math::Matrix4 m;
+		m.setTransformation(getQuaternion(),
+			math::Vector3(getFloat(0.5f, 2.f), getFloat(0.5f, 2.f), getFloat(0.5f, 2.f)),
+			getVector3());
+		return m;
+	}
+
+	// Rotation and translation only
+	math::Matrix4 getRigidMatrix4()
+	{
+		math::Matrix4 m;
+		m.setTransformation(getQuaternion(), math::Vector3(1.f, 1.f, 1.f), getVector3());
+		return m;
+	}
+
+private:
+	std::mt19937 m_generator;
+};
+
+template <typename T, typename TFunc>
+vector<T> generate(sizet count, TFunc &&generator)
+{
+	vector<T> values;
+	values.reserve(count);
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		values.push_back(generator());
+	}
+
+	return values;
+}
+
+// Applies op to every input index in each iteration, one item is one operation
+template <typename TResult, typename TFunc>
+void runOperation(benchmark::State &state, TFunc &&op)
+{
+	vector<TResult> results(NUM_VALUES);
+
+	while (state.keepRunning())
+	{
+		for (sizet i = 0; i < NUM_VALUES; ++i)
+		{
+			results[i] = op(i);
+		}
+
+		benchmark::clobberMemory();
+	}
+
+	state.setItemsProcessed(static_cast<int64>(state.getIterations() * NUM_VALUES));
+	state.setLabel(getPathLabel());
+}
+} // namespace argon::bench
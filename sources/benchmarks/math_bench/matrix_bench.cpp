@@ -0,0 +1,192 @@
+#include <benchmark/benchmark.hpp>
+
+#include "bench_utils.hpp"
+
+namespace
+{
+using namespace argon;
+
+vector<math::Matrix3> makeMatrices3(bench::Random &random)
+{
+	return bench::generate<math::Matrix3>(bench::NUM_VALUES, [&]() { return random.getMatrix3(); });
+}
+
+vector<math::Matrix4> makeMatrices4(bench::Random &random)
+{
+	return bench::generate<math::Matrix4>(bench::NUM_VALUES, [&]() { return random.getMatrix4(); });
+}
+
+vector<math::Vector3> makeVectors3(bench::Random &random)
+{
+	return bench::generate<math::Vector3>(bench::NUM_VALUES, [&]() { return random.getVector3(); });
+}
+
+void matrix3Multiply(benchmark::State &state)
+{
+	bench::Random random;
+	const auto lhs = makeMatrices3(random);
+	const auto rhs = makeMatrices3(random);
+	bench::runOperation<math::Matrix3>(state, [&](sizet i) { return lhs[i] * rhs[i]; });
+}
+
+void matrix3MultiplyVector(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices3(random);
+	const auto v = makeVectors3(random);
+	bench::runOperation<math::Vector3>(state, [&](sizet i) { return m[i] * v[i]; });
+}
+
+void matrix3Transpose(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices3(random);
+	bench::runOperation<math::Matrix3>(state, [&](sizet i) { return m[i].getTransposed(); });
+}
+
+void matrix3Determinant(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices3(random);
+	bench::runOperation<float32>(state, [&](sizet i) { return m[i].getDeterminant(); });
+}
+
+void matrix3Invert(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices3(random);
+	bench::runOperation<math::Matrix3>(state, [&](sizet i) { return m[i].getInverted(); });
+}
+
+void matrix4Multiply(benchmark::State &state)
+{
+	bench::Random random;
+	const auto lhs = makeMatrices4(random);
+	const auto rhs = makeMatrices4(random);
+	bench::runOperation<math::Matrix4>(state, [&](sizet i) { return lhs[i] * rhs[i]; });
+}
+
+void matrix4MultiplyVector3(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices4(random);
+	const auto v = makeVectors3(random);
+	bench::runOperation<math::Vector3>(state, [&](sizet i) { return m[i] * v[i]; });
+}
+
+void matrix4MultiplyVector4(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices4(random);
+	const auto v = bench::generate<math::Vector4>(bench::NUM_VALUES,
+		[&]() { return random.getVector4(); });
+	bench::runOperation<math::Vector4>(state, [&](sizet i) { return m[i] * v[i]; });
+}
+
+void matrix4TransformNormal(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices4(random);
+	const auto v = makeVectors3(random);
+	bench::runOperation<math::Vector3>(state, [&](sizet i) { return m[i].transformNormal(v[i]); });
+}
+
+void matrix4Transpose(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices4(random);
+	bench::runOperation<math::Matrix4>(state, [&](sizet i) { return m[i].getTransposed(); });
+}
+
+void matrix4DeterminantFull(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices4(random);
+	bench::runOperation<float32>(state, [&](sizet i) { return m[i].getDeterminantFull(); });
+}
+
+void matrix4DeterminantFast(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices4(random);
+	bench::runOperation<float32>(state, [&](sizet i) { return m[i].getDeterminantFast(); });
+}
+
+void matrix4Invert(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices4(random);
+	bench::runOperation<math::Matrix4>(state, [&](sizet i) { return m[i].getInverted(); });
+}
+
+void matrix4InvertAffine(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices4(random);
+	bench::runOperation<math::Matrix4>(state, [&](sizet i) { return m[i].getInvertedAffine(); });
+}
+
+void matrix4InvertOrthonormal(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = bench::generate<math::Matrix4>(bench::NUM_VALUES,
+		[&]() { return random.getRigidMatrix4(); });
+	bench::runOperation<math::Matrix4>(state,
+		[&](sizet i) { return m[i].getInvertedOrthonormal(); });
+}
+
+void matrix4MultiplyAffine(benchmark::State &state)
+{
+	bench::Random random;
+	const auto lhs = makeMatrices4(random);
+	const auto rhs = makeMatrices4(random);
+	bench::runOperation<math::Matrix4>(state, [&](sizet i) { return lhs[i].multiplyAffine(rhs[i]); });
+}
+
+void matrix4SetTransformation(benchmark::State &state)
+{
+	bench::Random random;
+	const auto q = bench::generate<math::Quaternion>(bench::NUM_VALUES,
+		[&]() { return random.getQuaternion(); });
+	const auto scaling = makeVectors3(random);
+	const auto trans = makeVectors3(random);
+	bench::runOperation<math::Matrix4>(state, [&](sizet i)
+	{
+		math::Matrix4 m;
+		m.setTransformation(q[i], scaling[i], trans[i]);
+		return m;
+	});
+}
+
+void matrix4ToQuaternion(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = makeMatrices4(random);
+	bench::runOperation<math::Quaternion>(state, [&](sizet i)
+	{
+		math::Quaternion q;
+		m[i].getQuaternion(q);
+		return q;
+	});
+}
+} // namespace
+
+AR_BENCHMARK(matrix3Multiply);
+AR_BENCHMARK(matrix3MultiplyVector);
+AR_BENCHMARK(matrix3Transpose);
+AR_BENCHMARK(matrix3Determinant);
+AR_BENCHMARK(matrix3Invert);
+
+AR_BENCHMARK(matrix4Multiply);
+AR_BENCHMARK(matrix4MultiplyVector3);
+AR_BENCHMARK(matrix4MultiplyVector4);
+AR_BENCHMARK(matrix4TransformNormal);
+AR_BENCHMARK(matrix4Transpose);
+AR_BENCHMARK(matrix4DeterminantFull);
+AR_BENCHMARK(matrix4DeterminantFast);
+AR_BENCHMARK(matrix4Invert);
+AR_BENCHMARK(matrix4InvertAffine);
+AR_BENCHMARK(matrix4InvertOrthonormal);
+AR_BENCHMARK(matrix4MultiplyAffine);
+AR_BENCHMARK(matrix4SetTransformation);
+AR_BENCHMARK(matrix4ToQuaternion);
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.hpp>
+
+#include "bench_utils.hpp"
+
+namespace
+{
+using namespace argon;
+
+vector<math::Quaternion> makeQuaternions(bench::Random &random)
+{
+	return bench::generate<math::Quaternion>(bench::NUM_VALUES,
+		[&]() { return random.getQuaternion(); });
+}
+
+void quaternionMultiply(benchmark::State &state)
+{
+	bench::Random random;
+	const auto lhs = makeQuaternions(random);
+	const auto rhs = makeQuaternions(random);
+	bench::runOperation<math::Quaternion>(state, [&](sizet i) { return lhs[i] * rhs[i]; });
+}
+
+void quaternionDot(benchmark::State &state)
+{
+	bench::Random random;
+	const auto lhs = makeQuaternions(random);
+	const auto rhs = makeQuaternions(random);
+	bench::runOperation<float32>(state, [&](sizet i) { return lhs[i].dot(rhs[i]); });
+}
+
+void quaternionNormalize(benchmark::State &state)
+{
+	bench::Random random;
+	const auto q = makeQuaternions(random);
+	bench::runOperation<math::Quaternion>(state, [&](sizet i) { return (q[i] * 2.f).getNormalized(); });
+}
+
+void quaternionInvert(benchmark::State &state)
+{
+	bench::Random random;
+	const auto q = makeQuaternions(random);
+	bench::runOperation<math::Quaternion>(state, [&](sizet i) { return q[i].getInverted(); });
+}
+
+void quaternionSlerp(benchmark::State &state)
+{
+	bench::Random random;
+	const auto from = makeQuaternions(random);
+	const auto to = makeQuaternions(random);
+	bench::runOperation<math::Quaternion>(state, [&](sizet i) { return from[i].slerp(to[i], 0.3f); });
+}
+
+void quaternionRotateVector(benchmark::State &state)
+{
+	bench::Random random;
+	const auto q = makeQuaternions(random);
+	const auto v = bench::generate<math::Vector3>(bench::NUM_VALUES,
+		[&]() { return random.getVector3(); });
+	bench::runOperation<math::Vector3>(state, [&](sizet i) { return q[i].getRotated(v[i]); });
+}
+
+void quaternionToMatrix3(benchmark::State &state)
+{
+	bench::Random random;
+	const auto q = makeQuaternions(random);
+	bench::runOperation<math::Matrix3>(state, [&](sizet i) { return q[i].getMatrix3(); });
+}
+
+void quaternionToMatrix4(benchmark::State &state)
+{
+	bench::Random random;
+	const auto q = makeQuaternions(random);
+	bench::runOperation<math::Matrix4>(state, [&](sizet i) { return q[i].getMatrix4(); });
+}
+
+void quaternionFromMatrix3(benchmark::State &state)
+{
+	bench::Random random;
+	const auto m = bench::generate<math::Matrix3>(bench::NUM_VALUES,
+		[&]() { return random.getMatrix3(); });
+	bench::runOperation<math::Quaternion>(state, [&](sizet i) { return math::Quaternion(m[i]); });
+}
+} // namespace
+
+AR_BENCHMARK(quaternionMultiply);
+AR_BENCHMARK(quaternionDot);
+AR_BENCHMARK(quaternionNormalize);
+AR_BENCHMARK(quaternionInvert);
+AR_BENCHMARK(quaternionSlerp);
+AR_BENCHMARK(quaternionRotateVector);
+AR_BENCHMARK(quaternionToMatrix3);
+AR_BENCHMARK(quaternionToMatrix4);
+AR_BENCHMARK(quaternionFromMatrix3);
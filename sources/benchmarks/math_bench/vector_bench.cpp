@@ -0,0 +1,186 @@
+#include <benchmark/benchmark.hpp>
+
+#include "bench_utils.hpp"
+
+namespace
+{
+using namespace argon;
+
+template <typename TVector>
+struct VectorInputs
+{
+	vector<TVector> m_lhs;
+	vector<TVector> m_rhs;
+};
+
+template <typename TVector, typename TGenerator>
+VectorInputs<TVector> makeInputs(TGenerator &&generator)
+{
+	bench::Random random;
+	auto lhs = bench::generate<TVector>(bench::NUM_VALUES, [&]() { return generator(random); });
+	auto rhs = bench::generate<TVector>(bench::NUM_VALUES, [&]() { return generator(random); });
+	return {std::move(lhs), std::move(rhs)};
+}
+
+VectorInputs<math::Vector2> makeVector2Inputs()
+{
+	return makeInputs<math::Vector2>([](bench::Random &random) { return random.getVector2(); });
+}
+
+VectorInputs<math::Vector3> makeVector3Inputs()
+{
+	return makeInputs<math::Vector3>([](bench::Random &random) { return random.getVector3(); });
+}
+
+VectorInputs<math::Vector4> makeVector4Inputs()
+{
+	return makeInputs<math::Vector4>([](bench::Random &random) { return random.getVector4(); });
+}
+
+void vector2Add(benchmark::State &state)
+{
+	const auto in = makeVector2Inputs();
+	bench::runOperation<math::Vector2>(state, [&](sizet i) { return in.m_lhs[i] + in.m_rhs[i]; });
+}
+
+void vector2Scale(benchmark::State &state)
+{
+	const auto in = makeVector2Inputs();
+	bench::runOperation<math::Vector2>(state, [&](sizet i) { return in.m_lhs[i] * 1.5f; });
+}
+
+void vector2Dot(benchmark::State &state)
+{
+	const auto in = makeVector2Inputs();
+	bench::runOperation<float32>(state, [&](sizet i) { return in.m_lhs[i].dot(in.m_rhs[i]); });
+}
+
+void vector2Length(benchmark::State &state)
+{
+	const auto in = makeVector2Inputs();
+	bench::runOperation<float32>(state, [&](sizet i) { return in.m_lhs[i].getLength(); });
+}
+
+void vector2Normalize(benchmark::State &state)
+{
+	const auto in = makeVector2Inputs();
+	bench::runOperation<math::Vector2>(state, [&](sizet i) { return in.m_lhs[i].getNormalized(); });
+}
+
+void vector2Lerp(benchmark::State &state)
+{
+	const auto in = makeVector2Inputs();
+	bench::runOperation<math::Vector2>(state,
+		[&](sizet i) { return in.m_lhs[i].lerp(in.m_rhs[i], 0.3f); });
+}
+
+void vector3Add(benchmark::State &state)
+{
+	const auto in = makeVector3Inputs();
+	bench::runOperation<math::Vector3>(state, [&](sizet i) { return in.m_lhs[i] + in.m_rhs[i]; });
+}
+
+void vector3Scale(benchmark::State &state)
+{
+	const auto in = makeVector3Inputs();
+	bench::runOperation<math::Vector3>(state, [&](sizet i) { return in.m_lhs[i] * 1.5f; });
+}
+
+void vector3Multiply(benchmark::State &state)
+{
+	const auto in = makeVector3Inputs();
+	bench::runOperation<math::Vector3>(state, [&](sizet i) { return in.m_lhs[i] * in.m_rhs[i]; });
+}
+
+void vector3Dot(benchmark::State &state)
+{
+	const auto in = makeVector3Inputs();
+	bench::runOperation<float32>(state, [&](sizet i) { return in.m_lhs[i].dot(in.m_rhs[i]); });
+}
+
+void vector3Cross(benchmark::State &state)
+{
+	const auto in = makeVector3Inputs();
+	bench::runOperation<math::Vector3>(state,
+		[&](sizet i) { return in.m_lhs[i].cross(in.m_rhs[i]); });
+}
+
+void vector3Length(benchmark::State &state)
+{
+	const auto in = makeVector3Inputs();
+	bench::runOperation<float32>(state, [&](sizet i) { return in.m_lhs[i].getLength(); });
+}
+
+void vector3Normalize(benchmark::State &state)
+{
+	const auto in = makeVector3Inputs();
+	bench::runOperation<math::Vector3>(state, [&](sizet i) { return in.m_lhs[i].getNormalized(); });
+}
+
+void vector3Lerp(benchmark::State &state)
+{
+	const auto in = makeVector3Inputs();
+	bench::runOperation<math::Vector3>(state,
+		[&](sizet i) { return in.m_lhs[i].lerp(in.m_rhs[i], 0.3f); });
+}
+
+void vector3Distance(benchmark::State &state)
+{
+	const auto in = makeVector3Inputs();
+	bench::runOperation<float32>(state,
+		[&](sizet i) { return in.m_lhs[i].getDistance(in.m_rhs[i]); });
+}
+
+void vector4Add(benchmark::State &state)
+{
+	const auto in = makeVector4Inputs();
+	bench::runOperation<math::Vector4>(state, [&](sizet i) { return in.m_lhs[i] + in.m_rhs[i]; });
+}
+
+void vector4Scale(benchmark::State &state)
+{
+	const auto in = makeVector4Inputs();
+	bench::runOperation<math::Vector4>(state, [&](sizet i) { return in.m_lhs[i] * 1.5f; });
+}
+
+void vector4Dot(benchmark::State &state)
+{
+	const auto in = makeVector4Inputs();
+	bench::runOperation<float32>(state, [&](sizet i) { return in.m_lhs[i].dot(in.m_rhs[i]); });
+}
+
+void vector4Length(benchmark::State &state)
+{
+	const auto in = makeVector4Inputs();
+	bench::runOperation<float32>(state, [&](sizet i) { return in.m_lhs[i].getLength(); });
+}
+
+void vector4Normalize(benchmark::State &state)
+{
+	const auto in = makeVector4Inputs();
+	bench::runOperation<math::Vector4>(state, [&](sizet i) { return in.m_lhs[i].getNormalized(); });
+}
+} // namespace
+
+AR_BENCHMARK(vector2Add);
+AR_BENCHMARK(vector2Scale);
+AR_BENCHMARK(vector2Dot);
+AR_BENCHMARK(vector2Length);
+AR_BENCHMARK(vector2Normalize);
+AR_BENCHMARK(vector2Lerp);
+
+AR_BENCHMARK(vector3Add);
+AR_BENCHMARK(vector3Scale);
+AR_BENCHMARK(vector3Multiply);
+AR_BENCHMARK(vector3Dot);
+AR_BENCHMARK(vector3Cross);
+AR_BENCHMARK(vector3Length);
+AR_BENCHMARK(vector3Normalize);
+AR_BENCHMARK(vector3Lerp);
+AR_BENCHMARK(vector3Distance);
+
+AR_BENCHMARK(vector4Add);
+AR_BENCHMARK(vector4Scale);
+AR_BENCHMARK(vector4Dot);
+AR_BENCHMARK(vector4Length);
+AR_BENCHMARK(vector4Normalize);
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
+#include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
+
+#include "flat_hash_map.hpp"
+#include "sparse_storage.hpp"
+#include "standard_containers.hpp"
+
+namespace argon
+{
+// Stores entities with identical sets of components together. Every archetype keeps its rows in
+// fixed size chunks, each component type occupies its own contiguous array inside of a chunk.
+// Adding or removing a component moves the whole row into another archetype.
+// Every column of a chunk keeps the version of its last write, see observe.
+class AR_SYM_EXPORT ArchetypeStorage final
+	: NonCopyable
+{
+public:
+	using TypeId = uint64;
+
+	inline static constexpr sizet CHUNK_SIZE = 16u * 1024u;
+	inline static constexpr sizet CHUNK_ALIGNMENT = 64u;
+	inline static constexpr sizet INVALID_COLUMN = std::numeric_limits<sizet>::max();
+
+	struct ColumnInfo
+	{
+		template <typename T>
+		static ColumnInfo create(TypeId id);
+
+		TypeId m_id;
+		sizet m_size;
+		sizet m_alignment;
+		void (*m_moveConstruct)(void *dst, void *src);
+		void (*m_destroy)(void *object);
+	};
+
+	class AR_SYM_EXPORT Archetype final
+		: NonCopyable
+	{
+	public:
+		Archetype(vector<ColumnInfo> &&columns, const std::atomic<uint64> &version);
+		~Archetype();
+
+		// Columns are sorted by the type id
+		const vector<ColumnInfo>& getColumns() const { return m_columns; }
+		sizet getColumnIndex(TypeId id) const;
+
+		sizet size() const { return m_size; }
+		sizet getChunkCount() const { return m_chunks.size(); }
+		sizet getChunkCapacity() const { return m_chunkCapacity; }
+		sizet getChunkSize(sizet chunk) const;
+
+		// Start of the column array inside of the chunk
+		void* getColumn(sizet chunk, sizet column) const;
+		const SlotGenerator::Slot* getSlots(sizet chunk) const;
+
+		// Version of the last write into the column array of the chunk
+		uint64 getColumnVersion(sizet chunk, sizet column) const;
+		// Writes through getColumn have to be marked by the caller
+		void markChanged(sizet chunk, sizet column);
+		// Marks the write with an older version, a newer version of the column is kept
+		void markChanged(sizet chunk, sizet column, uint64 version);
+
+	private:
+		friend class ArchetypeStorage;
+
+		struct alignas(CHUNK_ALIGNMENT) Chunk
+		{
+			byte m_memory[CHUNK_SIZE];
+		};
+
+		void* _getElement(sizet row, sizet column) const;
+		SlotGenerator::Slot& _getSlot(sizet row) const;
+		// All columns of the chunk holding the row
+		void _markRowChanged(sizet row);
+
+		sizet _pushRow(SlotGenerator::Slot slot);
+		// Elements of the row must be already destroyed or moved out,
+		// the last row is moved into the hole
+		void _removeRow(sizet row);
+
+		vector<ColumnInfo> m_columns;
+		vector<sizet> m_columnOffsets;
+		vector<std::unique_ptr<Chunk>> m_chunks;
+		flat_hash_map<TypeId, uint32> m_addEdges;
+		flat_hash_map<TypeId, uint32> m_removeEdges;
+		// chunk * number of columns + column -> version
+		vector<uint64> m_versions;
+		const std::atomic<uint64> &m_version;
+		sizet m_chunkCapacity;
+		sizet m_size;
+	};
+
+	using Archetypes = vector<std::unique_ptr<Archetype>>;
+
+	ArchetypeStorage();
+	~ArchetypeStorage();
+
+	template <typename T, typename ...Args>
+	T& assign(SlotGenerator::Slot slot, TypeId id, Args &&...args);
+	void erase(SlotGenerator::Slot slot, TypeId id);
+	// Destroys all components of the slot
+	void remove(SlotGenerator::Slot slot);
+
+	bool has(SlotGenerator::Slot slot, TypeId id) const;
+	// The mutable lookups mark the column of the chunk as changed
+	void* find(SlotGenerator::Slot slot, TypeId id);
+	const void* find(SlotGenerator::Slot slot, TypeId id) const;
+
+	template <typename T>
+	T* find(SlotGenerator::Slot slot, TypeId id);
+	template <typename T>
+	const T* find(SlotGenerator::Slot slot, TypeId id) const;
+
+	// Starts a new write version and returns the previous one, so the columns written afterwards
+	// have greater versions than the result. Several readers may observe at once.
+	uint64 observe() { return m_version.fetch_add(1u, std::memory_order_relaxed); }
+
+	const Archetypes& getArchetypes() const { return m_archetypes; }
+
+private:
+	struct Location
+	{
+		inline static constexpr uint32 INVALID_ARCHETYPE = std::numeric_limits<uint32>::max();
+
+		uint32 m_archetype = INVALID_ARCHETYPE;
+		uint32 m_row = 0;
+		uint64 m_generation = 0;
+	};
+
+	void* _assign(SlotGenerator::Slot slot, const ColumnInfo &info);
+
+	const Location* _findLocation(SlotGenerator::Slot slot) const;
+	uint32 _getArchetype(vector<ColumnInfo> &&columns);
+	uint32 _getAddEdge(uint32 archetype, const ColumnInfo &info);
+	uint32 _getRemoveEdge(uint32 archetype, TypeId id);
+	void _move(SlotGenerator::Slot slot, uint32 archetype);
+	void _removeRow(uint32 archetype, sizet row);
+
+	Archetypes m_archetypes;
+	map<vector<TypeId>, uint32> m_archetypeLookup;
+	// Every entity owns a location, so the mapping is kept dense
+	vector<Location> m_locations;
+	std::atomic<uint64> m_version;
+};
+
+template <typename T>
+ArchetypeStorage::ColumnInfo ArchetypeStorage::ColumnInfo::create(TypeId id)
+{
+	static_assert(alignof(T) <= CHUNK_ALIGNMENT, "Component alignment is bigger than chunk alignment");
+	static_assert(sizeof(T) <= CHUNK_SIZE, "Component does not fit into a chunk");
+
+	return ColumnInfo{
+		id,
+		sizeof(T),
+		alignof(T),
+		[](void *dst, void *src) { new (dst) T(std::move(*static_cast<T*>(src))); },
+		[](void *object) { static_cast<T*>(object)->~T(); }
+	};
+}
+
+template <typename T, typename ...Args>
+T& ArchetypeStorage::assign(SlotGenerator::Slot slot, TypeId id, Args &&...args)
+{
+	void *memory = _assign(slot, ColumnInfo::create<T>(id));
+	return *new (memory) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+T* ArchetypeStorage::find(SlotGenerator::Slot slot, TypeId id)
+{
+	return static_cast<T*>(find(slot, id));
+}
+
+template <typename T>
+const T* ArchetypeStorage::find(SlotGenerator::Slot slot, TypeId id) const
+{
+	return static_cast<const T*>(find(slot, id));
+}
+} // namespace argon
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/helper_macros.hpp>
+#include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
+
+#include "sparse_storage.hpp"
+
+namespace argon
+{
+// SlotGenerator which may be used from several threads at once without locks.
+// Released slots go to a shared stack tagged with a modification counter against ABA,
+// never used slots are handed out by bumping a counter. Pages of the slots are never
+// moved or freed, so concurrent lookups stay valid while the generator grows.
+class AR_SYM_EXPORT ConcurrentSlotGenerator final
+	: NonCopyable
+{
+public:
+	using Slot = SlotGenerator::Slot;
+
+	inline static constexpr uint32 SLOTS_PER_PAGE = 1024u;
+	// The last index is reserved for the invalid slots
+	inline static constexpr uint32 MAX_SLOTS = 0xFFFFFFu;
+
+	// Slots cached by a single thread, it refills from and spills to the shared stack
+	// in batches. Must not outlive the generator, the cached slots are returned on destruction.
+	class AR_SYM_EXPORT LocalCache final
+		: NonCopyable
+	{
+	public:
+		inline static constexpr uint32 CAPACITY = 64u;
+
+		LocalCache(ConcurrentSlotGenerator &generator);
+		~LocalCache();
+
+	private:
+		friend class ConcurrentSlotGenerator;
+
+		ConcurrentSlotGenerator &m_generator;
+		uint32 m_indices[CAPACITY];
+		uint32 m_size;
+		AR_PAD(4);
+	};
+
+	ConcurrentSlotGenerator();
+	~ConcurrentSlotGenerator();
+
+	// Thread safe
+	Slot acquire();
+	void release(Slot slot);
+	bool isValid(Slot slot) const;
+
+	// Thread safe as long as every thread uses its own cache
+	Slot acquire(LocalCache &cache);
+	void release(LocalCache &cache, Slot slot);
+
+private:
+	using Entry = std::atomic<Slot>;
+
+	Entry& _getEntry(uint32 index) const;
+	const Entry* _findEntry(uint32 index) const;
+
+	// Bumps the generation of the released slot
+	void _invalidate(uint32 index);
+	// Hands out never used indices, allocates the pages for them if needed
+	uint32 _acquireFresh(uint32 count);
+	// Pops up to count indices from the shared stack
+	uint32 _pop(uint32 *indices, uint32 count);
+	// Pushes the indices as a single chain
+	void _push(const uint32 *indices, uint32 count);
+	void _flush(LocalCache &cache, uint32 count);
+	Slot _makeSlot(uint32 index) const;
+
+	std::unique_ptr<std::atomic<Entry*>[]> m_pages;
+	// Index of the top slot of the free stack, the generation counts modifications
+	std::atomic<Slot> m_head;
+	std::atomic<uint32> m_fresh;
+	AR_PAD(4);
+};
+} // namespace argon
@@ -0,0 +1,895 @@
+#pragma once
+
+#include <emmintrin.h>
+
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
+#include <fundamental/types.hpp>
+
+namespace argon
+{
+namespace detail
+{
+// Control bytes of the slots, a full slot keeps the low 7 bits of its hash
+inline constexpr int8 FLAT_HASH_EMPTY = -128;
+inline constexpr int8 FLAT_HASH_DELETED = -2;
+inline constexpr int8 FLAT_HASH_SENTINEL = -1;
+
+inline constexpr sizet FLAT_HASH_GROUP_WIDTH = 16u;
+
+// Control bytes of the tables without slots, a lookup stops at the first group
+alignas(16) inline constexpr int8 FLAT_HASH_EMPTY_GROUP[FLAT_HASH_GROUP_WIDTH] = {
+	FLAT_HASH_SENTINEL, FLAT_HASH_EMPTY, FLAT_HASH_EMPTY, FLAT_HASH_EMPTY,
+	FLAT_HASH_EMPTY, FLAT_HASH_EMPTY, FLAT_HASH_EMPTY, FLAT_HASH_EMPTY,
+	FLAT_HASH_EMPTY, FLAT_HASH_EMPTY, FLAT_HASH_EMPTY, FLAT_HASH_EMPTY,
+	FLAT_HASH_EMPTY, FLAT_HASH_EMPTY, FLAT_HASH_EMPTY, FLAT_HASH_EMPTY};
+
+// Control bytes of 16 consecutive slots, every match is a bit mask with a bit per slot
+class FlatHashGroup final
+{
+public:
+	explicit FlatHashGroup(const int8 *ctrl)
+		: m_ctrl(_mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(ctrl))))
+	{
+	}
+
+	uint32 match(int8 h2) const
+	{
+		return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+	}
+
+	uint32 matchEmpty() const
+	{
+		return match(FLAT_HASH_EMPTY);
+	}
+
+	uint32 matchEmptyOrDeleted() const
+	{
+		return static_cast<uint32>(_mm_movemask_epi8(
+			_mm_cmpgt_epi8(_mm_set1_epi8(FLAT_HASH_SENTINEL), m_ctrl)));
+	}
+
+	uint32 countLeadingEmptyOrDeleted() const
+	{
+		return static_cast<uint32>(__builtin_ctz(matchEmptyOrDeleted() + 1u));
+	}
+
+private:
+	__m128i m_ctrl;
+};
+
+// std::hash of the integers and the pointers is the identity, the groups need all bits mixed
+inline uint64 mixFlatHash(sizet hash)
+{
+	uint64 mixed = hash;
+	mixed ^= mixed >> 33;
+	mixed *= 0xFF51AFD7ED558CCDull;
+	mixed ^= mixed >> 33;
+
+	return mixed;
+}
+
+template <bool IS_TRANSPARENT>
+struct FlatHashKeyArg
+{
+	template <typename K, typename Key>
+	using Type = K;
+};
+
+template <>
+struct FlatHashKeyArg<false>
+{
+	template <typename K, typename Key>
+	using Type = Key;
+};
+
+template <typename T, typename = void>
+struct IsTransparent : std::false_type {};
+
+template <typename T>
+struct IsTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type {};
+
+template <typename Key, typename T>
+struct FlatHashMapPolicy
+{
+	using key_type = Key;
+	using value_type = std::pair<const Key, T>;
+
+	inline static constexpr bool IS_CONST_ITERATION = false;
+
+	static const Key& getKey(const value_type &value) { return value.first; }
+
+	// The source is destroyed right after, so its key may be moved out
+	static void transfer(value_type *to, value_type *from)
+	{
+		new (to) value_type(std::move(const_cast<Key&>(from->first)), std::move(from->second));
+		from->~value_type();
+	}
+};
+
+template <typename Key>
+struct FlatHashSetPolicy
+{
+	using key_type = Key;
+	using value_type = Key;
+
+	inline static constexpr bool IS_CONST_ITERATION = true;
+
+	static const Key& getKey(const value_type &value) { return value; }
+
+	static void transfer(value_type *to, value_type *from)
+	{
+		new (to) value_type(std::move(*from));
+		from->~value_type();
+	}
+};
+
+// Open addressing table with the values in a single array. The probing compares the control
+// bytes of a whole group at once, so a lookup touches the values of the likely matches only.
+// Insertions may move the values, erasing never does. Hash and KeyEqual must be stateless.
+template <typename Policy, typename Hash, typename KeyEqual>
+class FlatHashTable
+{
+	inline static constexpr bool IS_TRANSPARENT = IsTransparent<Hash>::value
+		&& IsTransparent<KeyEqual>::value;
+
+public:
+	using key_type = typename Policy::key_type;
+	using value_type = typename Policy::value_type;
+	using size_type = sizet;
+	using difference_type = ptrdiff;
+	using hasher = Hash;
+	using key_equal = KeyEqual;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+
+	template <typename TValue>
+	class Iterator final
+	{
+	public:
+		using value_type = std::remove_const_t<TValue>;
+		using pointer = TValue*;
+		using reference = TValue&;
+		using difference_type = ptrdiff;
+		using iterator_category = std::forward_iterator_tag;
+
+		Iterator() : m_ctrl(nullptr), m_slot(nullptr) {}
+
+		template <typename U, typename = std::enable_if_t<std::is_same_v<const U, TValue>>>
+		Iterator(const Iterator<U> &other) : m_ctrl(other.m_ctrl), m_slot(other.m_slot) {}
+
+		reference operator*() const { return *m_slot; }
+		pointer operator->() const { return m_slot; }
+
+		Iterator& operator++();
+		Iterator operator++(int);
+
+		friend bool operator==(const Iterator &lhs, const Iterator &rhs) { return lhs.m_ctrl == rhs.m_ctrl; }
+		friend bool operator!=(const Iterator &lhs, const Iterator &rhs) { return lhs.m_ctrl != rhs.m_ctrl; }
+
+	private:
+		friend class FlatHashTable;
+		template <typename> friend class Iterator;
+
+		Iterator(const int8 *ctrl, TValue *slot) : m_ctrl(ctrl), m_slot(slot) {}
+
+		void _skipEmpty();
+
+		const int8 *m_ctrl;
+		TValue *m_slot;
+	};
+
+	using iterator = Iterator<std::conditional_t<Policy::IS_CONST_ITERATION, const value_type, value_type>>;
+	using const_iterator = Iterator<const value_type>;
+
+private:
+	struct NotIterator {};
+
+public:
+
+	FlatHashTable();
+	explicit FlatHashTable(sizet capacity);
+	FlatHashTable(std::initializer_list<value_type> values);
+	FlatHashTable(const FlatHashTable &other);
+	FlatHashTable(FlatHashTable &&other);
+	~FlatHashTable();
+
+	FlatHashTable& operator=(const FlatHashTable &other);
+	FlatHashTable& operator=(FlatHashTable &&other);
+
+	iterator begin() { return _makeIterator(0u); }
+	const_iterator begin() const { return _makeIterator(0u); }
+	const_iterator cbegin() const { return _makeIterator(0u); }
+
+	iterator end() { return iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+	const_iterator end() const { return const_iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+	const_iterator cend() const { return end(); }
+
+	bool empty() const { return m_size == 0; }
+	sizet size() const { return m_size; }
+	// Number of the slots, the table grows when 7/8 of them are used
+	sizet capacity() const { return m_capacity; }
+
+	void clear();
+	// Grows the table for at least count values, so insertions below it never rehash
+	void reserve(sizet count);
+
+	std::pair<iterator, bool> insert(const value_type &value);
+	std::pair<iterator, bool> insert(value_type &&value);
+	void insert(std::initializer_list<value_type> values);
+	template <typename TInputIt>
+	void insert(TInputIt first, TInputIt last);
+
+	// The value is constructed before the lookup, try_emplace of the map does not
+	template <typename ...Args>
+	std::pair<iterator, bool> emplace(Args &&...args);
+
+	iterator erase(const_iterator it);
+	// Not a key for the transparent lookup, the sets iterate with const_iterator only
+	iterator erase(std::conditional_t<std::is_same_v<iterator, const_iterator>, NotIterator, iterator> it)
+	{
+		return erase(const_iterator(it));
+	}
+	template <typename K = key_type>
+	sizet erase(const typename FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, key_type> &key);
+
+	template <typename K = key_type>
+	iterator find(const typename FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, key_type> &key);
+	template <typename K = key_type>
+	const_iterator find(const typename FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, key_type> &key) const;
+
+	template <typename K = key_type>
+	bool contains(const typename FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, key_type> &key) const
+	{
+		return find<K>(key) != end();
+	}
+
+	template <typename K = key_type>
+	sizet count(const typename FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, key_type> &key) const
+	{
+		return contains<K>(key) ? 1u : 0u;
+	}
+
+	void swap(FlatHashTable &other);
+
+	hasher hash_function() const { return hasher(); }
+	key_equal key_eq() const { return key_equal(); }
+
+protected:
+	// Looks up the key, constructs the value with construct(value_type *slot) when it is missing
+	template <typename K, typename TConstruct>
+	std::pair<iterator, bool> _emplaceKey(const K &key, TConstruct &&construct);
+
+private:
+	static_assert(std::is_empty_v<Hash> && std::is_empty_v<KeyEqual>,
+		"Hash and KeyEqual must be stateless");
+
+	static bool _isFull(int8 ctrl) { return ctrl >= 0; }
+	static sizet _getGrowth(sizet capacity) { return capacity - capacity / 8; }
+
+	template <typename K>
+	static uint64 _hash(const K &key) { return mixFlatHash(Hash()(key)); }
+	static int8 _getH2(uint64 hash) { return static_cast<int8>(hash & 0x7F); }
+
+	iterator _makeIterator(sizet index);
+	const_iterator _makeIterator(sizet index) const;
+
+	// Index of the value or the capacity when the key is missing
+	template <typename K>
+	sizet _findIndex(const K &key, uint64 hash) const;
+	sizet _findFirstNonFull(uint64 hash) const;
+	// Claims a slot for the hash, the value is not constructed yet
+	sizet _prepareInsert(uint64 hash);
+	void _eraseAt(sizet index);
+	void _setCtrl(sizet index, int8 ctrl);
+
+	void _resize(sizet capacity);
+	void _initStorage(sizet capacity);
+	void _destroyValues();
+	void _releaseStorage();
+
+	// The capacity values are followed by the capacity + 1 + 15 control bytes: the control bytes
+	// of the slots, the sentinel and the copies of the first 15 bytes for the groups crossing
+	// the end. Capacity is zero or a power of two minus one.
+	value_type *m_slots;
+	int8 *m_ctrl;
+	sizet m_size;
+	sizet m_capacity;
+	// Empty slots to fill before the next rehash, the deleted ones are not counted
+	sizet m_growthLeft;
+};
+} // namespace detail
+
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+	typename KeyEqual = std::equal_to<Key>>
+class FlatHashMap final
+	: public detail::FlatHashTable<detail::FlatHashMapPolicy<Key, T>, Hash, KeyEqual>
+{
+	using Base = detail::FlatHashTable<detail::FlatHashMapPolicy<Key, T>, Hash, KeyEqual>;
+	inline static constexpr bool IS_TRANSPARENT = detail::IsTransparent<Hash>::value
+		&& detail::IsTransparent<KeyEqual>::value;
+
+public:
+	using mapped_type = T;
+	using typename Base::iterator;
+	using typename Base::const_iterator;
+
+	using Base::Base;
+
+	template <typename ...Args>
+	std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+	template <typename ...Args>
+	std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+
+	template <typename V>
+	std::pair<iterator, bool> insert_or_assign(const Key &key, V &&value);
+	template <typename V>
+	std::pair<iterator, bool> insert_or_assign(Key &&key, V &&value);
+
+	T& operator[](const Key &key) { return try_emplace(key).first->second; }
+	T& operator[](Key &&key) { return try_emplace(std::move(key)).first->second; }
+
+	template <typename K = Key>
+	T& at(const typename detail::FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, Key> &key);
+	template <typename K = Key>
+	const T& at(const typename detail::FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, Key> &key) const;
+};
+
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashSet final
+	: public detail::FlatHashTable<detail::FlatHashSetPolicy<Key>, Hash, KeyEqual>
+{
+	using Base = detail::FlatHashTable<detail::FlatHashSetPolicy<Key>, Hash, KeyEqual>;
+
+public:
+	using Base::Base;
+};
+
+// Named like the standard_containers aliases, a drop in for unordered_map and unordered_set
+// as long as no reference to a value outlives an insertion
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+	typename KeyEqual = std::equal_to<Key>>
+using flat_hash_map = FlatHashMap<Key, T, Hash, KeyEqual>;
+
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using flat_hash_set = FlatHashSet<Key, Hash, KeyEqual>;
+
+namespace detail
+{
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename TValue>
+typename FlatHashTable<Policy, Hash, KeyEqual>::template Iterator<TValue>&
+FlatHashTable<Policy, Hash, KeyEqual>::Iterator<TValue>::operator++()
+{
+	++m_ctrl;
+	++m_slot;
+	_skipEmpty();
+
+	return *this;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename TValue>
+typename FlatHashTable<Policy, Hash, KeyEqual>::template Iterator<TValue>
+FlatHashTable<Policy, Hash, KeyEqual>::Iterator<TValue>::operator++(int)
+{
+	Iterator r(*this);
+	++(*this);
+	return r;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename TValue>
+void FlatHashTable<Policy, Hash, KeyEqual>::Iterator<TValue>::_skipEmpty()
+{
+	// The sentinel stops the walk at the end
+	while (*m_ctrl < FLAT_HASH_SENTINEL)
+	{
+		const uint32 shift = FlatHashGroup(m_ctrl).countLeadingEmptyOrDeleted();
+		m_ctrl += shift;
+		m_slot += shift;
+	}
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable()
+	: m_slots(nullptr)
+	, m_ctrl(const_cast<int8*>(FLAT_HASH_EMPTY_GROUP))
+	, m_size(0)
+	, m_capacity(0)
+	, m_growthLeft(0)
+{
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable(sizet capacity)
+	: FlatHashTable()
+{
+	reserve(capacity);
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable(std::initializer_list<value_type> values)
+	: FlatHashTable(values.size())
+{
+	insert(values);
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable(const FlatHashTable &other)
+	: FlatHashTable(other.size())
+{
+	// Keys are unique already, no lookups
+	for (const value_type &value : other)
+	{
+		const uint64 hash = _hash(Policy::getKey(value));
+		new (m_slots + _prepareInsert(hash)) value_type(value);
+	}
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+FlatHashTable<Policy, Hash, KeyEqual>::FlatHashTable(FlatHashTable &&other)
+	: FlatHashTable()
+{
+	swap(other);
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+FlatHashTable<Policy, Hash, KeyEqual>::~FlatHashTable()
+{
+	_destroyValues();
+	_releaseStorage();
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+FlatHashTable<Policy, Hash, KeyEqual>& FlatHashTable<Policy, Hash, KeyEqual>::operator=(
+	const FlatHashTable &other)
+{
+	if (this != &other)
+	{
+		FlatHashTable copy(other);
+		swap(copy);
+	}
+
+	return *this;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+FlatHashTable<Policy, Hash, KeyEqual>& FlatHashTable<Policy, Hash, KeyEqual>::operator=(
+	FlatHashTable &&other)
+{
+	FlatHashTable moved(std::move(other));
+	swap(moved);
+
+	return *this;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::clear()
+{
+	_destroyValues();
+
+	if (m_capacity)
+	{
+		std::memset(m_ctrl, FLAT_HASH_EMPTY, m_capacity + FLAT_HASH_GROUP_WIDTH);
+		m_ctrl[m_capacity] = FLAT_HASH_SENTINEL;
+	}
+
+	m_size = 0;
+	m_growthLeft = _getGrowth(m_capacity);
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::reserve(sizet count)
+{
+	if (count <= m_size + m_growthLeft)
+	{
+		return;
+	}
+
+	// Smallest capacity with the growth of at least count
+	const sizet minCapacity = count + (count - 1) / 7;
+	_resize(~sizet(0) >> __builtin_clzll(minCapacity));
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+std::pair<typename FlatHashTable<Policy, Hash, KeyEqual>::iterator, bool>
+FlatHashTable<Policy, Hash, KeyEqual>::insert(const value_type &value)
+{
+	return _emplaceKey(Policy::getKey(value), [&value](value_type *slot)
+	{
+		new (slot) value_type(value);
+	});
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+std::pair<typename FlatHashTable<Policy, Hash, KeyEqual>::iterator, bool>
+FlatHashTable<Policy, Hash, KeyEqual>::insert(value_type &&value)
+{
+	return _emplaceKey(Policy::getKey(value), [&value](value_type *slot)
+	{
+		new (slot) value_type(std::move(value));
+	});
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::insert(std::initializer_list<value_type> values)
+{
+	insert(values.begin(), values.end());
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename TInputIt>
+void FlatHashTable<Policy, Hash, KeyEqual>::insert(TInputIt first, TInputIt last)
+{
+	for (; first != last; ++first)
+	{
+		insert(*first);
+	}
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename ...Args>
+std::pair<typename FlatHashTable<Policy, Hash, KeyEqual>::iterator, bool>
+FlatHashTable<Policy, Hash, KeyEqual>::emplace(Args &&...args)
+{
+	return insert(value_type(std::forward<Args>(args)...));
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+typename FlatHashTable<Policy, Hash, KeyEqual>::iterator
+FlatHashTable<Policy, Hash, KeyEqual>::erase(const_iterator it)
+{
+	AR_ASSERT_MSG(it != end(), "End iterator cannot be erased");
+
+	const sizet index = static_cast<sizet>(it.m_ctrl - m_ctrl);
+	_eraseAt(index);
+
+	iterator next(m_ctrl + index, m_slots + index);
+	next._skipEmpty();
+
+	return next;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename K>
+sizet FlatHashTable<Policy, Hash, KeyEqual>::erase(
+	const typename FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, key_type> &key)
+{
+	const sizet index = _findIndex(key, _hash(key));
+	if (index == m_capacity)
+	{
+		return 0u;
+	}
+
+	_eraseAt(index);
+	return 1u;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename K>
+typename FlatHashTable<Policy, Hash, KeyEqual>::iterator FlatHashTable<Policy, Hash, KeyEqual>::find(
+	const typename FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, key_type> &key)
+{
+	const sizet index = _findIndex(key, _hash(key));
+	return iterator(m_ctrl + index, m_slots + index);
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename K>
+typename FlatHashTable<Policy, Hash, KeyEqual>::const_iterator FlatHashTable<Policy, Hash, KeyEqual>::find(
+	const typename FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, key_type> &key) const
+{
+	const sizet index = _findIndex(key, _hash(key));
+	return const_iterator(m_ctrl + index, m_slots + index);
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::swap(FlatHashTable &other)
+{
+	std::swap(m_slots, other.m_slots);
+	std::swap(m_ctrl, other.m_ctrl);
+	std::swap(m_size, other.m_size);
+	std::swap(m_capacity, other.m_capacity);
+	std::swap(m_growthLeft, other.m_growthLeft);
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename K, typename TConstruct>
+std::pair<typename FlatHashTable<Policy, Hash, KeyEqual>::iterator, bool>
+FlatHashTable<Policy, Hash, KeyEqual>::_emplaceKey(const K &key, TConstruct &&construct)
+{
+	const uint64 hash = _hash(key);
+	if (const sizet index = _findIndex(key, hash); index != m_capacity)
+	{
+		return {iterator(m_ctrl + index, m_slots + index), false};
+	}
+
+	const sizet index = _prepareInsert(hash);
+	construct(m_slots + index);
+
+	return {iterator(m_ctrl + index, m_slots + index), true};
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+typename FlatHashTable<Policy, Hash, KeyEqual>::iterator
+FlatHashTable<Policy, Hash, KeyEqual>::_makeIterator(sizet index)
+{
+	iterator it(m_ctrl + index, m_slots + index);
+	it._skipEmpty();
+
+	return it;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+typename FlatHashTable<Policy, Hash, KeyEqual>::const_iterator
+FlatHashTable<Policy, Hash, KeyEqual>::_makeIterator(sizet index) const
+{
+	const_iterator it(m_ctrl + index, m_slots + index);
+	it._skipEmpty();
+
+	return it;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+template <typename K>
+sizet FlatHashTable<Policy, Hash, KeyEqual>::_findIndex(const K &key, uint64 hash) const
+{
+	const int8 h2 = _getH2(hash);
+	sizet offset = (hash >> 7) & m_capacity;
+	sizet step = 0;
+
+	while (true)
+	{
+		const FlatHashGroup group(m_ctrl + offset);
+
+		for (uint32 mask = group.match(h2); mask; mask &= mask - 1)
+		{
+			const sizet index = (offset + static_cast<sizet>(__builtin_ctz(mask))) & m_capacity;
+			if (KeyEqual()(Policy::getKey(m_slots[index]), key))
+			{
+				return index;
+			}
+		}
+
+		// The probing of an insertion would have stopped here as well
+		if (group.matchEmpty())
+		{
+			return m_capacity;
+		}
+
+		step += FLAT_HASH_GROUP_WIDTH;
+		offset = (offset + step) & m_capacity;
+
+		AR_ASSERT_MSG(step <= m_capacity + FLAT_HASH_GROUP_WIDTH, "Table has no empty slots");
+	}
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+sizet FlatHashTable<Policy, Hash, KeyEqual>::_findFirstNonFull(uint64 hash) const
+{
+	sizet offset = (hash >> 7) & m_capacity;
+	sizet step = 0;
+
+	while (true)
+	{
+		if (const uint32 mask = FlatHashGroup(m_ctrl + offset).matchEmptyOrDeleted(); mask)
+		{
+			return (offset + static_cast<sizet>(__builtin_ctz(mask))) & m_capacity;
+		}
+
+		step += FLAT_HASH_GROUP_WIDTH;
+		offset = (offset + step) & m_capacity;
+	}
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+sizet FlatHashTable<Policy, Hash, KeyEqual>::_prepareInsert(uint64 hash)
+{
+	sizet index = _findFirstNonFull(hash);
+
+	// A deleted slot is reused without growing
+	if (m_growthLeft == 0 && m_ctrl[index] != FLAT_HASH_DELETED)
+	{
+		// Mostly deleted slots, the rehash at the same capacity drops them
+		const bool dropDeleted = m_capacity > FLAT_HASH_GROUP_WIDTH && m_size * 32 <= m_capacity * 25;
+		_resize(dropDeleted ? m_capacity : m_capacity * 2 + 1);
+
+		index = _findFirstNonFull(hash);
+	}
+
+	if (m_ctrl[index] == FLAT_HASH_EMPTY)
+	{
+		--m_growthLeft;
+	}
+
+	++m_size;
+	_setCtrl(index, _getH2(hash));
+
+	return index;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::_eraseAt(sizet index)
+{
+	m_slots[index].~value_type();
+	--m_size;
+
+	// A probe window never saw this group full, so the lookups never passed this slot
+	// and it may be empty again instead of deleted
+	const sizet indexBefore = (index - FLAT_HASH_GROUP_WIDTH) & m_capacity;
+	const uint32 emptyAfter = FlatHashGroup(m_ctrl + index).matchEmpty();
+	const uint32 emptyBefore = FlatHashGroup(m_ctrl + indexBefore).matchEmpty();
+
+	const bool wasNeverFull = emptyBefore && emptyAfter
+		&& static_cast<sizet>(__builtin_ctz(emptyAfter) + __builtin_clz(emptyBefore) - 16)
+			< FLAT_HASH_GROUP_WIDTH;
+
+	_setCtrl(index, wasNeverFull ? FLAT_HASH_EMPTY : FLAT_HASH_DELETED);
+	m_growthLeft += wasNeverFull ? 1u : 0u;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::_setCtrl(sizet index, int8 ctrl)
+{
+	constexpr sizet NUM_CLONED_BYTES = FLAT_HASH_GROUP_WIDTH - 1;
+
+	m_ctrl[index] = ctrl;
+	m_ctrl[((index - NUM_CLONED_BYTES) & m_capacity) + (NUM_CLONED_BYTES & m_capacity)] = ctrl;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::_resize(sizet capacity)
+{
+	value_type *slots = m_slots;
+	const int8 *ctrl = m_ctrl;
+	const sizet prevCapacity = m_capacity;
+
+	_initStorage(capacity);
+
+	for (sizet i = 0; i < prevCapacity; ++i)
+	{
+		if (_isFull(ctrl[i]))
+		{
+			const uint64 hash = _hash(Policy::getKey(slots[i]));
+			const sizet index = _findFirstNonFull(hash);
+
+			_setCtrl(index, _getH2(hash));
+			Policy::transfer(m_slots + index, slots + i);
+		}
+	}
+
+	m_growthLeft -= m_size;
+
+	if (prevCapacity)
+	{
+		::operator delete(slots, std::align_val_t(alignof(value_type)));
+	}
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::_initStorage(sizet capacity)
+{
+	AR_ASSERT_MSG(capacity && !(capacity & (capacity + 1)), "Capacity must be a power of two minus one");
+
+	const sizet numCtrlBytes = capacity + FLAT_HASH_GROUP_WIDTH;
+	void *memory = ::operator new(capacity * sizeof(value_type) + numCtrlBytes,
+		std::align_val_t(alignof(value_type)));
+
+	m_slots = static_cast<value_type*>(memory);
+	m_ctrl = reinterpret_cast<int8*>(m_slots + capacity);
+	m_capacity = capacity;
+	m_growthLeft = _getGrowth(capacity);
+
+	std::memset(m_ctrl, FLAT_HASH_EMPTY, numCtrlBytes);
+	m_ctrl[capacity] = FLAT_HASH_SENTINEL;
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::_destroyValues()
+{
+	if constexpr (!std::is_trivially_destructible_v<value_type>)
+	{
+		for (sizet i = 0; i < m_capacity; ++i)
+		{
+			if (_isFull(m_ctrl[i]))
+			{
+				m_slots[i].~value_type();
+			}
+		}
+	}
+}
+
+template <typename Policy, typename Hash, typename KeyEqual>
+void FlatHashTable<Policy, Hash, KeyEqual>::_releaseStorage()
+{
+	if (m_capacity)
+	{
+		::operator delete(m_slots, std::align_val_t(alignof(value_type)));
+	}
+}
+} // namespace detail
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename ...Args>
+std::pair<typename FlatHashMap<Key, T, Hash, KeyEqual>::iterator, bool>
+FlatHashMap<Key, T, Hash, KeyEqual>::try_emplace(const Key &key, Args &&...args)
+{
+	return Base::_emplaceKey(key, [&](std::pair<const Key, T> *slot)
+	{
+		new (slot) std::pair<const Key, T>(std::piecewise_construct, std::forward_as_tuple(key),
+			std::forward_as_tuple(std::forward<Args>(args)...));
+	});
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename ...Args>
+std::pair<typename FlatHashMap<Key, T, Hash, KeyEqual>::iterator, bool>
+FlatHashMap<Key, T, Hash, KeyEqual>::try_emplace(Key &&key, Args &&...args)
+{
+	return Base::_emplaceKey(key, [&](std::pair<const Key, T> *slot)
+	{
+		new (slot) std::pair<const Key, T>(std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+			std::forward_as_tuple(std::forward<Args>(args)...));
+	});
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename V>
+std::pair<typename FlatHashMap<Key, T, Hash, KeyEqual>::iterator, bool>
+FlatHashMap<Key, T, Hash, KeyEqual>::insert_or_assign(const Key &key, V &&value)
+{
+	auto result = try_emplace(key, std::forward<V>(value));
+	if (!result.second)
+	{
+		result.first->second = std::forward<V>(value);
+	}
+
+	return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename V>
+std::pair<typename FlatHashMap<Key, T, Hash, KeyEqual>::iterator, bool>
+FlatHashMap<Key, T, Hash, KeyEqual>::insert_or_assign(Key &&key, V &&value)
+{
+	auto result = try_emplace(std::move(key), std::forward<V>(value));
+	if (!result.second)
+	{
+		result.first->second = std::forward<V>(value);
+	}
+
+	return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K>
+T& FlatHashMap<Key, T, Hash, KeyEqual>::at(
+	const typename detail::FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, Key> &key)
+{
+	const auto it = Base::template find<K>(key);
+	AR_CRITICAL(it != Base::end(), "Key is not in the map");
+
+	return it->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K>
+const T& FlatHashMap<Key, T, Hash, KeyEqual>::at(
+	const typename detail::FlatHashKeyArg<IS_TRANSPARENT>::template Type<K, Key> &key) const
+{
+	const auto it = Base::template find<K>(key);
+	AR_CRITICAL(it != Base::end(), "Key is not in the map");
+
+	return it->second;
+}
+} // namespace argon
@@ -4,7 +4,13 @@
 
 namespace argon
 {
-template <typename, uint32> class SlotMap;
+class ArchetypeStorage;
+class ConcurrentSlotGenerator;
+template <typename, typename, typename, typename> class FlatHashMap;
+template <typename, typename, typename> class FlatHashSet;
+struct ContiguousSlotMapStorage;
+struct PagedSlotMapStorage;
+template <typename, uint32, typename> class SlotMap;
 class SlotGenerator;
 template <typename> class SparseStorager;
 } // namespace argon
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
+#include <fundamental/types.hpp>
+
+#include "standard_containers.hpp"
+
+namespace argon
+{
+// Array made of fixed size pages. Growth never moves the elements, only the page table
+// is reallocated and it grows geometrically.
+template <typename T, uint32 NUM_ELEMENTS_PER_PAGE>
+class PagedArray final
+{
+public:
+	static_assert(NUM_ELEMENTS_PER_PAGE != 0
+		&& (NUM_ELEMENTS_PER_PAGE & (NUM_ELEMENTS_PER_PAGE - 1)) == 0,
+		"Number of elements per page must be a power of two");
+
+	inline static constexpr uint32 s_numElementsPerPage = NUM_ELEMENTS_PER_PAGE;
+
+	// Always a multiple of the page size
+	sizet size() const { return m_pages.size() * NUM_ELEMENTS_PER_PAGE; }
+
+	// Allocates pages until at least size elements fit, new elements are value initialized
+	void grow(sizet size);
+
+	T& operator[](sizet index) const;
+
+	T* getPage(sizet page) const { return m_pages[page].get(); }
+
+private:
+	vector<std::unique_ptr<T[]>> m_pages;
+};
+
+template <typename T, uint32 NUM_ELEMENTS_PER_PAGE>
+void PagedArray<T, NUM_ELEMENTS_PER_PAGE>::grow(sizet size)
+{
+	const sizet numPages = (size + NUM_ELEMENTS_PER_PAGE - 1) / NUM_ELEMENTS_PER_PAGE;
+	if (numPages <= m_pages.size())
+	{
+		return;
+	}
+
+	if (numPages > m_pages.capacity())
+	{
+		m_pages.reserve(std::max(numPages, m_pages.capacity() * 2));
+	}
+
+	while (m_pages.size() < numPages)
+	{
+		m_pages.push_back(std::make_unique<T[]>(NUM_ELEMENTS_PER_PAGE));
+	}
+}
+
+template <typename T, uint32 NUM_ELEMENTS_PER_PAGE>
+T& PagedArray<T, NUM_ELEMENTS_PER_PAGE>::operator[](sizet index) const
+{
+	AR_ASSERT(index < size());
+
+	return m_pages[index / NUM_ELEMENTS_PER_PAGE][index % NUM_ELEMENTS_PER_PAGE];
+}
+} // namespace argon
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -10,18 +11,90 @@
 #include <fundamental/debug.hpp>
 #include <fundamental/types.hpp>
 
+#include "paged_array.hpp"
 #include "standard_containers.hpp"
 
 namespace argon
 {
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE = 64>
+// Storage policy of SlotMap. Objects live in pages of NUM_OBJECTS_PER_PAGE,
+// growth never moves them and iteration walks one page at a time.
+struct PagedSlotMapStorage
+{
+	template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
+	class Storage final
+	{
+	public:
+		sizet capacity() const { return m_pages.size(); }
+
+		void grow(sizet minCapacity, sizet) { m_pages.grow(minCapacity); }
+
+		ObjType* getData(uint32 index) const { return &m_pages[index]; }
+
+		// End of the contiguous block the object belongs to
+		ObjType* getBlockEnd(uint32 index) const
+		{
+			return m_pages.getPage(index / NUM_OBJECTS_PER_PAGE) + NUM_OBJECTS_PER_PAGE;
+		}
+
+	private:
+		PagedArray<ObjType, NUM_OBJECTS_PER_PAGE> m_pages;
+	};
+};
+
+// Storage policy of SlotMap. Objects live in a single dense array which starts at
+// NUM_OBJECTS_PER_PAGE objects and grows geometrically, growth moves the objects.
+// Iteration is a flat pointer walk.
+struct ContiguousSlotMapStorage
+{
+	template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
+	class Storage final
+	{
+	public:
+		Storage()
+			: m_capacity(0)
+		{
+		}
+
+		sizet capacity() const { return m_capacity; }
+
+		void grow(sizet minCapacity, sizet size)
+		{
+			if (m_capacity >= minCapacity)
+			{
+				return;
+			}
+
+			const sizet newCapacity = std::max(minCapacity, m_capacity * 2);
+			auto memory = std::make_unique<ObjType[]>(newCapacity);
+
+			std::move(m_memory.get(), m_memory.get() + size, memory.get());
+
+			m_memory = std::move(memory);
+			m_capacity = newCapacity;
+		}
+
+		ObjType* getData(uint32 index) const { return m_memory.get() + index; }
+		ObjType* getBlockEnd(uint32) const { return m_memory.get() + m_capacity; }
+
+	private:
+		std::unique_ptr<ObjType[]> m_memory;
+		sizet m_capacity;
+	};
+};
+
+// NUM_OBJECTS_PER_PAGE is the page size of the paged storage and the initial capacity
+// of the contiguous one
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE = 64,
+	typename StoragePolicy = PagedSlotMapStorage>
 class SlotMap final
 {
-	struct DirectMemPage;
+	using Storage = typename StoragePolicy::template Storage<ObjType, NUM_OBJECTS_PER_PAGE>;
 
 public:
-	inline static uint32 s_numObjectPerPage = NUM_OBJECTS_PER_PAGE;
+	inline static constexpr uint32 s_numObjectPerPage = NUM_OBJECTS_PER_PAGE;
 
+	// Keeps the pointer into the current block, so stepping is a pointer increment
+	// and the block is looked up only when it is crossed
 	class Iterator final
 	{
 	public:
@@ -34,12 +107,12 @@ public:
 		using iterator_category = std::random_access_iterator_tag;
 
 		Iterator();
-		Iterator(DirectMemPage *pages, uint32 index);
+		Iterator(const Storage *storage, uint32 index, uint32 size);
 
-		reference operator*();
-		const_reference operator*() const;
-		pointer operator->();
-		const_pointer operator->() const;
+		reference operator*() { return *m_current; }
+		const_reference operator*() const { return *m_current; }
+		pointer operator->() { return m_current; }
+		const_pointer operator->() const { return m_current; }
 		reference operator[](int m);
 		const_reference operator[](int m) const;
 
@@ -54,7 +127,10 @@ public:
 		Iterator operator+(int n) const;
 		Iterator operator-(int n) const;
 
-		difference_type operator-(const Iterator &rhs) const { return m_index - rhs.m_index; }
+		difference_type operator-(const Iterator &rhs) const
+		{
+			return static_cast<difference_type>(m_index) - static_cast<difference_type>(rhs.m_index);
+		}
 
 		bool operator<(const Iterator &rhs) const { return m_index < rhs.m_index; }
 		bool operator<=(const Iterator &rhs) const { return m_index <= rhs.m_index; }
@@ -64,9 +140,13 @@ public:
 		bool operator==(const Iterator &rhs) const { return m_index == rhs.m_index; }
 
 	private:
-		DirectMemPage* m_pages;
+		void _seek();
+
+		const Storage *m_storage;
+		ObjType *m_current;
+		ObjType *m_blockEnd;
 		uint32 m_index;
-		AR_ATTR_UNUSED byte _pad[4];
+		uint32 m_size;
 	};
 
 	class Slot final
@@ -98,35 +178,53 @@ public:
 	ObjType& at(Slot slot) const;
 	void erase(Slot slot);
 	bool isSlotValid(Slot slot) const;
-	
+
+	// Grows the memory once for the whole batch, the objects are default constructed
+	// or constructed from init(sizet i) for the i-th slot
+	void allocateN(sizet count, Slot *outSlots);
+	template <typename TInit>
+	void allocateN(sizet count, Slot *outSlots, TInit &&init);
+	// Fills the holes of the whole batch with the objects from the back in one pass
+	void eraseN(const Slot *slots, sizet count);
+
+	// Allocates the objects and the tables for at least capacity objects up front,
+	// so allocations below it never grow the memory
+	void reserve(sizet capacity);
+
 	sizet size() const { return static_cast<sizet>(m_size); }
+	sizet capacity() const { return m_objects.capacity(); }
+
+	// Invokes func(ObjType *begin, ObjType *end) for every contiguous run of the objects,
+	// a page in the paged storage and the whole array in the contiguous one
+	template <typename TFunc>
+	void forEachBlock(TFunc &&func) const;
 
-	const_iterator_type cbegin() const { return const_iterator_type(m_directPages.data(), 0u); }
-	const_iterator_type begin() const { return const_iterator_type(m_directPages.data(), 0u); }
-	iterator_type begin() { return iterator_type(m_directPages.data(), 0u); }
+	const_iterator_type cbegin() const { return const_iterator_type(&m_objects, 0u, m_size); }
+	const_iterator_type begin() const { return const_iterator_type(&m_objects, 0u, m_size); }
+	iterator_type begin() { return iterator_type(&m_objects, 0u, m_size); }
 
-	const_iterator_type cend() const { return const_iterator_type(m_directPages.data(), m_size); }
-	const_iterator_type end() const { return const_iterator_type(m_directPages.data(), m_size); }
-	iterator_type end() { return iterator_type(m_directPages.data(), m_size); }
+	const_iterator_type cend() const { return const_iterator_type(&m_objects, m_size, m_size); }
+	const_iterator_type end() const { return const_iterator_type(&m_objects, m_size, m_size); }
+	iterator_type end() { return iterator_type(&m_objects, m_size, m_size); }
 
 private:
-	struct DirectMemPage
-	{
-		std::unique_ptr<ObjType[]> m_memory;
-	};
-	using DirectMemPages = vector<DirectMemPage>;
-	using RedirectSlots = vector<Slot>;
-	using BackwardsMapping = vector<uint32>;
+	// Entries of the redirect and backwards mapping tables in a page
+	inline static constexpr uint32 s_numEntriesPerTablePage = 1024;
 
-	void _pushDirectPage();
-	void _refitRedirectSlots();
-	uint32 _getPageNumber(uint32 val) const;
-	uint32 _getPageOffset(uint32 val) const;
+	using RedirectSlots = PagedArray<Slot, s_numEntriesPerTablePage>;
+	using BackwardsMapping = PagedArray<uint32, s_numEntriesPerTablePage>;
 
-	// TODO: consider making redirect vector and backwardsMapping paginated
-	// TODO: consider providing a choice to have a contigious memory instead of directPages
+	// Marks the objects erased by eraseN in the backwards mapping
+	inline static constexpr uint32 s_erasedObject = std::numeric_limits<uint32>::max();
+
+	void _grow(sizet minCapacity);
+	template <typename TConstruct>
+	void _allocateN(sizet count, Slot *outSlots, TConstruct &&construct);
+	void _refitRedirectSlots(uint32 prevSize, uint32 newSize);
+
+	// Both tables cover at least the capacity, entries past it are unused
 	RedirectSlots m_redirect;
-	DirectMemPages m_directPages;
+	Storage m_objects;
 	BackwardsMapping m_backwardsMapping;
 
 	uint32 m_size;
@@ -135,132 +233,134 @@ private:
 	uint32 m_head;
 };
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::Iterator()
-	: m_pages(nullptr)
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::Iterator()
+	: m_storage(nullptr)
+	, m_current(nullptr)
+	, m_blockEnd(nullptr)
 	, m_index(0)
+	, m_size(0)
 {
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::Iterator(DirectMemPage* pages, uint32 index)
-	: m_pages(pages)
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::Iterator(const Storage *storage,
+	uint32 index, uint32 size)
+	: m_storage(storage)
+	, m_current(nullptr)
+	, m_blockEnd(nullptr)
 	, m_index(index)
+	, m_size(size)
 {
+	_seek();
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::reference
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator*()
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::reference
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator[](int m)
 {
-	return m_pages[m_index / s_numObjectPerPage].m_memory[m_index % s_numObjectPerPage];
+	return *m_storage->getData(m_index + static_cast<uint32>(m));
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::const_reference
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator*() const
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::const_reference
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator[](int m) const
 {
-	return m_pages[m_index / s_numObjectPerPage].m_memory[m_index % s_numObjectPerPage];
+	return *m_storage->getData(m_index + static_cast<uint32>(m));
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::pointer
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator->()
-{
-	return &m_pages[m_index / s_numObjectPerPage].m_memory[m_index % s_numObjectPerPage];
-}
-
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::const_pointer
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator->() const
-{
-	return &m_pages[m_index / s_numObjectPerPage].m_memory[m_index % s_numObjectPerPage];
-}
-
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::reference
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator[](int m)
-{
-	const auto index = m_index + static_cast<uint32>(m);
-	return m_pages[index / s_numObjectPerPage].m_memory[index % s_numObjectPerPage];
-}
-
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::const_reference
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator[](int m) const
-{
-	const auto index = m_index + static_cast<uint32>(m);
-	return m_pages[index / s_numObjectPerPage].m_memory[index % s_numObjectPerPage];
-}
-
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator&
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator++()
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator&
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator++()
 {
 	++m_index;
+	if (++m_current == m_blockEnd)
+	{
+		_seek();
+	}
+
 	return *this;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator&
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator--()
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator&
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator--()
 {
 	--m_index;
+	_seek();
 	return *this;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator++(int)
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator++(int)
 {
 	Iterator r(*this);
-	++m_index;
+	++(*this);
 	return r;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator--(int)
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator--(int)
 {
 	Iterator r(*this);
-	--m_index;
+	--(*this);
 	return r;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator&
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator+=(int n)
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator&
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator+=(int n)
 {
-	m_index += n;
+	m_index += static_cast<uint32>(n);
+	_seek();
 	return *this;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator&
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator-=(int n)
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator&
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator-=(int n)
 {
-	m_index -= n;
+	m_index -= static_cast<uint32>(n);
+	_seek();
 	return *this;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator+(int n) const
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator+(int n) const
 {
 	Iterator r(*this);
 	return r += n;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Iterator::operator-(int n) const
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::operator-(int n) const
 {
 	Iterator r(*this);
-	return r += n;
+	return r -= n;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Slot::Slot()
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Iterator::_seek()
+{
+	if (m_index < m_size)
+	{
+		m_current = m_storage->getData(m_index);
+		m_blockEnd = m_storage->getBlockEnd(m_index);
+	}
+	else
+	{
+		// Past the end, nothing to dereference
+		m_current = nullptr;
+		m_blockEnd = nullptr;
+	}
+}
+
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Slot::Slot()
 	: m_index(0xFFFFFF)
 	, m_generation(0)
 {
@@ -268,51 +368,50 @@ SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Slot::Slot()
 		"Slot size should be equal to a pointer size");
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-bool SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Slot::operator==(const Slot &rhs)
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+bool SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Slot::operator==(const Slot &rhs)
 {
 	return this->m_index == rhs.m_index && this->m_generation == rhs.m_generation;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-bool SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Slot::operator!=(const Slot &rhs)
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+bool SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Slot::operator!=(const Slot &rhs)
 {
 	return !(*this == rhs);
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::SlotMap()
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::SlotMap()
 	: m_size(0)
 	, m_head(0)
 {
-	_pushDirectPage();
+	_grow(NUM_OBJECTS_PER_PAGE);
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::~SlotMap()
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::~SlotMap()
 {
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
 template <typename ...Args>
-typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::Slot
-SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::allocate(Args &&...args)
+typename SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::Slot
+SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::allocate(Args &&...args)
 {
-	const auto capacity = m_directPages.size() * NUM_OBJECTS_PER_PAGE;
+	const auto capacity = m_objects.capacity();
 
-		AR_CRITICAL(m_head <= capacity,
+	AR_CRITICAL(m_head <= capacity,
 		"Free list head must point at most at one element after the end of memory");
 
 	if (m_head == capacity)
 	{
-		_pushDirectPage();
+		_grow(capacity + 1);
 	}
 
 	Slot &redirectSlot = m_redirect[m_head];
 	const uint32 freeObjectIndex = m_size;
 
-	DirectMemPage& page = m_directPages[freeObjectIndex / NUM_OBJECTS_PER_PAGE];
-	new (&page.m_memory[freeObjectIndex % NUM_OBJECTS_PER_PAGE]) ObjType(std::forward<Args>(args)...);
+	new (m_objects.getData(freeObjectIndex)) ObjType(std::forward<Args>(args)...);
 
 	m_backwardsMapping[m_size] = m_head;
 	m_head = redirectSlot.m_index;
@@ -320,42 +419,37 @@ SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::allocate(Args &&...args)
 
 	Slot newSlot = redirectSlot;
 	newSlot.m_index = m_backwardsMapping[m_size];
-	
+
 	++m_size;
 
 	return newSlot;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-ObjType& SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::at(Slot slot) const
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+ObjType& SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::at(Slot slot) const
 {
 	AR_ASSERT(isSlotValid(slot));
 
-	const uint32 page = _getPageNumber(slot.m_index);
-	const uint32 offset =  _getPageOffset(slot.m_index);
-
-	return m_directPages[page].m_memory[offset];
+	return *m_objects.getData(m_redirect[slot.m_index].m_index);
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::erase(Slot slot)
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::erase(Slot slot)
 {
 	AR_ASSERT(isSlotValid(slot));
 
-	const uint32 page = _getPageNumber(slot.m_index);
-	const uint32 offset = _getPageOffset(slot.m_index);
-
-	m_directPages[page].m_memory[offset].~ObjType();
-
 	AR_CRITICAL(m_size != 0,
 		"Container variable indicating its size is about to underflow");
 
-	const auto backPage = (m_size - 1) / NUM_OBJECTS_PER_PAGE;
-	const auto backOffset = (m_size - 1) % NUM_OBJECTS_PER_PAGE;
+	const uint32 objectIndex = m_redirect[slot.m_index].m_index;
+	const uint32 backIndex = m_size - 1;
 
-	m_directPages[page].m_memory[offset] = std::move(m_directPages[backPage].m_memory[backOffset]);
-	m_redirect[m_backwardsMapping[m_size - 1]].m_index = m_redirect[slot.m_index].m_index;
-	m_backwardsMapping[slot.m_index] = m_backwardsMapping[m_size - 1];
+	ObjType *object = m_objects.getData(objectIndex);
+	object->~ObjType();
+
+	*object = std::move(*m_objects.getData(backIndex));
+	m_redirect[m_backwardsMapping[backIndex]].m_index = objectIndex;
+	m_backwardsMapping[objectIndex] = m_backwardsMapping[backIndex];
 
 	m_redirect[slot.m_index].m_index = m_head;
 	++m_redirect[slot.m_index].m_generation;
@@ -364,48 +458,150 @@ void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::erase(Slot slot)
 	--m_size;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-bool SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::isSlotValid(Slot slot) const
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+bool SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::isSlotValid(Slot slot) const
 {
-	return slot.m_index < m_redirect.size() && m_redirect[slot.m_index].m_generation == slot.m_generation;
+	return slot.m_index < m_objects.capacity() && m_redirect[slot.m_index].m_generation == slot.m_generation;
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::_pushDirectPage()
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::allocateN(sizet count, Slot *outSlots)
 {
-	m_directPages.push_back({std::make_unique<ObjType[]>(NUM_OBJECTS_PER_PAGE)});
-	m_backwardsMapping.resize(m_backwardsMapping.size() + NUM_OBJECTS_PER_PAGE);
+	_allocateN(count, outSlots, [](ObjType *object, sizet)
+	{
+		new (object) ObjType();
+	});
+}
 
-	const uint32 numPages = static_cast<uint32>(m_directPages.size());
-	if (numPages * NUM_OBJECTS_PER_PAGE > m_redirect.size())
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+template <typename TInit>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::allocateN(sizet count, Slot *outSlots,
+	TInit &&init)
+{
+	_allocateN(count, outSlots, [&init](ObjType *object, sizet i)
 	{
-		_refitRedirectSlots();
-	}
+		new (object) ObjType(init(i));
+	});
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::_refitRedirectSlots()
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::eraseN(const Slot *slots, sizet count)
 {
-	const uint32 prevSize = static_cast<uint32>(m_redirect.size());
-	const uint32 newSize = prevSize + NUM_OBJECTS_PER_PAGE;
+	AR_CRITICAL(count <= m_size,
+		"Container variable indicating its size is about to underflow");
 
-	m_redirect.resize(prevSize + NUM_OBJECTS_PER_PAGE);
+	const uint32 newSize = m_size - static_cast<uint32>(count);
 
-	for (uint32 i = prevSize + 1; i <= newSize; ++i)
+	for (sizet i = 0; i < count; ++i)
 	{
-		m_redirect[i - 1].m_index = i;
+		AR_ASSERT(isSlotValid(slots[i]));
+
+		const uint32 objectIndex = m_redirect[slots[i].m_index].m_index;
+		AR_CRITICAL(m_backwardsMapping[objectIndex] != s_erasedObject, "Slot is erased twice");
+
+		m_objects.getData(objectIndex)->~ObjType();
+		m_backwardsMapping[objectIndex] = s_erasedObject;
+	}
+
+	// Every hole below the new size takes the next survivor above it
+	uint32 survivor = newSize;
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		Slot &redirectSlot = m_redirect[slots[i].m_index];
+
+		if (const uint32 objectIndex = redirectSlot.m_index; objectIndex < newSize)
+		{
+			while (m_backwardsMapping[survivor] == s_erasedObject)
+			{
+				++survivor;
+			}
+
+			*m_objects.getData(objectIndex) = std::move(*m_objects.getData(survivor));
+			m_backwardsMapping[objectIndex] = m_backwardsMapping[survivor];
+			m_redirect[m_backwardsMapping[objectIndex]].m_index = objectIndex;
+			++survivor;
+		}
+
+		redirectSlot.m_index = m_head;
+		++redirectSlot.m_generation;
+		m_head = slots[i].m_index;
+	}
+
+	m_size = newSize;
+}
+
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::reserve(sizet capacity)
+{
+	_grow(capacity);
+}
+
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+template <typename TFunc>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::forEachBlock(TFunc &&func) const
+{
+	uint32 index = 0;
+	while (index < m_size)
+	{
+		ObjType *begin = m_objects.getData(index);
+		ObjType *end = std::min(m_objects.getBlockEnd(index), begin + (m_size - index));
+
+		func(begin, end);
+		index += static_cast<uint32>(end - begin);
 	}
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-uint32 SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::_getPageNumber(uint32 val) const
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::_grow(sizet minCapacity)
 {
-	return m_redirect[val].m_index / NUM_OBJECTS_PER_PAGE;
+	AR_CRITICAL(minCapacity <= 0xFFFFFF, "Slot index does not fit into 24 bits");
+
+	const uint32 prevCapacity = static_cast<uint32>(m_objects.capacity());
+	m_objects.grow(minCapacity, m_size);
+
+	const uint32 capacity = static_cast<uint32>(m_objects.capacity());
+	m_backwardsMapping.grow(capacity);
+	m_redirect.grow(capacity);
+
+	_refitRedirectSlots(prevCapacity, capacity);
 }
 
-template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE>
-uint32 SlotMap<ObjType, NUM_OBJECTS_PER_PAGE>::_getPageOffset(uint32 val) const
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+template <typename TConstruct>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::_allocateN(sizet count, Slot *outSlots,
+	TConstruct &&construct)
 {
-	return m_redirect[val].m_index % NUM_OBJECTS_PER_PAGE;
+	// Every slot beyond the size is free, so the free list holds capacity - size slots
+	if (const sizet required = m_size + count; required > m_objects.capacity())
+	{
+		_grow(required);
+	}
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		construct(m_objects.getData(m_size), i);
+
+		Slot &redirectSlot = m_redirect[m_head];
+		m_backwardsMapping[m_size] = m_head;
+
+		outSlots[i] = redirectSlot;
+		outSlots[i].m_index = m_head;
+
+		m_head = redirectSlot.m_index;
+		redirectSlot.m_index = m_size;
+
+		++m_size;
+	}
+}
+
+template <typename ObjType, uint32 NUM_OBJECTS_PER_PAGE, typename StoragePolicy>
+void SlotMap<ObjType, NUM_OBJECTS_PER_PAGE, StoragePolicy>::_refitRedirectSlots(uint32 prevSize, uint32 newSize)
+{
+	// The free list used to end at prevSize, continue it through the new slots
+	for (uint32 i = prevSize + 1; i <= newSize; ++i)
+	{
+		m_redirect[i - 1].m_index = i;
+	}
 }
 } // namespace argon
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <initializer_list>
 #include <memory>
+#include <utility>
 
 #include <fundamental/compiler_macros.hpp>
 #include <fundamental/debug.hpp>
+#include <fundamental/helper_macros.hpp>
 #include <fundamental/types.hpp>
 
 #include "standard_containers.hpp"
@@ -33,6 +39,7 @@ public:
 		GenType getGeneration() const { return m_generation; }
 
 	private:
+		friend class ConcurrentSlotGenerator;
 		friend class SlotGenerator;
 		template <typename> friend class SparseStorage;
 
@@ -49,6 +56,13 @@ public:
 	void release(Slot slot);
 	bool isValid(Slot slot) const;
 
+	// Grows the memory once for the whole batch
+	void acquireN(sizet count, Slot *outSlots);
+	void releaseN(const Slot *slots, sizet count);
+
+	// Number of acquired slots
+	sizet size() const { return m_size; }
+
 private:
 	struct MemPage
 	{
@@ -58,12 +72,16 @@ private:
 	using MemPages = vector<MemPage>;
 
 	void _allocatePage();
+	Slot& _getSlot(uint32 index) const;
 
 	MemPages m_memPages;
 	uint32 m_head;
-	AR_ATTR_UNUSED byte _pad[4];
+	uint32 m_size;
 };
 
+// Unique value for the current order of the dense slots of a SparseStorage
+AR_SYM_EXPORT uint64 acquireStorageOrdering();
+
 template <typename TData>
 class SparseStorage final
 {
@@ -120,27 +138,67 @@ public:
 	using iterator_type = Iterator;
 	using const_iterator_type = const Iterator;
 
-	SparseStorage() = default;
+	// Number of dense elements sharing a write version
+	inline static constexpr sizet VERSION_BLOCK_SIZE = 64u;
+
+	SparseStorage();
 
 	template <typename ...Args>
-	void assign(SlotGenerator::Slot slot, Args &&...args);
+	TData& assign(SlotGenerator::Slot slot, Args &&...args);
 	bool has(SlotGenerator::Slot slot) const;
 	void erase(SlotGenerator::Slot slot);
 
+	// Mutable accessors mark the block of the element as changed
 	TData& at(SlotGenerator::Slot slot);
 	const TData& at(SlotGenerator::Slot slot) const;
 
+	// Single redirection probe, returns nullptr if nothing is assigned to the slot
+	TData* find(SlotGenerator::Slot slot);
+	const TData* find(SlotGenerator::Slot slot) const;
+
 	sizet size() const { return m_storage.size(); }
 
+	// Incrementally sorts the dense arrays by the slot index, so iterations over several storages
+	// walk the memory in the same direction. Visits at most budget slots per call and resumes
+	// where the previous call stopped. Returns true once the storage is sorted.
+	bool compact(sizet budget);
+	// Dense arrays are ordered by the slot index
+	bool isSorted() const { return m_sorted; }
+
+	// Both storages hold the same slots at the same dense indices, so the data of one of them
+	// may be addressed with the indices of the other without the redirection lookups.
+	// The slots are compared only when one of the storages changed since the last match.
+	template <typename TOther>
+	bool sharesOrdering(const SparseStorage<TOther> &other) const;
+
+	// Starts a new write version and returns the previous one, so the blocks written afterwards
+	// have greater versions than the result. Several readers may observe at once.
+	uint64 observe() { return m_version.fetch_add(1u, std::memory_order_relaxed); }
+	// Version of the last write into the dense elements
+	// [block * VERSION_BLOCK_SIZE, (block + 1) * VERSION_BLOCK_SIZE)
+	const uint64* getBlockVersions() const { return m_blockVersions.data(); }
+	// Writes through getData have to be marked by the caller
+	void markBlockChanged(sizet block);
+	// Marks the write with an older version, a newer version of the block is kept
+	void markBlockChanged(sizet block, uint64 version);
+
+	// Dense arrays, slot at index i owns data at index i
+	TData* getData() { return m_storage.data(); }
+	const TData* getData() const { return m_storage.data(); }
+	const SlotGenerator::Slot* getSlots() const { return m_slots.data(); }
+
 	const_iterator_type cbegin() const { return const_iterator_type(m_storage.data(), 0u); }
 	const_iterator_type begin() const { return const_iterator_type(m_storage.data(), 0u); }
-	iterator_type begin() { return iterator_type(m_storage.data(), 0u); }
+	// Marks the whole storage as changed
+	iterator_type begin();
 
 	const_iterator_type cend() const { return const_iterator_type(m_storage.data(), m_storage.size()); }
 	const_iterator_type end() const { return const_iterator_type(m_storage.data(), m_storage.size()); }
 	iterator_type end() { return iterator_type(m_storage.data(), m_storage.size()); }
 
 private:
+	template <typename> friend class SparseStorage;
+
 	struct RedirectMemPage
 	{
 		std::unique_ptr<SlotGenerator::Slot[]> m_memory;
@@ -148,16 +206,50 @@ private:
 
 	using RedirectMemPages = vector<RedirectMemPage>;
 	using DirectStorage = vector<TData>;
+	using DirectSlots = vector<SlotGenerator::Slot>;
 
 	void _prepareRedirectionMemory(SlotGenerator::Slot slot);
-	
+	SlotGenerator::Slot* _findRedirection(SlotGenerator::Slot slot) const;
+	// Swaps two dense entries and fixes their redirections
+	void _swap(uint32 lhs, uint32 rhs);
+	void _markChanged(sizet location);
+	// The dense slots were added, removed or moved
+	void _reorder();
+
 	RedirectMemPages m_redirection;
 	DirectStorage m_storage;
+	// backwards mapping from the dense storage to the slots
+	DirectSlots m_slots;
+	vector<uint64> m_blockVersions;
+	std::atomic<uint64> m_version;
+	// See acquireStorageOrdering
+	uint64 m_ordering;
+	// Ordering of the last storage found to hold the same dense slots, 0 if there is none
+	mutable std::atomic<uint64> m_sharedOrdering;
+	// Next slot index visited by the compaction and the dense index it fills
+	uint32 m_compactSlot;
+	uint32 m_compactPosition;
+	bool m_sorted;
+	// A structural change broke the order behind the compaction cursor, the pass starts over
+	bool m_compactDirty;
+	AR_PAD(6);
 };
 
+template <typename TData>
+SparseStorage<TData>::SparseStorage()
+	: m_version(1u)
+	, m_ordering(acquireStorageOrdering())
+	, m_sharedOrdering(0u)
+	, m_compactSlot(0)
+	, m_compactPosition(0)
+	, m_sorted(true)
+	, m_compactDirty(false)
+{
+}
+
 template <typename TData>
 template <typename ...Args>
-void SparseStorage<TData>::assign(SlotGenerator::Slot slot, Args &&...args)
+TData& SparseStorage<TData>::assign(SlotGenerator::Slot slot, Args &&...args)
 {
 	AR_CRITICAL(!has(slot), "Some data is already assigned to this slot");
 
@@ -170,19 +262,34 @@ void SparseStorage<TData>::assign(SlotGenerator::Slot slot, Args &&...args)
 	internalSlot.m_index = static_cast<SlotGenerator::Slot::IndexType>(m_storage.size());
 	internalSlot.m_generation = slot.m_generation;
 
-	m_storage.emplace_back(std::forward<Args>(args)...);
+	if (!m_slots.empty() && m_slots.back().m_index > slot.m_index)
+	{
+		m_sorted = false;
+	}
+
+	// The pass does not visit the slots behind its cursor again
+	if (slot.m_index < m_compactSlot)
+	{
+		m_compactDirty = true;
+	}
+
+	const sizet location = m_storage.size();
+	if (location % VERSION_BLOCK_SIZE == 0)
+	{
+		m_blockVersions.push_back(0u);
+	}
+
+	_markChanged(location);
+	_reorder();
+
+	m_slots.push_back(slot);
+	return m_storage.emplace_back(std::forward<Args>(args)...);
 }
 
 template <typename TData>
 bool SparseStorage<TData>::has(SlotGenerator::Slot slot) const
 {
-	const auto pageNum = slot.m_index / SlotGenerator::SLOTS_PER_PAGES;
-	const auto offset = slot.m_index % SlotGenerator::SLOTS_PER_PAGES;
-
-	return pageNum < m_redirection.size()
-		&& m_redirection[pageNum].m_memory
-		&& m_redirection[pageNum].m_memory[offset].m_index != SlotGenerator::Slot::INVALID_INDEX
-		&& m_redirection[pageNum].m_memory[offset].m_generation == slot.m_generation;
+	return _findRedirection(slot) != nullptr;
 }
 
 template <typename TData>
@@ -198,8 +305,35 @@ void SparseStorage<TData>::erase(SlotGenerator::Slot slot)
 	++internalSlot.m_generation;
 	internalSlot.m_index = SlotGenerator::Slot::INVALID_INDEX;
 
-	m_storage[location] = std::move(m_storage.back());
+	const auto backLocation = m_storage.size() - 1;
+	if (location < m_compactPosition)
+	{
+		// The hole in the sorted part is refilled from the unsorted tail
+		m_compactPosition = location;
+		m_compactDirty = m_compactDirty || location != backLocation;
+	}
+
+	if (location != backLocation)
+	{
+		m_sorted = false;
+
+		const SlotGenerator::Slot backSlot = m_slots[backLocation];
+		m_redirection[backSlot.m_index / SlotGenerator::SLOTS_PER_PAGES]
+			.m_memory[backSlot.m_index % SlotGenerator::SLOTS_PER_PAGES].m_index = location;
+
+		m_storage[location] = std::move(m_storage.back());
+		m_slots[location] = backSlot;
+		_markChanged(location);
+	}
+
 	m_storage.pop_back();
+	m_slots.pop_back();
+	_reorder();
+
+	if (m_storage.size() % VERSION_BLOCK_SIZE == 0)
+	{
+		m_blockVersions.pop_back();
+	}
 }
 
 template <typename TData>
@@ -209,7 +343,10 @@ TData& SparseStorage<TData>::at(SlotGenerator::Slot slot)
 	const auto pageNum = slot.m_index / SlotGenerator::SLOTS_PER_PAGES;
 	const auto offset = slot.m_index % SlotGenerator::SLOTS_PER_PAGES;
 
-	return m_storage[m_redirection[pageNum].m_memory[offset].m_index];
+	const sizet location = m_redirection[pageNum].m_memory[offset].m_index;
+	_markChanged(location);
+
+	return m_storage[location];
 }
 
 template <typename TData>
@@ -222,13 +359,136 @@ const TData& SparseStorage<TData>::at(SlotGenerator::Slot slot) const
 	return m_storage[m_redirection[pageNum].m_memory[offset].m_index];
 }
 
+template <typename TData>
+TData* SparseStorage<TData>::find(SlotGenerator::Slot slot)
+{
+	const SlotGenerator::Slot *internalSlot = _findRedirection(slot);
+	if (!internalSlot)
+	{
+		return nullptr;
+	}
+
+	_markChanged(internalSlot->m_index);
+	return &m_storage[internalSlot->m_index];
+}
+
+template <typename TData>
+const TData* SparseStorage<TData>::find(SlotGenerator::Slot slot) const
+{
+	const SlotGenerator::Slot *internalSlot = _findRedirection(slot);
+	return internalSlot ? &m_storage[internalSlot->m_index] : nullptr;
+}
+
+template <typename TData>
+void SparseStorage<TData>::markBlockChanged(sizet block)
+{
+	AR_ASSERT(block < m_blockVersions.size());
+	m_blockVersions[block] = m_version.load(std::memory_order_relaxed);
+}
+
+template <typename TData>
+void SparseStorage<TData>::markBlockChanged(sizet block, uint64 version)
+{
+	AR_ASSERT(block < m_blockVersions.size());
+	m_blockVersions[block] = std::max(m_blockVersions[block], version);
+}
+
+template <typename TData>
+typename SparseStorage<TData>::iterator_type SparseStorage<TData>::begin()
+{
+	std::fill(m_blockVersions.begin(), m_blockVersions.end(), m_version.load(std::memory_order_relaxed));
+	return iterator_type(m_storage.data(), 0u);
+}
+
+template <typename TData>
+bool SparseStorage<TData>::compact(sizet budget)
+{
+	const auto numSlots = static_cast<uint32>(m_redirection.size() * SlotGenerator::SLOTS_PER_PAGES);
+	bool reordered = false;
+
+	while (!m_sorted && budget > 0)
+	{
+		if (m_compactSlot >= numSlots)
+		{
+			AR_ASSERT(m_compactDirty || m_compactPosition == m_storage.size());
+
+			m_sorted = !m_compactDirty;
+			m_compactSlot = 0;
+			m_compactPosition = 0;
+			m_compactDirty = false;
+			continue;
+		}
+
+		const auto pageNum = m_compactSlot / SlotGenerator::SLOTS_PER_PAGES;
+		const SlotGenerator::Slot *page = m_redirection[pageNum].m_memory.get();
+		if (!page)
+		{
+			m_compactSlot = (pageNum + 1) * SlotGenerator::SLOTS_PER_PAGES;
+			continue;
+		}
+
+		// Walking the redirection visits the assigned slots in the increasing order
+		const uint32 location = page[m_compactSlot % SlotGenerator::SLOTS_PER_PAGES].m_index;
+		++m_compactSlot;
+		--budget;
+
+		if (location == SlotGenerator::Slot::INVALID_INDEX)
+		{
+			continue;
+		}
+
+		if (location != m_compactPosition)
+		{
+			_swap(location, m_compactPosition);
+			reordered = true;
+		}
+
+		++m_compactPosition;
+	}
+
+	if (reordered)
+	{
+		_reorder();
+	}
+
+	return m_sorted;
+}
+
+template <typename TData>
+template <typename TOther>
+bool SparseStorage<TData>::sharesOrdering(const SparseStorage<TOther> &other) const
+{
+	static_assert(sizeof(SlotGenerator::Slot) == sizeof(uint64), "Slots are compared bitwise");
+
+	if (m_slots.size() != other.size())
+	{
+		return false;
+	}
+
+	// Any change of either storage acquires a new ordering, so a cached match is still valid
+	if (m_sharedOrdering.load(std::memory_order_relaxed) == other.m_ordering)
+	{
+		return true;
+	}
+
+	// Stops at the first mismatch, a sequential scan is far cheaper than a lookup per element
+	if (!m_slots.empty()
+		&& std::memcmp(m_slots.data(), other.getSlots(), m_slots.size() * sizeof(SlotGenerator::Slot)) != 0)
+	{
+		return false;
+	}
+
+	// Concurrent queries only read the storages, they may store different matches in any order
+	m_sharedOrdering.store(other.m_ordering, std::memory_order_relaxed);
+	return true;
+}
+
 template <typename TData>
 void SparseStorage<TData>::_prepareRedirectionMemory(SlotGenerator::Slot slot)
 {
 	const uint32 pageNum = slot.m_index / SlotGenerator::SLOTS_PER_PAGES;
 
-	if (const uint32 size = static_cast<uint32>(m_redirection.size()) * SlotGenerator::SLOTS_PER_PAGES;
-		slot.m_index <= size)
+	if (pageNum >= m_redirection.size())
 	{
 		m_redirection.resize(pageNum + 1);
 	}
@@ -239,4 +499,51 @@ void SparseStorage<TData>::_prepareRedirectionMemory(SlotGenerator::Slot slot)
 			std::make_unique<SlotGenerator::Slot[]>(SlotGenerator::SLOTS_PER_PAGES);
 	}
 }
+
+template <typename TData>
+SlotGenerator::Slot* SparseStorage<TData>::_findRedirection(SlotGenerator::Slot slot) const
+{
+	const auto pageNum = slot.m_index / SlotGenerator::SLOTS_PER_PAGES;
+	const auto offset = slot.m_index % SlotGenerator::SLOTS_PER_PAGES;
+
+	if (pageNum >= m_redirection.size() || !m_redirection[pageNum].m_memory)
+	{
+		return nullptr;
+	}
+
+	SlotGenerator::Slot &internalSlot = m_redirection[pageNum].m_memory[offset];
+	return internalSlot.m_index != SlotGenerator::Slot::INVALID_INDEX
+		&& internalSlot.m_generation == slot.m_generation ? &internalSlot : nullptr;
+}
+
+template <typename TData>
+void SparseStorage<TData>::_swap(uint32 lhs, uint32 rhs)
+{
+	std::swap(m_storage[lhs], m_storage[rhs]);
+	std::swap(m_slots[lhs], m_slots[rhs]);
+
+	for (const uint32 location : {lhs, rhs})
+	{
+		const SlotGenerator::Slot slot = m_slots[location];
+		m_redirection[slot.m_index / SlotGenerator::SLOTS_PER_PAGES]
+			.m_memory[slot.m_index % SlotGenerator::SLOTS_PER_PAGES].m_index =
+				static_cast<SlotGenerator::Slot::IndexType>(location);
+
+		// The element may come from a block written later than the destination one
+		_markChanged(location);
+	}
+}
+
+template <typename TData>
+void SparseStorage<TData>::_markChanged(sizet location)
+{
+	m_blockVersions[location / VERSION_BLOCK_SIZE] = m_version.load(std::memory_order_relaxed);
+}
+
+template <typename TData>
+void SparseStorage<TData>::_reorder()
+{
+	m_ordering = acquireStorageOrdering();
+	m_sharedOrdering.store(0u, std::memory_order_relaxed);
+}
 } // namespace argon
@@ -0,0 +1,396 @@
+#include <algorithm>
+
+#include <fundamental/debug.hpp>
+
+#include "archetype_storage.hpp"
+
+namespace argon
+{
+namespace
+{
+sizet alignOffset(sizet offset, sizet alignment)
+{
+	return (offset + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+ArchetypeStorage::Archetype::Archetype(vector<ColumnInfo> &&columns,
+	const std::atomic<uint64> &version)
+	: m_columns(std::move(columns))
+	, m_version(version)
+	, m_chunkCapacity(0)
+	, m_size(0)
+{
+	sizet rowSize = sizeof(SlotGenerator::Slot);
+	for (const auto &column : m_columns)
+	{
+		rowSize += column.m_size;
+	}
+
+	// Alignment padding between the arrays can only make the capacity smaller
+	for (sizet capacity = CHUNK_SIZE / rowSize; capacity > 0; --capacity)
+	{
+		sizet offset = capacity * sizeof(SlotGenerator::Slot);
+		m_columnOffsets.clear();
+
+		for (const auto &column : m_columns)
+		{
+			offset = alignOffset(offset, column.m_alignment);
+			m_columnOffsets.push_back(offset);
+			offset += capacity * column.m_size;
+		}
+
+		if (offset <= CHUNK_SIZE)
+		{
+			m_chunkCapacity = capacity;
+			break;
+		}
+	}
+
+	AR_CRITICAL(m_chunkCapacity > 0, "Components of the archetype do not fit into a chunk");
+}
+
+ArchetypeStorage::Archetype::~Archetype()
+{
+	for (sizet row = 0; row < m_size; ++row)
+	{
+		for (sizet column = 0; column < m_columns.size(); ++column)
+		{
+			m_columns[column].m_destroy(_getElement(row, column));
+		}
+	}
+}
+
+sizet ArchetypeStorage::Archetype::getColumnIndex(TypeId id) const
+{
+	const auto it = std::lower_bound(m_columns.begin(), m_columns.end(), id,
+		[](const ColumnInfo &info, TypeId val) { return info.m_id < val; });
+
+	return it != m_columns.end() && it->m_id == id
+		? static_cast<sizet>(it - m_columns.begin())
+		: INVALID_COLUMN;
+}
+
+sizet ArchetypeStorage::Archetype::getChunkSize(sizet chunk) const
+{
+	AR_ASSERT(chunk < m_chunks.size());
+	return chunk + 1 < m_chunks.size() ? m_chunkCapacity : m_size - chunk * m_chunkCapacity;
+}
+
+void* ArchetypeStorage::Archetype::getColumn(sizet chunk, sizet column) const
+{
+	AR_ASSERT(chunk < m_chunks.size() && column < m_columns.size());
+	return m_chunks[chunk]->m_memory + m_columnOffsets[column];
+}
+
+const SlotGenerator::Slot* ArchetypeStorage::Archetype::getSlots(sizet chunk) const
+{
+	AR_ASSERT(chunk < m_chunks.size());
+	return reinterpret_cast<const SlotGenerator::Slot*>(m_chunks[chunk]->m_memory);
+}
+
+uint64 ArchetypeStorage::Archetype::getColumnVersion(sizet chunk, sizet column) const
+{
+	AR_ASSERT(chunk < m_chunks.size() && column < m_columns.size());
+	return m_versions[chunk * m_columns.size() + column];
+}
+
+void ArchetypeStorage::Archetype::markChanged(sizet chunk, sizet column)
+{
+	AR_ASSERT(chunk < m_chunks.size() && column < m_columns.size());
+	m_versions[chunk * m_columns.size() + column] = m_version.load(std::memory_order_relaxed);
+}
+
+void ArchetypeStorage::Archetype::markChanged(sizet chunk, sizet column, uint64 version)
+{
+	AR_ASSERT(chunk < m_chunks.size() && column < m_columns.size());
+	uint64 &current = m_versions[chunk * m_columns.size() + column];
+	current = std::max(current, version);
+}
+
+void* ArchetypeStorage::Archetype::_getElement(sizet row, sizet column) const
+{
+	return static_cast<byte*>(getColumn(row / m_chunkCapacity, column))
+		+ (row % m_chunkCapacity) * m_columns[column].m_size;
+}
+
+SlotGenerator::Slot& ArchetypeStorage::Archetype::_getSlot(sizet row) const
+{
+	return reinterpret_cast<SlotGenerator::Slot*>(
+		m_chunks[row / m_chunkCapacity]->m_memory)[row % m_chunkCapacity];
+}
+
+void ArchetypeStorage::Archetype::_markRowChanged(sizet row)
+{
+	const auto versions = m_versions.begin()
+		+ static_cast<ptrdiff>(row / m_chunkCapacity * m_columns.size());
+	std::fill(versions, versions + static_cast<ptrdiff>(m_columns.size()),
+		m_version.load(std::memory_order_relaxed));
+}
+
+sizet ArchetypeStorage::Archetype::_pushRow(SlotGenerator::Slot slot)
+{
+	if (m_size == m_chunks.size() * m_chunkCapacity)
+	{
+		m_chunks.push_back(std::make_unique<Chunk>());
+		m_versions.resize(m_chunks.size() * m_columns.size());
+	}
+
+	// The row is filled by the caller
+	_markRowChanged(m_size);
+
+	new (&_getSlot(m_size)) SlotGenerator::Slot(slot);
+	return m_size++;
+}
+
+void ArchetypeStorage::Archetype::_removeRow(sizet row)
+{
+	AR_CRITICAL(row < m_size, "Row is out of range");
+
+	const sizet last = m_size - 1;
+	if (row != last)
+	{
+		for (sizet column = 0; column < m_columns.size(); ++column)
+		{
+			void *back = _getElement(last, column);
+			m_columns[column].m_moveConstruct(_getElement(row, column), back);
+			m_columns[column].m_destroy(back);
+		}
+
+		_getSlot(row) = _getSlot(last);
+		_markRowChanged(row);
+	}
+
+	--m_size;
+
+	if (m_size == (m_chunks.size() - 1) * m_chunkCapacity)
+	{
+		m_chunks.pop_back();
+		m_versions.resize(m_chunks.size() * m_columns.size());
+	}
+}
+
+ArchetypeStorage::ArchetypeStorage()
+	: m_version(1u)
+{
+}
+
+ArchetypeStorage::~ArchetypeStorage() = default;
+
+void ArchetypeStorage::erase(SlotGenerator::Slot slot, TypeId id)
+{
+	AR_CRITICAL(has(slot, id), "Component is not assigned to the slot");
+
+	const Location &location = m_locations[slot.getIndex()];
+	const Archetype &archetype = *m_archetypes[location.m_archetype];
+
+	if (archetype.getColumns().size() == 1)
+	{
+		remove(slot);
+		return;
+	}
+
+	_move(slot, _getRemoveEdge(location.m_archetype, id));
+}
+
+void ArchetypeStorage::remove(SlotGenerator::Slot slot)
+{
+	const Location *location = _findLocation(slot);
+	if (!location)
+	{
+		return;
+	}
+
+	const uint32 archetypeIndex = location->m_archetype;
+	const sizet row = location->m_row;
+	Archetype &archetype = *m_archetypes[archetypeIndex];
+
+	for (sizet column = 0; column < archetype.m_columns.size(); ++column)
+	{
+		archetype.m_columns[column].m_destroy(archetype._getElement(row, column));
+	}
+
+	_removeRow(archetypeIndex, row);
+	m_locations[slot.getIndex()].m_archetype = Location::INVALID_ARCHETYPE;
+}
+
+bool ArchetypeStorage::has(SlotGenerator::Slot slot, TypeId id) const
+{
+	return find(slot, id) != nullptr;
+}
+
+void* ArchetypeStorage::find(SlotGenerator::Slot slot, TypeId id)
+{
+	const Location *location = _findLocation(slot);
+	if (!location)
+	{
+		return nullptr;
+	}
+
+	Archetype &archetype = *m_archetypes[location->m_archetype];
+	const sizet column = archetype.getColumnIndex(id);
+	if (column == INVALID_COLUMN)
+	{
+		return nullptr;
+	}
+
+	archetype.markChanged(location->m_row / archetype.m_chunkCapacity, column);
+	return archetype._getElement(location->m_row, column);
+}
+
+const void* ArchetypeStorage::find(SlotGenerator::Slot slot, TypeId id) const
+{
+	const Location *location = _findLocation(slot);
+	if (!location)
+	{
+		return nullptr;
+	}
+
+	const Archetype &archetype = *m_archetypes[location->m_archetype];
+	const sizet column = archetype.getColumnIndex(id);
+
+	return column != INVALID_COLUMN ? archetype._getElement(location->m_row, column) : nullptr;
+}
+
+void* ArchetypeStorage::_assign(SlotGenerator::Slot slot, const ColumnInfo &info)
+{
+	AR_CRITICAL(!has(slot, info.m_id), "Component is already assigned to the slot");
+
+	if (slot.getIndex() >= m_locations.size())
+	{
+		m_locations.resize(slot.getIndex() + 1);
+	}
+
+	const Location &location = m_locations[slot.getIndex()];
+	AR_CRITICAL(location.m_archetype == Location::INVALID_ARCHETYPE
+		|| location.m_generation == slot.getGeneration(),
+		"Previous owner of the slot still has components");
+
+	if (location.m_archetype == Location::INVALID_ARCHETYPE)
+	{
+		const uint32 archetypeIndex = _getArchetype({info});
+		const sizet row = m_archetypes[archetypeIndex]->_pushRow(slot);
+
+		m_locations[slot.getIndex()] = {archetypeIndex, static_cast<uint32>(row), slot.getGeneration()};
+		return m_archetypes[archetypeIndex]->_getElement(row, 0);
+	}
+
+	const uint32 archetypeIndex = _getAddEdge(location.m_archetype, info);
+	_move(slot, archetypeIndex);
+
+	const Archetype &archetype = *m_archetypes[archetypeIndex];
+	return archetype._getElement(m_locations[slot.getIndex()].m_row, archetype.getColumnIndex(info.m_id));
+}
+
+const ArchetypeStorage::Location* ArchetypeStorage::_findLocation(SlotGenerator::Slot slot) const
+{
+	if (slot.getIndex() >= m_locations.size())
+	{
+		return nullptr;
+	}
+
+	const Location &location = m_locations[slot.getIndex()];
+	return location.m_archetype != Location::INVALID_ARCHETYPE
+		&& location.m_generation == slot.getGeneration() ? &location : nullptr;
+}
+
+uint32 ArchetypeStorage::_getArchetype(vector<ColumnInfo> &&columns)
+{
+	vector<TypeId> signature;
+	signature.reserve(columns.size());
+
+	for (const auto &column : columns)
+	{
+		signature.push_back(column.m_id);
+	}
+
+	if (const auto it = m_archetypeLookup.find(signature); it != m_archetypeLookup.end())
+	{
+		return it->second;
+	}
+
+	const uint32 index = static_cast<uint32>(m_archetypes.size());
+	m_archetypes.push_back(std::make_unique<Archetype>(std::move(columns), m_version));
+	m_archetypeLookup.emplace(std::move(signature), index);
+
+	return index;
+}
+
+uint32 ArchetypeStorage::_getAddEdge(uint32 archetype, const ColumnInfo &info)
+{
+	if (const auto it = m_archetypes[archetype]->m_addEdges.find(info.m_id);
+		it != m_archetypes[archetype]->m_addEdges.end())
+	{
+		return it->second;
+	}
+
+	vector<ColumnInfo> columns = m_archetypes[archetype]->m_columns;
+	columns.insert(std::lower_bound(columns.begin(), columns.end(), info.m_id,
+		[](const ColumnInfo &column, TypeId val) { return column.m_id < val; }), info);
+
+	const uint32 target = _getArchetype(std::move(columns));
+	m_archetypes[archetype]->m_addEdges.emplace(info.m_id, target);
+	m_archetypes[target]->m_removeEdges.emplace(info.m_id, archetype);
+
+	return target;
+}
+
+uint32 ArchetypeStorage::_getRemoveEdge(uint32 archetype, TypeId id)
+{
+	if (const auto it = m_archetypes[archetype]->m_removeEdges.find(id);
+		it != m_archetypes[archetype]->m_removeEdges.end())
+	{
+		return it->second;
+	}
+
+	vector<ColumnInfo> columns = m_archetypes[archetype]->m_columns;
+	columns.erase(columns.begin() + static_cast<ptrdiff>(m_archetypes[archetype]->getColumnIndex(id)));
+
+	const uint32 target = _getArchetype(std::move(columns));
+	m_archetypes[archetype]->m_removeEdges.emplace(id, target);
+	m_archetypes[target]->m_addEdges.emplace(id, archetype);
+
+	return target;
+}
+
+void ArchetypeStorage::_move(SlotGenerator::Slot slot, uint32 archetype)
+{
+	Location &location = m_locations[slot.getIndex()];
+	Archetype &src = *m_archetypes[location.m_archetype];
+	Archetype &dst = *m_archetypes[archetype];
+
+	const sizet srcRow = location.m_row;
+	const sizet dstRow = dst._pushRow(slot);
+
+	// Columns missing in the destination are the ones being erased
+	for (sizet column = 0; column < src.m_columns.size(); ++column)
+	{
+		void *element = src._getElement(srcRow, column);
+		if (const sizet dstColumn = dst.getColumnIndex(src.m_columns[column].m_id);
+			dstColumn != INVALID_COLUMN)
+		{
+			src.m_columns[column].m_moveConstruct(dst._getElement(dstRow, dstColumn), element);
+		}
+
+		src.m_columns[column].m_destroy(element);
+	}
+
+	_removeRow(location.m_archetype, srcRow);
+
+	location.m_archetype = archetype;
+	location.m_row = static_cast<uint32>(dstRow);
+}
+
+void ArchetypeStorage::_removeRow(uint32 archetype, sizet row)
+{
+	Archetype &target = *m_archetypes[archetype];
+	const bool movesBack = row + 1 != target.size();
+
+	target._removeRow(row);
+
+	if (movesBack)
+	{
+		m_locations[target._getSlot(row).getIndex()].m_row = static_cast<uint32>(row);
+	}
+}
+} // namespace argon
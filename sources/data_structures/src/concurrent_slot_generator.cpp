@@ -0,0 +1,267 @@
+#include <algorithm>
+
+#include <fundamental/debug.hpp>
+
+#include "concurrent_slot_generator.hpp"
+
+namespace argon
+{
+namespace
+{
+inline constexpr uint32 MAX_PAGES =
+	(ConcurrentSlotGenerator::MAX_SLOTS + ConcurrentSlotGenerator::SLOTS_PER_PAGE - 1)
+		/ ConcurrentSlotGenerator::SLOTS_PER_PAGE;
+} // namespace
+
+ConcurrentSlotGenerator::LocalCache::LocalCache(ConcurrentSlotGenerator &generator)
+	: m_generator(generator)
+	, m_size(0u)
+{
+}
+
+ConcurrentSlotGenerator::LocalCache::~LocalCache()
+{
+	m_generator._flush(*this, m_size);
+}
+
+ConcurrentSlotGenerator::ConcurrentSlotGenerator()
+	: m_pages(std::make_unique<std::atomic<Entry*>[]>(MAX_PAGES))
+	, m_fresh(0u)
+{
+	for (uint32 i = 0; i < MAX_PAGES; ++i)
+	{
+		m_pages[i].store(nullptr, std::memory_order_relaxed);
+	}
+
+	Slot head;
+	head.m_index = Slot::INVALID_INDEX;
+	head.m_generation = 0u;
+	m_head.store(head, std::memory_order_relaxed);
+}
+
+ConcurrentSlotGenerator::~ConcurrentSlotGenerator()
+{
+	for (uint32 i = 0; i < MAX_PAGES; ++i)
+	{
+		delete[] m_pages[i].load(std::memory_order_relaxed);
+	}
+}
+
+ConcurrentSlotGenerator::Slot ConcurrentSlotGenerator::acquire()
+{
+	uint32 index;
+	if (_pop(&index, 1u) == 0u)
+	{
+		index = _acquireFresh(1u);
+	}
+
+	return _makeSlot(index);
+}
+
+void ConcurrentSlotGenerator::release(Slot slot)
+{
+	AR_CRITICAL(isValid(slot), "ConcurrentSlotGenerator::release :: slot is invalid");
+
+	_invalidate(slot.m_index);
+
+	const uint32 index = slot.m_index;
+	_push(&index, 1u);
+}
+
+bool ConcurrentSlotGenerator::isValid(Slot slot) const
+{
+	const Entry *entry = _findEntry(slot.m_index);
+	return entry && entry->load(std::memory_order_acquire).m_generation == slot.m_generation;
+}
+
+ConcurrentSlotGenerator::Slot ConcurrentSlotGenerator::acquire(LocalCache &cache)
+{
+	AR_ASSERT(&cache.m_generator == this);
+
+	if (cache.m_size == 0u)
+	{
+		constexpr uint32 batch = LocalCache::CAPACITY / 2;
+
+		cache.m_size = _pop(cache.m_indices, batch);
+		if (cache.m_size == 0u)
+		{
+			const uint32 first = _acquireFresh(batch);
+
+			// Reversed, so the slots are handed out in the increasing order
+			for (uint32 i = 0; i < batch; ++i)
+			{
+				cache.m_indices[i] = first + batch - 1 - i;
+			}
+
+			cache.m_size = batch;
+		}
+	}
+
+	return _makeSlot(cache.m_indices[--cache.m_size]);
+}
+
+void ConcurrentSlotGenerator::release(LocalCache &cache, Slot slot)
+{
+	AR_ASSERT(&cache.m_generator == this);
+	AR_CRITICAL(isValid(slot), "ConcurrentSlotGenerator::release :: slot is invalid");
+
+	_invalidate(slot.m_index);
+
+	if (cache.m_size == LocalCache::CAPACITY)
+	{
+		// Keep the most recent half to avoid bouncing at the boundary
+		_flush(cache, LocalCache::CAPACITY / 2);
+	}
+
+	cache.m_indices[cache.m_size++] = slot.m_index;
+}
+
+ConcurrentSlotGenerator::Entry& ConcurrentSlotGenerator::_getEntry(uint32 index) const
+{
+	return m_pages[index / SLOTS_PER_PAGE].load(std::memory_order_acquire)[index % SLOTS_PER_PAGE];
+}
+
+const ConcurrentSlotGenerator::Entry* ConcurrentSlotGenerator::_findEntry(uint32 index) const
+{
+	if (index >= MAX_SLOTS)
+	{
+		return nullptr;
+	}
+
+	const Entry *page = m_pages[index / SLOTS_PER_PAGE].load(std::memory_order_acquire);
+	return page ? &page[index % SLOTS_PER_PAGE] : nullptr;
+}
+
+void ConcurrentSlotGenerator::_invalidate(uint32 index)
+{
+	Entry &entry = _getEntry(index);
+	Slot value = entry.load(std::memory_order_relaxed);
+	++value.m_generation;
+	entry.store(value, std::memory_order_release);
+}
+
+uint32 ConcurrentSlotGenerator::_acquireFresh(uint32 count)
+{
+	const uint32 first = m_fresh.fetch_add(count, std::memory_order_relaxed);
+	AR_CRITICAL(first + count <= MAX_SLOTS, "ConcurrentSlotGenerator is out of slots");
+
+	const uint32 lastPage = (first + count - 1) / SLOTS_PER_PAGE;
+	for (uint32 page = first / SLOTS_PER_PAGE; page <= lastPage; ++page)
+	{
+		if (m_pages[page].load(std::memory_order_acquire))
+		{
+			continue;
+		}
+
+		Entry *memory = new Entry[SLOTS_PER_PAGE];
+		for (uint32 i = 0; i < SLOTS_PER_PAGE; ++i)
+		{
+			Slot value;
+			value.m_index = Slot::INVALID_INDEX;
+			value.m_generation = 0u;
+			memory[i].store(value, std::memory_order_relaxed);
+		}
+
+		// Threads which got indices from the same page race to publish it
+		Entry *expected = nullptr;
+		if (!m_pages[page].compare_exchange_strong(expected, memory,
+			std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			delete[] memory;
+		}
+	}
+
+	return first;
+}
+
+uint32 ConcurrentSlotGenerator::_pop(uint32 *indices, uint32 count)
+{
+	Slot head = m_head.load(std::memory_order_acquire);
+
+	for (;;)
+	{
+		// Links of the slots in the stack do not change until they are popped,
+		// which would change the head as well and fail the exchange
+		uint32 numPopped = 0u;
+		uint32 next = head.m_index;
+
+		while (numPopped < count && next != Slot::INVALID_INDEX)
+		{
+			indices[numPopped++] = next;
+			next = _getEntry(next).load(std::memory_order_relaxed).m_index;
+		}
+
+		if (numPopped == 0u)
+		{
+			return 0u;
+		}
+
+		Slot newHead;
+		newHead.m_index = next;
+		newHead.m_generation = head.m_generation + 1u;
+
+		if (m_head.compare_exchange_weak(head, newHead,
+			std::memory_order_acquire, std::memory_order_acquire))
+		{
+			return numPopped;
+		}
+	}
+}
+
+void ConcurrentSlotGenerator::_push(const uint32 *indices, uint32 count)
+{
+	if (count == 0u)
+	{
+		return;
+	}
+
+	// Link the chain privately, only its last slot points into the shared stack
+	for (uint32 i = 0; i + 1 < count; ++i)
+	{
+		Entry &entry = _getEntry(indices[i]);
+		Slot value = entry.load(std::memory_order_relaxed);
+		value.m_index = indices[i + 1];
+		entry.store(value, std::memory_order_relaxed);
+	}
+
+	Entry &last = _getEntry(indices[count - 1]);
+	Slot head = m_head.load(std::memory_order_relaxed);
+
+	for (;;)
+	{
+		Slot value = last.load(std::memory_order_relaxed);
+		value.m_index = head.m_index;
+		last.store(value, std::memory_order_relaxed);
+
+		Slot newHead;
+		newHead.m_index = indices[0];
+		newHead.m_generation = head.m_generation + 1u;
+
+		if (m_head.compare_exchange_weak(head, newHead,
+			std::memory_order_release, std::memory_order_relaxed))
+		{
+			return;
+		}
+	}
+}
+
+void ConcurrentSlotGenerator::_flush(LocalCache &cache, uint32 count)
+{
+	AR_ASSERT(count <= cache.m_size);
+
+	// The oldest slots go first
+	_push(cache.m_indices, count);
+
+	std::copy(cache.m_indices + count, cache.m_indices + cache.m_size, cache.m_indices);
+	cache.m_size -= count;
+}
+
+ConcurrentSlotGenerator::Slot ConcurrentSlotGenerator::_makeSlot(uint32 index) const
+{
+	Slot slot;
+	slot.m_index = index;
+	slot.m_generation = _getEntry(index).load(std::memory_order_acquire).m_generation;
+
+	return slot;
+}
+} // namespace argon
@@ -1,9 +1,22 @@
+#include <atomic>
+
 #include <fundamental/debug.hpp>
 
 #include "sparse_storage.hpp"
 
 namespace argon
 {
+namespace
+{
+// Orderings are never reused, so a cached ordering of a changed storage never matches
+std::atomic<uint64> s_nextOrdering(1u);
+} // namespace
+
+uint64 acquireStorageOrdering()
+{
+	return s_nextOrdering.fetch_add(1u, std::memory_order_relaxed);
+}
+
 SlotGenerator::Slot::Slot()
 	: m_index(INVALID_INDEX)
 	, m_generation(0u)
@@ -12,6 +25,7 @@ SlotGenerator::Slot::Slot()
 
 SlotGenerator::SlotGenerator()
 	: m_head(0u)
+	, m_size(0u)
 {
 	_allocatePage();
 }
@@ -25,12 +39,11 @@ SlotGenerator::Slot SlotGenerator::acquire()
 		_allocatePage();
 	}
 
-	const uint32 pageNum = m_head / SLOTS_PER_PAGES;
-	const uint32 pageOffset = m_head % SLOTS_PER_PAGES;
-	Slot newSlot = m_memPages[pageNum].m_memory[pageOffset];
-	m_head = newSlot.m_index;
+	Slot newSlot = _getSlot(m_head);
+	newSlot.m_index = m_head;
+	m_head = _getSlot(m_head).m_index;
+	++m_size;
 
-	newSlot.m_index = pageNum * SLOTS_PER_PAGES + pageOffset;
 	return newSlot;
 }
 
@@ -38,21 +51,57 @@ void SlotGenerator::release(Slot slot)
 {
 	AR_CRITICAL(isValid(slot), "SlotGenerator::release :: slot is invalid");
 
-	const uint32 pageNum = slot.m_index / SLOTS_PER_PAGES;
-	const uint32 pageOffset = slot.m_index % SLOTS_PER_PAGES;
-
-	Slot& internalSlot = m_memPages[pageNum].m_memory[pageOffset];
+	Slot& internalSlot = _getSlot(slot.m_index);
 	++internalSlot.m_generation;
-	uint32 newHead = slot.m_index;
-	slot.m_index = m_head;
-	m_head = newHead;
+	internalSlot.m_index = m_head;
+	m_head = slot.m_index;
+	--m_size;
 }
 
 bool SlotGenerator::isValid(Slot slot) const
 {
 	return slot.m_index < m_memPages.size() * SLOTS_PER_PAGES
-		&& slot.m_generation == m_memPages[slot.m_index / SLOTS_PER_PAGES]
-			.m_memory[slot.m_index % SLOTS_PER_PAGES].m_generation;
+		&& slot.m_generation == _getSlot(slot.m_index).m_generation;
+}
+
+void SlotGenerator::acquireN(sizet count, Slot *outSlots)
+{
+	const sizet capacity = m_memPages.size() * SLOTS_PER_PAGES;
+	if (const sizet required = m_size + count; required > capacity)
+	{
+		// The free list ends at the capacity, new pages continue it
+		m_memPages.reserve((required + SLOTS_PER_PAGES - 1) / SLOTS_PER_PAGES);
+		while (m_memPages.size() * SLOTS_PER_PAGES < required)
+		{
+			_allocatePage();
+		}
+	}
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		const Slot &internalSlot = _getSlot(m_head);
+
+		outSlots[i] = internalSlot;
+		outSlots[i].m_index = m_head;
+		m_head = internalSlot.m_index;
+	}
+
+	m_size += static_cast<uint32>(count);
+}
+
+void SlotGenerator::releaseN(const Slot *slots, sizet count)
+{
+	for (sizet i = 0; i < count; ++i)
+	{
+		AR_CRITICAL(isValid(slots[i]), "SlotGenerator::releaseN :: slot is invalid");
+
+		Slot& internalSlot = _getSlot(slots[i].m_index);
+		++internalSlot.m_generation;
+		internalSlot.m_index = m_head;
+		m_head = slots[i].m_index;
+	}
+
+	m_size -= static_cast<uint32>(count);
 }
 
 void SlotGenerator::_allocatePage()
@@ -65,4 +114,9 @@ void SlotGenerator::_allocatePage()
 		m_memPages[lastPageInd].m_memory[i].m_index = lastPageInd * SLOTS_PER_PAGES + i + 1;
 	}
 }
+
+SlotGenerator::Slot& SlotGenerator::_getSlot(uint32 index) const
+{
+	return m_memPages[index / SLOTS_PER_PAGES].m_memory[index % SLOTS_PER_PAGES];
+}
 } // namespace argon
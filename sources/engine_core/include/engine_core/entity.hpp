@@ -2,9 +2,11 @@
 
 #include <data_structures/sparse_storage.hpp>
 
+#include <fundamental/compiler_macros.hpp>
+
 namespace argon
 {
-class Entity final
+class AR_SYM_EXPORT Entity final
 {
 public:
 	Entity();
@@ -12,9 +14,17 @@ public:
 	uint32 getIndex() const { return m_slot.getIndex(); }
 	uint64 getGeneration() const { return m_slot.getGeneration(); }
 
+	bool operator==(const Entity &rhs) const
+	{
+		return getIndex() == rhs.getIndex() && getGeneration() == rhs.getGeneration();
+	}
+	bool operator!=(const Entity &rhs) const { return !(*this == rhs); }
+
 private:
+	friend class EntityCommandBuffer;
 	friend class EntityManager;
-	
+	template <typename ...> friend class Query;
+
 	Entity(SlotGenerator::Slot slot);
 
 	SlotGenerator::Slot m_slot;
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <data_structures/archetype_storage.hpp>
+#include <data_structures/flat_hash_map.hpp>
+#include <data_structures/sparse_storage.hpp>
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/helper_macros.hpp>
+#include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
+
+#include "entity.hpp"
+#include "entity_manager.hpp"
+
+namespace argon
+{
+// Records structural changes which are unsafe while systems iterate the storages.
+// Every thread records into its own buffer, see EntityManager::getCommandBuffer, and all
+// buffers are played back by the space after the systems tick. The playback is grouped by
+// component type, so every storage is touched once.
+//
+// Entities are created right away, only their components are deferred. Assigning a component
+// which is already present replaces it, erasing a missing one does nothing. Destruction is
+// played back after all component changes.
+class AR_SYM_EXPORT EntityCommandBuffer final
+	: NonCopyable
+{
+public:
+	EntityCommandBuffer(EntityManager &manager);
+	~EntityCommandBuffer();
+
+	Entity createEntity();
+	void destroyEntity(const Entity &e);
+
+	template <typename T, typename ...Args>
+	void assign(const Entity &e, Args &&...args);
+	template <typename T>
+	void erase(const Entity &e);
+
+	bool isEmpty() const;
+
+private:
+	friend class EntityManager;
+
+	using TypeId = ArchetypeStorage::TypeId;
+
+	struct Command
+	{
+		inline static constexpr uint32 ERASE = std::numeric_limits<uint32>::max();
+
+		Command(SlotGenerator::Slot slot, uint32 value)
+			: m_slot(slot)
+			, m_value(value)
+		{
+		}
+
+		SlotGenerator::Slot m_slot;
+		// Index of the component in the values, ERASE for the erase command
+		uint32 m_value;
+		AR_PAD(4);
+	};
+
+	// Commands of a single component type in the order of the recording
+	struct ComponentCommands
+	{
+		using Values = std::unique_ptr<void, void (*)(void*)>;
+		using Playback = void (*)(EntityManager &manager, ComponentCommands &commands);
+
+		// vector<T>
+		Values m_values;
+		Playback m_playback;
+		vector<Command> m_commands;
+	};
+
+	template <typename T>
+	ComponentCommands& _getCommands();
+
+	template <typename T>
+	static void _playback(EntityManager &manager, ComponentCommands &commands);
+
+	EntityManager &m_manager;
+	EntityManager::EntityCache m_cache;
+	flat_hash_map<TypeId, ComponentCommands> m_components;
+	vector<SlotGenerator::Slot> m_destroyed;
+};
+
+template <typename T, typename ...Args>
+void EntityCommandBuffer::assign(const Entity &e, Args &&...args)
+{
+	ComponentCommands &commands = _getCommands<T>();
+	auto &values = *static_cast<vector<T>*>(commands.m_values.get());
+
+	commands.m_commands.emplace_back(e.m_slot, static_cast<uint32>(values.size()));
+	values.emplace_back(std::forward<Args>(args)...);
+}
+
+template <typename T>
+void EntityCommandBuffer::erase(const Entity &e)
+{
+	_getCommands<T>().m_commands.emplace_back(e.m_slot, Command::ERASE);
+}
+
+template <typename T>
+EntityCommandBuffer::ComponentCommands& EntityCommandBuffer::_getCommands()
+{
+	const TypeId id = EntityManager::_getTypeId<T>();
+
+	auto commands = m_components.find(id);
+	if (commands == m_components.end())
+	{
+		ComponentCommands::Values values(new vector<T>(), [](void *memory)
+		{
+			delete static_cast<vector<T>*>(memory);
+		});
+
+		commands = m_components.emplace(id,
+			ComponentCommands{std::move(values), &EntityCommandBuffer::_playback<T>, {}}).first;
+	}
+
+	return commands->second;
+}
+
+template <typename T>
+void EntityCommandBuffer::_playback(EntityManager &manager, ComponentCommands &commands)
+{
+	auto &values = *static_cast<vector<T>*>(commands.m_values.get());
+	const bool archetypes = manager.getStorageType() == ComponentStorageType::Archetype;
+	const TypeId id = EntityManager::_getTypeId<T>();
+
+	// Resolved once for the whole batch
+	ArchetypeStorage *archetypeStorage = archetypes ? &manager._getArchetypes() : nullptr;
+	SparseStorage<T> *sparseStorage = archetypes ? nullptr : &manager._getStorage<T>();
+
+	for (const Command &command : commands.m_commands)
+	{
+		if (!manager.isValid(Entity(command.m_slot)))
+		{
+			// Destroyed right away by someone else
+			continue;
+		}
+
+		T *component = archetypes
+			? archetypeStorage->find<T>(command.m_slot, id)
+			: sparseStorage->find(command.m_slot);
+
+		if (command.m_value == Command::ERASE)
+		{
+			if (component && archetypes)
+			{
+				archetypeStorage->erase(command.m_slot, id);
+			}
+			else if (component)
+			{
+				sparseStorage->erase(command.m_slot);
+			}
+		}
+		else if (component)
+		{
+			*component = std::move(values[command.m_value]);
+		}
+		else if (archetypes)
+		{
+			archetypeStorage->assign<T>(command.m_slot, id, std::move(values[command.m_value]));
+		}
+		else
+		{
+			sparseStorage->assign(command.m_slot, std::move(values[command.m_value]));
+		}
+	}
+
+	// Keeps the memory for the next frame
+	values.clear();
+	commands.m_commands.clear();
+}
+} // namespace argon
@@ -1,26 +1,241 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
+#include <utility>
 
+#include <rttr/type.h>
+#include <rttr/variant.h>
+
+#include <data_structures/archetype_storage.hpp>
+#include <data_structures/concurrent_slot_generator.hpp>
+#include <data_structures/sparse_storage.hpp>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
 #include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
 
 #include "entity.hpp"
-#include <forward_declarations.hpp>
+#include "forward_declarations.hpp"
+#include "query.hpp"
 
 namespace argon
 {
-class EntityManager final
+enum class ComponentStorageType : uint32
+{
+	// Every component type lives in its own SparseStorage
+	Sparse = 0,
+	// Entities with identical sets of components are stored together in chunks
+	Archetype
+};
+
+class AR_SYM_EXPORT EntityManager final
 	: NonCopyable
 {
 public:
-	EntityManager(privateimpl::ServiceManager &serviceManager);
+	EntityManager(privateimpl::ServiceManager &serviceManager, ComponentStorageType storageType);
 	~EntityManager();
 
+	ComponentStorageType getStorageType() const { return m_storageType; }
+
+	// Slots cached by a single thread for the entity creation, see createEntity
+	using EntityCache = ConcurrentSlotGenerator::LocalCache;
+
+	// Creation and validation are thread safe, jobs creating many entities
+	// should pass their own cache
 	Entity createEntity();
+	Entity createEntity(EntityCache &cache);
+	EntityCache createEntityCache();
 	bool isValid(const Entity& e) const;
+	// Destroys all components of the entity and releases it
+	void destroyEntity(const Entity &e);
+
+	// Buffer of the calling thread, it is played back after the systems tick
+	EntityCommandBuffer& getCommandBuffer();
+
+	template <typename T, typename ...Args>
+	T& assign(const Entity &e, Args &&...args);
+	template <typename T>
+	void erase(const Entity &e);
+	template <typename T>
+	bool has(const Entity &e) const;
+	template <typename T>
+	T& get(const Entity &e);
+
+	// Storages are resolved once, no type lookups happen during the iteration.
+	// Const components are only read, the rest are marked as changed.
+	template <typename ...TComponents>
+	Query<TComponents...> query();
+	// Visits only the blocks of T written since the previous query with the same filter,
+	// the untouched entities sharing a block with the changed ones are visited as well.
+	// Writes through a non-const T of the query itself are not reported to the same filter.
+	template <typename ...TComponents, typename T>
+	Query<TComponents...> query(Changed<T> &changed);
 
 private:
+	friend class EntityCommandBuffer;
+	friend class Space;
+	friend class SystemManager;
+	friend class privateimpl::SystemData;
+
+	template <typename T>
+	static ArchetypeStorage::TypeId _getTypeId();
+
+	template <typename T>
+	SparseStorage<T>& _getStorage();
+
+	template <typename ...TComponents>
+	Query<TComponents...> _query(const typename Query<TComponents...>::Filter &filter);
+
+	// Creates the storage if the component type does not have it yet
+	rttr::variant& _getStorage(const rttr::type &type);
+	const rttr::variant* _findStorage(const rttr::type &type) const;
+	// Creates the storage upfront if the type is a component, does nothing otherwise
+	void _prepareStorage(const rttr::type &type);
+
+	// System ticking on the calling thread, returns the previous one
+	static const privateimpl::SystemData* _setRunningSystem(const privateimpl::SystemData *system);
+	// Debug builds check the accesses of the running system against its declared access.
+	// Exclusive systems and the code outside of the ticks access everything.
+	static void _checkAccess(const rttr::type &type, bool write);
+	// Components and entities are added and removed only by the exclusive systems,
+	// the others record the changes into getCommandBuffer
+	static void _checkStructuralChange();
+
+	void _destroyEntities(const SlotGenerator::Slot *slots, sizet count);
+	// Applies the commands of all buffers, must not run concurrently with the systems
+	void _playbackCommands();
+	// Sorts the sparse storages a bit, budget is the number of slots visited per storage
+	void _compactStorages(sizet budget);
+
+	ArchetypeStorage& _getArchetypes();
+	const ArchetypeStorage& _getArchetypes() const;
+
 	privateimpl::ServiceManager &m_serviceManager;
 	privateimpl::EntityManagerData& m_impl;
+	const ComponentStorageType m_storageType;
+	AR_PAD(4);
 };
+
+template <typename T, typename ...Args>
+T& EntityManager::assign(const Entity &e, Args &&...args)
+{
+	AR_CRITICAL(isValid(e), "Entity is not valid");
+#ifndef NDEBUG
+	_checkStructuralChange();
+#endif // ifndef NDEBUG
+
+	if (m_storageType == ComponentStorageType::Archetype)
+	{
+		return _getArchetypes().assign<T>(e.m_slot, _getTypeId<T>(), std::forward<Args>(args)...);
+	}
+
+	return _getStorage<T>().assign(e.m_slot, std::forward<Args>(args)...);
+}
+
+template <typename T>
+void EntityManager::erase(const Entity &e)
+{
+	AR_CRITICAL(isValid(e), "Entity is not valid");
+#ifndef NDEBUG
+	_checkStructuralChange();
+#endif // ifndef NDEBUG
+
+	if (m_storageType == ComponentStorageType::Archetype)
+	{
+		_getArchetypes().erase(e.m_slot, _getTypeId<T>());
+		return;
+	}
+
+	_getStorage<T>().erase(e.m_slot);
+}
+
+template <typename T>
+bool EntityManager::has(const Entity &e) const
+{
+#ifndef NDEBUG
+	_checkAccess(rttr::type::get<T>(), false);
+#endif // ifndef NDEBUG
+
+	if (m_storageType == ComponentStorageType::Archetype)
+	{
+		return _getArchetypes().has(e.m_slot, _getTypeId<T>());
+	}
+
+	const rttr::variant *storage = _findStorage(rttr::type::get<T>());
+	return storage && storage->get_value<SparseStorage<T>*>()->has(e.m_slot);
+}
+
+template <typename T>
+T& EntityManager::get(const Entity &e)
+{
+	AR_CRITICAL(isValid(e), "Entity is not valid");
+#ifndef NDEBUG
+	// The component is returned for writing and its block is marked as changed
+	_checkAccess(rttr::type::get<T>(), true);
+#endif // ifndef NDEBUG
+
+	if (m_storageType == ComponentStorageType::Archetype)
+	{
+		T *component = _getArchetypes().find<T>(e.m_slot, _getTypeId<T>());
+		AR_CRITICAL(component, "Component is not assigned to the entity");
+		return *component;
+	}
+
+	return _getStorage<T>().at(e.m_slot);
+}
+
+template <typename ...TComponents>
+Query<TComponents...> EntityManager::query()
+{
+	return _query<TComponents...>(typename Query<TComponents...>::Filter());
+}
+
+template <typename ...TComponents, typename T>
+Query<TComponents...> EntityManager::query(Changed<T> &changed)
+{
+	using QueryType = Query<TComponents...>;
+	static_assert(QueryType::template _getIndex<T>() != QueryType::NO_FILTER,
+		"Filtered component is not queried");
+
+	typename QueryType::Filter filter;
+	filter.m_component = QueryType::template _getIndex<T>();
+	filter.m_since = changed.m_version;
+
+	changed.m_version = m_storageType == ComponentStorageType::Archetype
+		? _getArchetypes().observe()
+		: _getStorage<std::remove_const_t<T>>().observe();
+	filter.m_observed = changed.m_version;
+
+	return _query<TComponents...>(filter);
+}
+
+template <typename T>
+ArchetypeStorage::TypeId EntityManager::_getTypeId()
+{
+	return static_cast<ArchetypeStorage::TypeId>(rttr::type::get<T>().get_id());
+}
+
+template <typename T>
+SparseStorage<T>& EntityManager::_getStorage()
+{
+	return *_getStorage(rttr::type::get<T>()).template get_value<SparseStorage<T>*>();
+}
+
+template <typename ...TComponents>
+Query<TComponents...> EntityManager::_query(const typename Query<TComponents...>::Filter &filter)
+{
+#ifndef NDEBUG
+	(_checkAccess(rttr::type::get<std::remove_const_t<TComponents>>(), !std::is_const_v<TComponents>), ...);
+#endif // ifndef NDEBUG
+
+	if (m_storageType == ComponentStorageType::Archetype)
+	{
+		return Query<TComponents...>(_getArchetypes(),
+			{_getTypeId<std::remove_const_t<TComponents>>()...}, filter);
+	}
+
+	return Query<TComponents...>(filter, _getStorage<std::remove_const_t<TComponents>>()...);
+}
 } // namespace argon
@@ -4,12 +4,17 @@ namespace argon
 {
 class EngineState;
 class Engine;
+class EntityCommandBuffer;
 class EntityManager;
 class Filesystem;
+class JobCounter;
+class JobSystem;
+class Profiler;
 class ServiceBase;
 class Space;
 class SystemManager;
 class SystemBase;
+class Time;
 
 namespace privateimpl
 {
@@ -17,6 +22,7 @@ struct EntityManagerData;
 class EntityManagerDataProvider;
 class PluginManager;
 class ServiceManager;
+class SystemData;
 struct SystemManagerData;
 class SystemManagerDataProvider;
 } // namespace privateimpl
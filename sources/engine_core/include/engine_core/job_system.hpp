@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/helper_macros.hpp>
+#include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
+
+#include "service.hpp"
+
+namespace argon
+{
+class JobCounter;
+
+using JobFunction = void (*)(void *data, sizet begin, sizet end);
+
+struct Job
+{
+	JobFunction m_function;
+	void *m_data;
+	// Range of the work for the function, its meaning is up to the job
+	sizet m_begin;
+	sizet m_end;
+	JobCounter *m_counter;
+};
+
+// Number of unfinished jobs. Jobs may be deferred until a counter reaches zero.
+class AR_SYM_EXPORT JobCounter final
+	: NonCopyable
+{
+public:
+	JobCounter();
+	~JobCounter();
+
+	// The counter is done once its jobs finished and the deferred jobs were handed off,
+	// it is not touched by the job system afterwards
+	bool isDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+private:
+	friend class JobSystem;
+
+	// Set by the last job while it hands off the deferred jobs
+	inline static constexpr uint32 HANDING_OFF = 1u << 31;
+	// Set once the jobs added during the hand-off finished, the deferred jobs are checked again
+	inline static constexpr uint32 RECHECK = 1u << 30;
+	inline static constexpr uint32 JOB_MASK = RECHECK - 1;
+
+	std::mutex m_mutex;
+	vector<Job> m_dependents;
+	// Unfinished jobs and the hand-off flags
+	std::atomic<uint32> m_pending;
+	AR_PAD(4);
+};
+
+// Every worker owns a work stealing deque, idle workers steal from the others.
+// The thread which created the service is a worker too, it executes jobs only while waiting.
+class AR_SYM_EXPORT JobSystem final
+	: public ServiceBase
+{
+public:
+	JobSystem(ConstructionData &&data);
+	~JobSystem();
+
+	void tick();
+
+	// Including the main thread
+	sizet getNumThreads() const;
+
+	// The job is not started until the dependency is done
+	void run(const Job &job, const JobCounter *dependency = nullptr);
+
+	// func is referenced by the job, it must outlive the counter
+	template <typename TFunc>
+	void run(TFunc &func, JobCounter &counter, const JobCounter *dependency = nullptr);
+
+	// Invokes func(index) for every index in [begin, end), the range is split into grainSize jobs
+	template <typename TFunc>
+	void parallelFor(sizet begin, sizet end, sizet grainSize, TFunc &&func);
+
+	// Executes other jobs until the counter is done
+	void wait(const JobCounter &counter);
+
+private:
+	class JobSystemPrivate;
+
+	std::unique_ptr<JobSystemPrivate> m_jobs;
+};
+
+template <typename TFunc>
+void JobSystem::run(TFunc &func, JobCounter &counter, const JobCounter *dependency)
+{
+	const JobFunction function = [](void *data, sizet, sizet)
+	{
+		(*static_cast<TFunc*>(data))();
+	};
+
+	run(Job{function, &func, 0u, 0u, &counter}, dependency);
+}
+
+template <typename TFunc>
+void JobSystem::parallelFor(sizet begin, sizet end, sizet grainSize, TFunc &&func)
+{
+	using Func = std::remove_reference_t<TFunc>;
+
+	const JobFunction function = [](void *data, sizet rangeBegin, sizet rangeEnd)
+	{
+		Func &body = *static_cast<Func*>(data);
+		for (sizet i = rangeBegin; i < rangeEnd; ++i)
+		{
+			body(i);
+		}
+	};
+
+	JobCounter counter;
+	grainSize = std::max<sizet>(grainSize, 1u);
+
+	for (sizet rangeBegin = begin; rangeBegin < end; rangeBegin += grainSize)
+	{
+		run(Job{function, const_cast<void*>(static_cast<const void*>(&func)), rangeBegin,
+			std::min(rangeBegin + grainSize, end), &counter});
+	}
+
+	wait(counter);
+}
+} // namespace argon
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include <x86intrin.h>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/helper_macros.hpp>
+#include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
+
+#include "service.hpp"
+
+namespace argon
+{
+// Time spent in a zone per frame over the statistics window, the frames without a call are skipped
+struct ProfileZoneStats
+{
+	std::string m_name;
+	float64 m_minMs;
+	float64 m_averageMs;
+	float64 m_p99Ms;
+	float64 m_callsPerFrame;
+};
+
+// Zones are written into per thread ring buffers and drained by endFrame. A zone costs two
+// rdtsc reads and a push into the buffer of the thread, so the profiler is left on in all builds.
+class AR_SYM_EXPORT Profiler final
+	: public ServiceBase
+{
+public:
+	// Frames of the rolling statistics
+	inline static constexpr uint32 NUM_WINDOW_FRAMES = 128u;
+	// Zones a thread can finish between two endFrame calls, the rest are dropped
+	inline static constexpr uint64 MAX_THREAD_ZONES = 1u << 14;
+
+	Profiler(ConstructionData &&data);
+	~Profiler();
+
+	void tick();
+
+	void setEnabled(bool enabled);
+	bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+	// Collects the zones of all threads and advances the window. The zones finished afterwards
+	// belong to the next frame.
+	void endFrame();
+
+	// Zones are identified by the address of the name, which must stay valid while the profiler
+	// is alive. Returns a copy owned by the profiler, the same pointer for equal names.
+	const char* registerName(const std::string &name);
+
+	// The collected zones are kept for the trace until the capture is stopped
+	void startCapture();
+	void stopCapture();
+	bool isCapturing() const;
+	// Chrome trace event format, it is opened by chrome://tracing and Perfetto
+	bool exportChromeTrace(const std::string &path) const;
+
+	vector<ProfileZoneStats> getStats() const;
+	// getStats as a table sorted by the average time
+	void writeStats(std::ostream &out) const;
+
+	// Called by ProfileZone
+	void _record(const char *name, uint64 begin, uint64 end);
+
+private:
+	AR_PRIVATE_IMPL(Profiler);
+
+	std::atomic<bool> m_enabled;
+	AR_PAD(7);
+};
+
+// Times the scope
+class ProfileZone final
+	: NonCopyable
+{
+public:
+	ProfileZone(Profiler &profiler, const char *name);
+	~ProfileZone();
+
+private:
+	Profiler &m_profiler;
+	const char *m_name;
+	// Zero if the profiler was disabled on the entry
+	uint64 m_begin;
+};
+
+AR_FORCE_INLINE ProfileZone::ProfileZone(Profiler &profiler, const char *name)
+	: m_profiler(profiler)
+	, m_name(name)
+	, m_begin(profiler.isEnabled() ? __rdtsc() : 0u)
+{
+}
+
+AR_FORCE_INLINE ProfileZone::~ProfileZone()
+{
+	if (m_begin)
+	{
+		m_profiler._record(m_name, m_begin, __rdtsc());
+	}
+}
+} // namespace argon
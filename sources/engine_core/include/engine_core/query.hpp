@@ -0,0 +1,701 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <data_structures/archetype_storage.hpp>
+#include <data_structures/sparse_storage.hpp>
+
+#include <fundamental/helper_macros.hpp>
+#include <fundamental/types.hpp>
+
+#include "entity.hpp"
+
+namespace argon
+{
+// Remembers the write version of the components T seen by the previous query with this filter,
+// see EntityManager::query. Every system keeps its own filter, so each of them sees every change.
+template <typename T>
+class Changed final
+{
+public:
+	Changed() : m_version(0) {}
+
+private:
+	friend class EntityManager;
+
+	uint64 m_version;
+};
+
+// Iterates over all entities that have every component from TComponents.
+// With sparse storages the iteration is driven by the smallest storage, the rest of the components
+// are resolved through the redirection pages of their storages. Storages which share the ordering
+// with the driver, see SparseStorage::compact, are indexed directly.
+// With archetypes every matching archetype is walked linearly chunk by chunk.
+//
+// Components are marked as changed block by block or chunk by chunk once an entity matched,
+// const components are read only and keep their versions. With a Changed filter the filtered
+// component drives the iteration and its untouched blocks are skipped as a whole. The blocks of
+// the filtered component are marked with the observed version, so the query does not see its own
+// writes the next time, while the other filters of the component still do.
+template <typename ...TComponents>
+class Query final
+{
+	static_assert(sizeof...(TComponents) > 0, "Query should have at least one component");
+
+	inline static constexpr sizet NUM_COMPONENTS = sizeof...(TComponents);
+	inline static constexpr sizet NO_FILTER = std::numeric_limits<sizet>::max();
+
+	template <typename T>
+	using Storage = SparseStorage<std::remove_const_t<T>>;
+
+	using Storages = std::tuple<Storage<TComponents>*...>;
+	using Pointers = std::tuple<TComponents*...>;
+	using Indices = std::index_sequence_for<TComponents...>;
+	using TypeIds = std::array<ArchetypeStorage::TypeId, NUM_COMPONENTS>;
+	using Columns = std::array<sizet, NUM_COMPONENTS>;
+
+	template <sizet I>
+	using TData = std::tuple_element_t<I, std::tuple<TComponents...>>;
+
+	inline static constexpr sizet VERSION_BLOCK_SIZE = Storage<TData<0>>::VERSION_BLOCK_SIZE;
+
+	// Only the blocks of the component written after m_since are visited,
+	// m_observed is the version the filter will compare against the next time
+	struct Filter
+	{
+		sizet m_component = NO_FILTER;
+		uint64 m_since = 0;
+		uint64 m_observed = 0;
+	};
+
+	struct Driver
+	{
+		const SlotGenerator::Slot *m_slots;
+		// Block versions if the driver is filtered, nullptr otherwise
+		const uint64 *m_versions;
+		sizet m_size;
+		// Data of the storages indexed like the driver, see _getAligned
+		Pointers m_aligned;
+	};
+
+public:
+	using value_type = std::tuple<TComponents&...>;
+
+	class Iterator final
+	{
+	public:
+		using value_type = typename Query::value_type;
+		using reference = value_type;
+		using difference_type = ptrdiff;
+		using iterator_category = std::forward_iterator_tag;
+
+		Iterator();
+
+		reference operator*() const { return _dereference(Indices{}); }
+
+		Iterator& operator++() { ++m_index; _skip(); return *this; }
+		Iterator operator++(int) { Iterator r(*this); ++(*this); return r; }
+
+		bool operator!=(const Iterator &rhs) const { return !(*this == rhs); }
+		bool operator==(const Iterator &rhs) const
+		{
+			return m_index == rhs.m_index && m_chunk == rhs.m_chunk && m_archetype == rhs.m_archetype;
+		}
+
+		Entity getEntity() const { return Entity(m_slots[m_index]); }
+
+	private:
+		friend class Query;
+
+		Iterator(const Storages &storages, const Driver &driver, const Filter &filter, sizet index);
+		Iterator(ArchetypeStorage &archetypes, const TypeIds &typeIds, const Filter &filter,
+			sizet archetype);
+
+		template <sizet ...I>
+		reference _dereference(std::index_sequence<I...>) const;
+
+		template <sizet ...I>
+		bool _resolve(std::index_sequence<I...>);
+
+		template <sizet ...I>
+		void _loadChunk(std::index_sequence<I...>);
+
+		void _skip();
+
+		Storages m_storages;
+		ArchetypeStorage *m_archetypes;
+		TypeIds m_typeIds;
+		Columns m_columns;
+		Filter m_filter;
+		const SlotGenerator::Slot *m_slots;
+		const uint64 *m_versions;
+		sizet m_index;
+		sizet m_size;
+		sizet m_chunk;
+		sizet m_archetype;
+		// resolved components in the sparse mode, column arrays of the chunk with archetypes
+		Pointers m_current;
+		Pointers m_aligned;
+	};
+
+	using iterator_type = Iterator;
+
+	// TFunc is invoked either with (Entity, TComponents&...) or with (TComponents&...)
+	template <typename TFunc>
+	void each(TFunc &&func);
+
+	// Upper bound of the number of matching entities
+	sizet sizeHint() const { return m_sizeHint; }
+
+	iterator_type begin();
+	iterator_type end();
+
+private:
+	friend class EntityManager;
+
+	Query(const Filter &filter, Storage<TComponents> &...storages);
+	Query(ArchetypeStorage &archetypes, const TypeIds &typeIds, const Filter &filter);
+
+	// Index of the component T in TComponents, NO_FILTER if it is not queried
+	template <typename T>
+	static constexpr sizet _getIndex();
+
+	template <typename TFunc>
+	static void _invoke(TFunc &func, SlotGenerator::Slot slot, TComponents &...components);
+
+	static bool _getColumns(const ArchetypeStorage::Archetype &archetype, const TypeIds &typeIds,
+		Columns &columns);
+
+	// Read only lookup, the component is marked as changed only once the whole entity matched
+	template <sizet I>
+	static TData<I>* _find(Storage<TData<I>> &storage, SlotGenerator::Slot slot);
+
+	// Do nothing for the const components
+	template <sizet I>
+	static void _markBlock(Storage<TData<I>> &storage, sizet block, const Filter &filter);
+	template <sizet I>
+	static void _markElement(Storage<TData<I>> &storage, const TData<I> *component, const Filter &filter);
+	template <sizet I>
+	static void _markColumn(ArchetypeStorage::Archetype &archetype, sizet chunk, sizet column,
+		const Filter &filter);
+
+	template <typename TFunc, sizet ...I>
+	void _dispatch(TFunc &func, std::index_sequence<I...>);
+
+	template <sizet DRIVER, typename TFunc, sizet ...I>
+	void _each(TFunc &func, std::index_sequence<I...>);
+
+	template <typename TFunc, sizet ...I>
+	void _eachArchetype(TFunc &func, std::index_sequence<I...>);
+
+	// Data of the storage if it shares the ordering with the driver, nullptr otherwise
+	template <sizet DRIVER, sizet I>
+	TData<I>* _getAligned() const;
+
+	// The aligned storages share the blocks with the driver and are marked once per block,
+	// the rest are marked element by element
+	template <sizet I>
+	void _markMatch(const Pointers &aligned, const Pointers &components, sizet block,
+		bool firstInBlock) const;
+
+	// The aligned storages are indexed directly, the rest are looked up
+	template <sizet I>
+	static TData<I>* _fetch(const Storages &storages, const Pointers &aligned, sizet index,
+		SlotGenerator::Slot slot);
+
+	template <sizet DRIVER, sizet ...I>
+	Driver _makeDriver(std::index_sequence<I...>) const;
+
+	template <sizet ...I>
+	Driver _getDriver(std::index_sequence<I...>) const;
+
+	Storages m_storages;
+	ArchetypeStorage *m_archetypes;
+	TypeIds m_typeIds;
+	Filter m_filter;
+	sizet m_driver;
+	sizet m_sizeHint;
+};
+
+template <typename ...TComponents>
+Query<TComponents...>::Iterator::Iterator()
+	: m_storages()
+	, m_archetypes(nullptr)
+	, m_typeIds()
+	, m_columns()
+	, m_filter()
+	, m_slots(nullptr)
+	, m_versions(nullptr)
+	, m_index(0)
+	, m_size(0)
+	, m_chunk(0)
+	, m_archetype(0)
+	, m_current()
+	, m_aligned()
+{
+}
+
+template <typename ...TComponents>
+Query<TComponents...>::Iterator::Iterator(const Storages &storages, const Driver &driver,
+	const Filter &filter, sizet index)
+	: Iterator()
+{
+	m_storages = storages;
+	m_filter = filter;
+	m_slots = driver.m_slots;
+	m_versions = driver.m_versions;
+	m_index = index;
+	m_size = driver.m_size;
+	m_aligned = driver.m_aligned;
+	_skip();
+}
+
+template <typename ...TComponents>
+Query<TComponents...>::Iterator::Iterator(ArchetypeStorage &archetypes, const TypeIds &typeIds,
+	const Filter &filter, sizet archetype)
+	: Iterator()
+{
+	m_archetypes = &archetypes;
+	m_typeIds = typeIds;
+	m_filter = filter;
+	m_archetype = archetype;
+	_loadChunk(Indices{});
+}
+
+template <typename ...TComponents>
+template <sizet ...I>
+typename Query<TComponents...>::Iterator::reference
+Query<TComponents...>::Iterator::_dereference(std::index_sequence<I...>) const
+{
+	return m_archetypes
+		? reference(std::get<I>(m_current)[m_index]...)
+		: reference(*std::get<I>(m_current)...);
+}
+
+template <typename ...TComponents>
+template <sizet ...I>
+bool Query<TComponents...>::Iterator::_resolve(std::index_sequence<I...>)
+{
+	const SlotGenerator::Slot slot = m_slots[m_index];
+	if (!((std::get<I>(m_current) = _fetch<I>(m_storages, m_aligned, m_index, slot)) && ...))
+	{
+		return false;
+	}
+
+	(_markElement<I>(*std::get<I>(m_storages), std::get<I>(m_current), m_filter), ...);
+	return true;
+}
+
+template <typename ...TComponents>
+template <sizet ...I>
+void Query<TComponents...>::Iterator::_loadChunk(std::index_sequence<I...>)
+{
+	const auto &archetypes = m_archetypes->getArchetypes();
+
+	for (; m_archetype < archetypes.size(); ++m_archetype, m_chunk = 0)
+	{
+		ArchetypeStorage::Archetype &archetype = *archetypes[m_archetype];
+		if (!_getColumns(archetype, m_typeIds, m_columns))
+		{
+			continue;
+		}
+
+		for (; m_chunk < archetype.getChunkCount(); ++m_chunk)
+		{
+			if (m_filter.m_component != NO_FILTER
+				&& archetype.getColumnVersion(m_chunk, m_columns[m_filter.m_component]) <= m_filter.m_since)
+			{
+				continue;
+			}
+
+			(_markColumn<I>(archetype, m_chunk, m_columns[I], m_filter), ...);
+
+			m_slots = archetype.getSlots(m_chunk);
+			m_size = archetype.getChunkSize(m_chunk);
+			m_current = Pointers(static_cast<TComponents*>(archetype.getColumn(m_chunk, m_columns[I]))...);
+			return;
+		}
+	}
+
+	m_chunk = 0;
+	m_index = 0;
+	m_size = 0;
+}
+
+template <typename ...TComponents>
+void Query<TComponents...>::Iterator::_skip()
+{
+	if (m_archetypes)
+	{
+		if (m_index == m_size)
+		{
+			m_index = 0;
+			++m_chunk;
+			_loadChunk(Indices{});
+		}
+
+		return;
+	}
+
+	while (m_index < m_size)
+	{
+		if (m_versions && m_versions[m_index / VERSION_BLOCK_SIZE] <= m_filter.m_since)
+		{
+			// The rest of the block is untouched
+			m_index = std::min(m_size, (m_index / VERSION_BLOCK_SIZE + 1) * VERSION_BLOCK_SIZE);
+			continue;
+		}
+
+		if (_resolve(Indices{}))
+		{
+			return;
+		}
+
+		++m_index;
+	}
+}
+
+template <typename ...TComponents>
+Query<TComponents...>::Query(const Filter &filter, Storage<TComponents> &...storages)
+	: m_storages(&storages...)
+	, m_archetypes(nullptr)
+	, m_typeIds()
+	, m_filter(filter)
+	, m_driver(0)
+	, m_sizeHint(0)
+{
+	const sizet sizes[] = { storages.size()... };
+
+	m_sizeHint = sizes[0];
+	for (sizet i = 1; i < NUM_COMPONENTS; ++i)
+	{
+		if (sizes[i] < m_sizeHint)
+		{
+			m_sizeHint = sizes[i];
+			m_driver = i;
+		}
+	}
+
+	// Only the driver skips the whole blocks
+	if (m_filter.m_component != NO_FILTER)
+	{
+		m_driver = m_filter.m_component;
+	}
+}
+
+template <typename ...TComponents>
+Query<TComponents...>::Query(ArchetypeStorage &archetypes, const TypeIds &typeIds,
+	const Filter &filter)
+	: m_storages()
+	, m_archetypes(&archetypes)
+	, m_typeIds(typeIds)
+	, m_filter(filter)
+	, m_driver(0)
+	, m_sizeHint(0)
+{
+	Columns columns;
+	for (const auto &archetype : archetypes.getArchetypes())
+	{
+		if (_getColumns(*archetype, m_typeIds, columns))
+		{
+			m_sizeHint += archetype->size();
+		}
+	}
+}
+
+template <typename ...TComponents>
+template <typename TFunc>
+void Query<TComponents...>::each(TFunc &&func)
+{
+	if (m_archetypes)
+	{
+		_eachArchetype(func, Indices{});
+		return;
+	}
+
+	_dispatch(func, Indices{});
+}
+
+template <typename ...TComponents>
+typename Query<TComponents...>::iterator_type Query<TComponents...>::begin()
+{
+	if (m_archetypes)
+	{
+		return iterator_type(*m_archetypes, m_typeIds, m_filter, 0u);
+	}
+
+	return iterator_type(m_storages, _getDriver(Indices{}), m_filter, 0u);
+}
+
+template <typename ...TComponents>
+typename Query<TComponents...>::iterator_type Query<TComponents...>::end()
+{
+	if (m_archetypes)
+	{
+		return iterator_type(*m_archetypes, m_typeIds, m_filter, m_archetypes->getArchetypes().size());
+	}
+
+	const Driver driver = _getDriver(Indices{});
+	return iterator_type(m_storages, driver, m_filter, driver.m_size);
+}
+
+template <typename ...TComponents>
+template <typename T>
+constexpr sizet Query<TComponents...>::_getIndex()
+{
+	constexpr bool matches[] = { std::is_same_v<std::remove_const_t<TComponents>, std::remove_const_t<T>>... };
+
+	for (sizet i = 0; i < NUM_COMPONENTS; ++i)
+	{
+		if (matches[i])
+		{
+			return i;
+		}
+	}
+
+	return NO_FILTER;
+}
+
+template <typename ...TComponents>
+template <typename TFunc>
+void Query<TComponents...>::_invoke(TFunc &func, SlotGenerator::Slot slot,
+	TComponents &...components)
+{
+	if constexpr (std::is_invocable_v<TFunc&, Entity, TComponents&...>)
+	{
+		func(Entity(slot), components...);
+	}
+	else
+	{
+		AR_UNUSED(slot);
+		func(components...);
+	}
+}
+
+template <typename ...TComponents>
+bool Query<TComponents...>::_getColumns(const ArchetypeStorage::Archetype &archetype,
+	const TypeIds &typeIds, Columns &columns)
+{
+	for (sizet i = 0; i < NUM_COMPONENTS; ++i)
+	{
+		columns[i] = archetype.getColumnIndex(typeIds[i]);
+		if (columns[i] == ArchetypeStorage::INVALID_COLUMN)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename ...TComponents>
+template <sizet I>
+typename Query<TComponents...>::template TData<I>*
+Query<TComponents...>::_find(Storage<TData<I>> &storage, SlotGenerator::Slot slot)
+{
+	return const_cast<TData<I>*>(std::as_const(storage).find(slot));
+}
+
+template <typename ...TComponents>
+template <sizet I>
+void Query<TComponents...>::_markBlock(Storage<TData<I>> &storage, sizet block, const Filter &filter)
+{
+	if constexpr (!std::is_const_v<TData<I>>)
+	{
+		if (filter.m_component == I)
+		{
+			storage.markBlockChanged(block, filter.m_observed);
+		}
+		else
+		{
+			storage.markBlockChanged(block);
+		}
+	}
+	else
+	{
+		AR_UNUSED(storage);
+		AR_UNUSED(block);
+		AR_UNUSED(filter);
+	}
+}
+
+template <typename ...TComponents>
+template <sizet I>
+void Query<TComponents...>::_markElement(Storage<TData<I>> &storage, const TData<I> *component,
+	const Filter &filter)
+{
+	const sizet index = static_cast<sizet>(component - storage.getData());
+	_markBlock<I>(storage, index / Storage<TData<I>>::VERSION_BLOCK_SIZE, filter);
+}
+
+template <typename ...TComponents>
+template <sizet I>
+void Query<TComponents...>::_markColumn(ArchetypeStorage::Archetype &archetype, sizet chunk,
+	sizet column, const Filter &filter)
+{
+	if constexpr (!std::is_const_v<TData<I>>)
+	{
+		if (filter.m_component == I)
+		{
+			archetype.markChanged(chunk, column, filter.m_observed);
+		}
+		else
+		{
+			archetype.markChanged(chunk, column);
+		}
+	}
+	else
+	{
+		AR_UNUSED(archetype);
+		AR_UNUSED(chunk);
+		AR_UNUSED(column);
+		AR_UNUSED(filter);
+	}
+}
+
+template <typename ...TComponents>
+template <typename TFunc, sizet ...I>
+void Query<TComponents...>::_dispatch(TFunc &func, std::index_sequence<I...> indices)
+{
+	AR_UNUSED(((m_driver == I ? (_each<I>(func, indices), true) : false) || ...));
+}
+
+template <typename ...TComponents>
+template <sizet DRIVER, typename TFunc, sizet ...I>
+void Query<TComponents...>::_each(TFunc &func, std::index_sequence<I...>)
+{
+	const Driver driver = _makeDriver<DRIVER>(Indices{});
+	const Pointers &aligned = driver.m_aligned;
+
+	for (sizet first = 0, size = driver.m_size; first < size; first += VERSION_BLOCK_SIZE)
+	{
+		const sizet block = first / VERSION_BLOCK_SIZE;
+		if (driver.m_versions && driver.m_versions[block] <= m_filter.m_since)
+		{
+			continue;
+		}
+
+		bool firstInBlock = true;
+		for (sizet i = first, last = std::min(size, first + VERSION_BLOCK_SIZE); i < last; ++i)
+		{
+			const SlotGenerator::Slot slot = driver.m_slots[i];
+			const Pointers components(_fetch<I>(m_storages, aligned, i, slot)...);
+
+			if (!(std::get<I>(components) && ...))
+			{
+				continue;
+			}
+
+			(_markMatch<I>(aligned, components, block, firstInBlock), ...);
+			firstInBlock = false;
+
+			_invoke(func, slot, *std::get<I>(components)...);
+		}
+	}
+}
+
+template <typename ...TComponents>
+template <typename TFunc, sizet ...I>
+void Query<TComponents...>::_eachArchetype(TFunc &func, std::index_sequence<I...>)
+{
+	Columns columns;
+
+	for (const auto &archetype : m_archetypes->getArchetypes())
+	{
+		if (!_getColumns(*archetype, m_typeIds, columns))
+		{
+			continue;
+		}
+
+		for (sizet chunk = 0; chunk < archetype->getChunkCount(); ++chunk)
+		{
+			if (m_filter.m_component != NO_FILTER
+				&& archetype->getColumnVersion(chunk, columns[m_filter.m_component]) <= m_filter.m_since)
+			{
+				continue;
+			}
+
+			(_markColumn<I>(*archetype, chunk, columns[I], m_filter), ...);
+
+			const SlotGenerator::Slot *slots = archetype->getSlots(chunk);
+			const Pointers components(static_cast<TComponents*>(archetype->getColumn(chunk, columns[I]))...);
+
+			for (sizet row = 0, size = archetype->getChunkSize(chunk); row < size; ++row)
+			{
+				_invoke(func, slots[row], std::get<I>(components)[row]...);
+			}
+		}
+	}
+}
+
+template <typename ...TComponents>
+template <sizet DRIVER, sizet I>
+typename Query<TComponents...>::template TData<I>* Query<TComponents...>::_getAligned() const
+{
+	Storage<TData<I>> &storage = *std::get<I>(m_storages);
+
+	if constexpr (DRIVER == I)
+	{
+		return storage.getData();
+	}
+	else
+	{
+		return storage.sharesOrdering(*std::get<DRIVER>(m_storages)) ? storage.getData() : nullptr;
+	}
+}
+
+template <typename ...TComponents>
+template <sizet I>
+void Query<TComponents...>::_markMatch(const Pointers &aligned, const Pointers &components,
+	sizet block, bool firstInBlock) const
+{
+	if (!std::get<I>(aligned))
+	{
+		_markElement<I>(*std::get<I>(m_storages), std::get<I>(components), m_filter);
+	}
+	else if (firstInBlock)
+	{
+		_markBlock<I>(*std::get<I>(m_storages), block, m_filter);
+	}
+}
+
+template <typename ...TComponents>
+template <sizet I>
+typename Query<TComponents...>::template TData<I>*
+Query<TComponents...>::_fetch(const Storages &storages, const Pointers &aligned, sizet index,
+	SlotGenerator::Slot slot)
+{
+	if (TData<I> *data = std::get<I>(aligned))
+	{
+		return data + index;
+	}
+
+	return _find<I>(*std::get<I>(storages), slot);
+}
+
+template <typename ...TComponents>
+template <sizet DRIVER, sizet ...I>
+typename Query<TComponents...>::Driver Query<TComponents...>::_makeDriver(std::index_sequence<I...>) const
+{
+	const Storage<TData<DRIVER>> &driver = *std::get<DRIVER>(m_storages);
+
+	return Driver{driver.getSlots(),
+		m_filter.m_component != NO_FILTER ? driver.getBlockVersions() : nullptr,
+		driver.size(),
+		Pointers(_getAligned<DRIVER, I>()...)};
+}
+
+template <typename ...TComponents>
+template <sizet ...I>
+typename Query<TComponents...>::Driver Query<TComponents...>::_getDriver(std::index_sequence<I...>) const
+{
+	Driver result{nullptr, nullptr, 0u, Pointers()};
+	AR_UNUSED(((m_driver == I ? (result = _makeDriver<I>(Indices{}), true) : false) || ...));
+	return result;
+}
+} // namespace argon
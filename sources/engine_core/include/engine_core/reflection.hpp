@@ -7,6 +7,7 @@
 #include <rttr/registration.h>
 
 #include <data_structures/sparse_storage.hpp>
+#include <data_structures/standard_containers.hpp>
 
 #include <fundamental/compiler_macros.hpp>
 #include <fundamental/debug.hpp>
@@ -57,17 +58,47 @@ enum class ClassType : uint32
 
 enum class ComponentMeta : uint32
 {
-	Type = 0
+	Type = 0,
+	Storage,
+	Functions
 };
 
 enum class ServiceMeta : uint32
 {
-	Type = 0
+	Type = 0,
+	Functions,
+	// Dense index into the service table
+	Id
 };
 
 enum class SystemMeta : uint32
 {
-	Type = 0
+	Type = 0,
+	Reads,
+	Writes,
+	Functions
+};
+
+// Type erased entry points, the per frame paths call them directly instead of rttr::method::invoke.
+// object is the pointer created by the registered constructor.
+struct ComponentFunctions
+{
+	// Erases the component of the slot from SparseStorage, does nothing if it is not assigned
+	void (*m_remove)(void *storage, SlotGenerator::Slot slot);
+	// Runs a step of SparseStorage::compact
+	bool (*m_compact)(void *storage, sizet budget);
+};
+
+struct ServiceFunctions
+{
+	void (*m_tick)(void *object);
+};
+
+struct SystemFunctions
+{
+	void (*m_initialize)(void *object);
+	void (*m_finalize)(void *object);
+	void (*m_tick)(void *object);
 };
 
 template <typename T>
@@ -86,12 +117,30 @@ public:
 	Service(const char *name);
 };
 
+// Value of SystemMeta::Reads and SystemMeta::Writes
+struct AccessList
+{
+	vector<rttr::type> m_types;
+};
+
+// Systems which declare their access are scheduled concurrently with the non conflicting ones.
+// Systems without any declaration are exclusive, they run alone on the main thread.
 template <typename T>
 class System final
 	: detail::Object<T>
 {
 public:
 	System(const char *name);
+
+	// Components and services the system only reads
+	template <typename ...TTypes>
+	System& reads();
+	// Components and services the system modifies, write access implies read access
+	template <typename ...TTypes>
+	System& writes();
+
+private:
+	void _declare(SystemMeta access, vector<rttr::type> &&types);
 };
 
 template <typename T>
@@ -104,10 +153,24 @@ Component<T>::Component(const char *name)
 	this->m_class->template constructor<>()
 		(rttr::policy::ctor::as_raw_ptr)
 		(rttr::metadata(ComponentMeta::Type, ClassType::Component));
+	(*this->m_class)(rttr::metadata(ComponentMeta::Storage, rttr::type::get<SparseStorage<T>>()));
+	(*this->m_class)(rttr::metadata(ComponentMeta::Functions, ComponentFunctions{
+		[](void *storage, SlotGenerator::Slot slot)
+		{
+			auto &components = *static_cast<SparseStorage<T>*>(storage);
+			if (components.has(slot))
+			{
+				components.erase(slot);
+			}
+		},
+		[](void *storage, sizet budget)
+		{
+			return static_cast<SparseStorage<T>*>(storage)->compact(budget);
+		}}));
 	rttr::registration::class_<SparseStorage<T>>(std::string(name) + "storage")
 		.template constructor<>()
-		(rttr::policy::ctor::as_object);
-	debug::statusMsg("Component ", name, " registered");
+		(rttr::policy::ctor::as_raw_ptr);
+	AR_LOG_STATUS("Component ", name, " registered");
 }
 
 template <typename T>
@@ -122,7 +185,10 @@ Service<T>::Service(const char *name)
 		(rttr::policy::ctor::as_raw_ptr)
 		(rttr::metadata(ServiceMeta::Type, ClassType::Service))
 		.method("tick", &T::tick);
-	debug::statusMsg("Service ", name, " registered");
+	(*this->m_class)(rttr::metadata(ServiceMeta::Functions, ServiceFunctions{
+		[](void *object) { static_cast<T*>(object)->tick(); }}));
+	(*this->m_class)(rttr::metadata(ServiceMeta::Id, ::argon::detail::acquireServiceId()));
+	AR_LOG_STATUS("Service ", name, " registered");
 }
 
 template <typename T>
@@ -138,6 +204,33 @@ System<T>::System(const char *name)
 		.method("initialize", &T::initialize)
 		.method("finalize", &T::finalize)
 		.method("tick", &T::tick);
-	debug::statusMsg("System ", name, " registered");
+	(*this->m_class)(rttr::metadata(SystemMeta::Functions, SystemFunctions{
+		[](void *object) { static_cast<T*>(object)->initialize(); },
+		[](void *object) { static_cast<T*>(object)->finalize(); },
+		[](void *object) { static_cast<T*>(object)->tick(); }}));
+	AR_LOG_STATUS("System ", name, " registered");
+}
+
+template <typename T>
+template <typename ...TTypes>
+System<T>& System<T>::reads()
+{
+	_declare(SystemMeta::Reads, {rttr::type::get<TTypes>()...});
+	return *this;
+}
+
+template <typename T>
+template <typename ...TTypes>
+System<T>& System<T>::writes()
+{
+	_declare(SystemMeta::Writes, {rttr::type::get<TTypes>()...});
+	return *this;
+}
+
+template <typename T>
+void System<T>::_declare(SystemMeta access, vector<rttr::type> &&types)
+{
+	AR_CRITICAL(!rttr::type::get<T>().get_metadata(access).is_valid(), "Access is already declared");
+	(*this->m_class)(rttr::metadata(access, AccessList{std::move(types)}));
 }
 } // namespace argon::reflection
@@ -1,14 +1,49 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 
 #include <rttr/type.h>
 
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
 #include <fundamental/helper_macros.hpp>
 #include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
 
 namespace argon
 {
+class ServiceBase;
+
+namespace detail
+{
+inline constexpr uint32 INVALID_SERVICE_ID = std::numeric_limits<uint32>::max();
+inline constexpr uint32 MAX_SERVICES = 256u;
+
+// Services are stored in a flat table indexed by the dense id assigned at the registration
+using ServiceTable = ServiceBase* const*;
+
+AR_SYM_EXPORT uint32 acquireServiceId();
+AR_SYM_EXPORT uint32 getServiceId(const rttr::type &type);
+
+template <typename T>
+uint32 getServiceId()
+{
+	// Resolved once per type in every shared library
+	static const uint32 s_id = getServiceId(rttr::type::get<T>());
+	return s_id;
+}
+
+template <typename T>
+T& getService(ServiceTable table)
+{
+	const uint32 id = getServiceId<T>();
+	AR_ASSERT_MSG(id < MAX_SERVICES && table[id], "Service cannot be located");
+
+	return static_cast<T&>(*table[id]);
+}
+} // namespace detail
+
 class AR_SYM_EXPORT ServiceBase
 	: NonCopyable
 {
@@ -29,12 +64,12 @@ public:
 private:
 	friend class Engine; // TODO remove this
 
-	ServiceBase& _get(const rttr::type &type);
+	detail::ServiceTable m_services;
 };
 
 template <typename T>
 T& ServiceBase::get()
 {
-	return static_cast<T&>(_get(rttr::type::get<T>()));
+	return detail::getService<T>(m_services);
 }
 } // namespace argon
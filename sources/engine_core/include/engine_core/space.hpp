@@ -4,6 +4,7 @@
 
 #include <fundamental/non_copyable.hpp>
 
+#include "entity_manager.hpp"
 #include "forward_declarations.hpp"
 
 namespace argon
@@ -12,7 +13,8 @@ class Space final
 	: NonCopyable
 {
 public:
-	Space(privateimpl::ServiceManager &serviceManager);
+	Space(privateimpl::ServiceManager &serviceManager,
+		ComponentStorageType storageType = ComponentStorageType::Sparse);
 	~Space();
 
 	void tick();
@@ -8,6 +8,7 @@
 #include <fundamental/non_copyable.hpp>
 
 #include "forward_declarations.hpp"
+#include "service.hpp"
 
 namespace argon
 {
@@ -28,15 +29,17 @@ public:
 	template <typename T>
 	T& get();
 
+	EntityManager& getEntityManager();
+
 private:
 	friend class SystemManager; // TODO REMOVE THIS
 
-	ServiceBase& _get(const rttr::type &type);
+	detail::ServiceTable m_services;
 };
 
 template <typename T>
 T& SystemBase::get()
 {
-	return static_cast<T&>(_get(rttr::type::get<T>()));
+	return detail::getService<T>(m_services);
 }
 } // namespace argon
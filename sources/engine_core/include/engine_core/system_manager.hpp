@@ -1,6 +1,7 @@
 #pragma once
 
 #include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
 
 #include "forward_declarations.hpp"
 
@@ -10,13 +11,23 @@ class SystemManager
 	: NonCopyable
 {
 public:
-	SystemManager(privateimpl::ServiceManager &serviceManager);
+	SystemManager(privateimpl::ServiceManager &serviceManager, EntityManager &entityManager);
 	~SystemManager();
 
 	void tick();
 
 private:
+	void _createSystems();
+	void _buildSchedule();
+
+	void _runPhase(uint32 begin, uint32 end);
+	void _runSystem(uint32 system);
+	static void _systemJob(void *manager, sizet system, sizet);
+
 	privateimpl::ServiceManager &m_serviceManager;
+	EntityManager &m_entityManager;
+	JobSystem &m_jobSystem;
+	Profiler &m_profiler;
 	privateimpl::SystemManagerData &m_data;
 };
 } // namespace argon
@@ -6,20 +6,50 @@
 #include <fundamental/helper_macros.hpp>
 #include <fundamental/types.hpp>
 
+#include "service.hpp"
+
 namespace argon
 {
+// Frame clock of the engine. endFrame waits for the deadline of the target rate, it sleeps while
+// the deadline is far away and spins for the rest, so the frames start within microseconds of it.
 class AR_SYM_EXPORT Time final
+	: public ServiceBase
 {
 public:
-	Time();
+	inline static constexpr float64 DEFAULT_FRAME_RATE = 500.0;
+	inline static constexpr float64 DEFAULT_FIXED_STEP_RATE = 120.0;
+	// Steps are dropped above this, a slow frame cannot cause an ever growing number of steps
+	inline static constexpr uint32 MAX_FIXED_STEPS = 8u;
+
+	Time(ConstructionData &&data);
 	~Time();
 
+	void tick();
+
+	// Seconds of the last frame
 	float32 getDelta() const;
 	float32 getUnscaledDelta() const;
+	uint64 getUnscaledDeltaNs() const;
 
 	void setDeltaScale(float32 val);
 	float32 getDeltaScale() const;
 
+	// Frames per second, zero does not limit the rate
+	void setTargetFrameRate(float64 rate);
+	float64 getTargetFrameRate() const;
+
+	// The fixed steps are counted from the scaled time
+	void setFixedStepRate(float64 rate);
+	float64 getFixedStepRate() const;
+	// Seconds of a fixed step
+	float32 getFixedDelta() const;
+	// Number of the fixed steps accumulated since the last call, should be called once per frame
+	uint32 consumeFixedSteps();
+	// Accumulated fraction of the next step, to interpolate between the last two steps
+	float32 getFixedStepAlpha() const;
+
+	// Starts the first frame, the time before it is not counted
+	void restart();
 	void endFrame();
 
 private:
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <limits>
+#include <utility>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/helper_macros.hpp>
+#include <fundamental/types.hpp>
+
+#include <math/matrix4.hpp>
+#include <math/quaternion.hpp>
+#include <math/vector3.hpp>
+
+#include "entity.hpp"
+#include "query.hpp"
+#include "system.hpp"
+
+namespace argon
+{
+// Placement of the entity relative to its parent. Entities without a parent, or with a parent
+// which has no Transform, are placed in the world.
+struct Transform
+{
+	Transform()
+		: m_rotation(1.f, 0.f, 0.f, 0.f)
+		, m_scaling(1.f, 1.f, 1.f)
+		, m_translation(0.f, 0.f, 0.f)
+		, m_parent()
+	{
+	}
+
+	math::Quaternion m_rotation;
+	math::Vector3 m_scaling;
+	math::Vector3 m_translation;
+	Entity m_parent;
+	AR_PAD(8);
+};
+
+// Written by TransformSystem, the entity gets it with the first update of its Transform
+struct WorldTransform
+{
+	WorldTransform()
+		: m_matrix(math::Matrix4::c_identity)
+	{
+	}
+
+	explicit WorldTransform(const math::Matrix4 &matrix)
+		: m_matrix(matrix)
+	{
+	}
+
+	math::Matrix4 m_matrix;
+};
+
+// Computes WorldTransform of every entity with a Transform. The hierarchy is kept in flat arrays
+// sorted by the depth, so the nodes of a level depend only on the previous levels and are computed
+// in parallel batches. Only the subtrees below the changed transforms are recomputed, the arrays
+// are rebuilt when an entity gets or loses its Transform or changes its parent. A cycle of parents
+// is reported and one of its entities is placed in the world.
+class AR_SYM_EXPORT TransformSystem final
+	: public SystemBase
+{
+public:
+	TransformSystem(ConstructionData &&data);
+	~TransformSystem();
+
+	void initialize();
+	void finalize();
+	void tick();
+
+private:
+	inline static constexpr uint32 INVALID_NODE = std::numeric_limits<uint32>::max();
+
+	// Collects all transforms, every node gets updated
+	void _rebuild();
+	uint32 _findNode(const Entity &e) const;
+	// Marks the updated nodes and their subtrees dirty
+	void _updateLocals();
+	void _updateWorlds();
+	void _writeWorlds();
+
+	Changed<Transform> m_changed;
+	// Nodes sorted by the depth, parents always precede their children
+	vector<Entity> m_entities;
+	vector<Entity> m_parentEntities;
+	vector<uint32> m_parents;
+	vector<math::Matrix4> m_locals;
+	vector<math::Matrix4> m_worlds;
+	// First node of every level, the last entry is the number of nodes
+	vector<uint32> m_levels;
+	// Entity index -> node
+	vector<uint32> m_nodes;
+	// Per tick data
+	vector<std::pair<uint32, const Transform*>> m_updates;
+	vector<uint8> m_dirty;
+	vector<uint32> m_dirtyNodes;
+};
+} // namespace argon
@@ -7,12 +7,14 @@ namespace argon
 class SystemBase::SystemBasePrivate final
 {
 public:
-	SystemBasePrivate(privateimpl::ServiceManager &serviceManager)
+	SystemBasePrivate(privateimpl::ServiceManager &serviceManager, EntityManager &entityManager)
 		: m_serviceManager(serviceManager)
+		, m_entityManager(entityManager)
 	{
 	}
 
 	privateimpl::ServiceManager &m_serviceManager;
+	EntityManager &m_entityManager;
 };
 
 class ServiceBase::ServiceBasePrivate final
@@ -1,26 +1,53 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <utility>
+
 #include <rttr/registration>
 
+#include <data_structures/archetype_storage.hpp>
+#include <data_structures/concurrent_slot_generator.hpp>
+#include <data_structures/flat_hash_map.hpp>
 #include <data_structures/sparse_storage.hpp>
 #include <data_structures/standard_containers.hpp>
 
 #include <fundamental/debug.hpp>
 
+#include "entity_command_buffer.hpp"
 #include "forward_declarations.hpp"
+#include "reflection.hpp"
 #include "service.hpp"
 
 namespace argon::privateimpl
 {
 struct EntityManagerData final
 {
-	SlotGenerator m_slotGenerator;
-	unordered_map<rttr::type, rttr::variant> m_storages;
+	~EntityManagerData()
+	{
+		for (auto &storage : m_storages)
+		{
+			storage.second.get_type().destroy(storage.second);
+		}
+	}
+
+	ConcurrentSlotGenerator m_slotGenerator;
+	// component type -> SparseStorage<Component>*
+	flat_hash_map<rttr::type, rttr::variant> m_storages;
+	// Type erased view of m_storages for the operations on all components of an entity
+	vector<std::pair<void*, reflection::ComponentFunctions>> m_storageFunctions;
+	ArchetypeStorage m_archetypes;
+
+	// Buffers return their cached slots to the generator, so they are destroyed first
+	std::mutex m_commandBuffersMutex;
+	vector<std::unique_ptr<EntityCommandBuffer>> m_commandBuffers;
+	// Unique among all managers ever created, identifies the manager in the thread local caches
+	uint64 m_id = 0;
 };
 
 // Used as an interface between EntityManagers and hot-reloading functionality
 class EntityManagerDataProvider final
-	: ServiceBase
+	: public ServiceBase
 {
 public:
 	EntityManagerDataProvider(ConstructionData &&data)
@@ -36,14 +63,15 @@ public:
 private:
 	friend class PluginManager;
 
-	unordered_map<EntityManager*, EntityManagerData> m_data;
+	// Held by the managers, so the data must not move
+	flat_hash_map<EntityManager*, std::unique_ptr<EntityManagerData>> m_data;
 };
 
 inline EntityManagerData& EntityManagerDataProvider::acquire(EntityManager *manager)
 {
 	AR_ASSERT_MSG(m_data.find(manager) == m_data.end(),
 		"EntityManagerDataProvider::release :: Data was already acquired");
-	return m_data[manager];
+	return *(m_data[manager] = std::make_unique<EntityManagerData>());
 }
 
 inline void EntityManagerDataProvider::release(EntityManager *manager)
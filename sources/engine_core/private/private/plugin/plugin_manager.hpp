@@ -3,7 +3,7 @@
 #include <memory>
 #include <string>
 
-#include <data_structures/standard_containers.hpp>
+#include <data_structures/flat_hash_map.hpp>
 
 #include <fundamental/non_copyable.hpp>
 
@@ -28,6 +28,6 @@ public:
 
 private:
 	ServiceManager &m_serviceManager;
-	unordered_map<std::string, std::unique_ptr<rttr::library>> m_plugins;
+	flat_hash_map<std::string, std::unique_ptr<rttr::library>> m_plugins;
 };
 } // namespace argon::privateimpl
@@ -2,12 +2,17 @@
 
 #include <rttr/registration.h>
 
+#include <data_structures/flat_hash_map.hpp>
 #include <data_structures/standard_containers.hpp>
 
 #include <fundamental/debug.hpp>
 #include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
 
 #include "engine.hpp"
+#include "profiler.hpp"
+#include "reflection.hpp"
+#include "service.hpp"
 
 namespace argon::privateimpl
 {
@@ -17,8 +22,15 @@ class ServiceData
 public:
 	ServiceData(const rttr::type &type, rttr::variant &&object)
 		: m_object(std::move(object))
-		, m_tick(type.get_method("tick"))
+		, m_instance(m_object.is_valid() ? m_object.get_value<void*>() : nullptr)
+		, m_name(type.get_name().data())
+		, m_functions{nullptr}
 	{
+		const rttr::variant functions = type.get_metadata(reflection::ServiceMeta::Functions);
+		if (functions.is_valid())
+		{
+			m_functions = functions.get_value<reflection::ServiceFunctions>();
+		}
 	}
 
 	ServiceData(ServiceData &&) = default;
@@ -30,49 +42,78 @@ public:
 
 	bool isValid() const
 	{
-		return m_tick.is_valid();
+		return m_instance && m_functions.m_tick;
 	}
 
-	void tick()
+	void tick(Profiler &profiler)
 	{
-		m_tick.invoke(m_object);
+		const ProfileZone zone(profiler, m_name);
+		m_functions.m_tick(m_instance);
 	}
 
 private:
 	friend class ServiceManager;
 
 	rttr::variant m_object;
-	const rttr::method m_tick;
+	void *m_instance;
+	// Owned by the registered type, the name of the profiler zone
+	const char *m_name;
+	reflection::ServiceFunctions m_functions;
 };
 
 class ServiceManager final
 	: NonCopyable
 {
 public:
-	ServiceManager() = default;
+	ServiceManager()
+		: m_table{}
+	{
+	}
 
 	template <typename T>
 	T& get()
 	{
 		static_assert(!std::is_pointer_v<T>, "Pointer type is not accepted");
-		AR_CRITICAL(m_services.find(rttr::type::get<T>()) != m_services.end(),
-			"Service cannot be located");
-		
-		return *m_services.at(rttr::type::get<T>()).m_object.template get_value<T*>();
+		return detail::getService<T>(getTable());
 	}
 
 	ServiceBase& get(const rttr::type &type)
 	{
-		AR_CRITICAL(m_services.find(type) != m_services.end(),
-			"Service cannot be located");
-		
-		return *m_services.at(type).m_object.template get_value<ServiceBase*>();
+		const uint32 id = detail::getServiceId(type);
+		AR_CRITICAL(id < detail::MAX_SERVICES && m_table[id], "Service cannot be located");
+
+		return *m_table[id];
+	}
+
+	detail::ServiceTable getTable() const
+	{
+		return m_table.data();
+	}
+
+	void tick()
+	{
+		Profiler &profiler = get<Profiler>();
+
+		for (auto &[type, service] : m_services)
+		{
+			service.tick(profiler);
+		}
 	}
 
 private:
 	friend class argon::Engine;
 	friend class PluginManager;
 
-	unordered_map<rttr::type, ServiceData> m_services;
+	void _add(const rttr::type &type, ServiceData &&data)
+	{
+		const uint32 id = detail::getServiceId(type);
+		AR_CRITICAL(id < detail::MAX_SERVICES && !m_table[id], "Service id is not valid");
+
+		m_table[id] = data.m_object.template get_value<ServiceBase*>();
+		m_services.emplace(type, std::move(data));
+	}
+
+	flat_hash_map<rttr::type, ServiceData> m_services;
+	array<ServiceBase*, detail::MAX_SERVICES> m_table;
 };
 } // namespace privateimpl
@@ -1,12 +1,24 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+
 #include <rttr/registration.h>
 
+#include <data_structures/flat_hash_map.hpp>
 #include <data_structures/standard_containers.hpp>
 
 #include <fundamental/debug.hpp>
+#include <fundamental/helper_macros.hpp>
 #include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
 
+#include "entity_manager.hpp"
+#include "job_system.hpp"
+#include "profiler.hpp"
+#include "reflection.hpp"
 #include "service.hpp"
 #include "system.hpp"
 #include "system_manager.hpp"
@@ -19,10 +31,31 @@ class SystemData final
 public:
 	SystemData(const rttr::type &type, rttr::variant &&object)
 		: m_object(std::move(object))
-		, m_tick(type.get_method("tick"))
-		, m_init(type.get_method("initialize"))
-		, m_fini(type.get_method("finalize"))
+		, m_instance(m_object.is_valid() ? m_object.get_value<void*>() : nullptr)
+		, m_name(type.get_name().data())
+		, m_functions{nullptr, nullptr, nullptr}
+		, m_exclusive(true)
 	{
+		const rttr::variant functions = type.get_metadata(reflection::SystemMeta::Functions);
+		if (functions.is_valid())
+		{
+			m_functions = functions.get_value<reflection::SystemFunctions>();
+		}
+
+		const rttr::variant reads = type.get_metadata(reflection::SystemMeta::Reads);
+		const rttr::variant writes = type.get_metadata(reflection::SystemMeta::Writes);
+
+		if (reads.is_valid())
+		{
+			m_reads = reads.get_value<reflection::AccessList>().m_types;
+			m_exclusive = false;
+		}
+
+		if (writes.is_valid())
+		{
+			m_writes = writes.get_value<reflection::AccessList>().m_types;
+			m_exclusive = false;
+		}
 	}
 
 	SystemData(SystemData &&) = default;
@@ -35,36 +68,107 @@ public:
 
 	bool isValid() const
 	{
-		return m_object.is_valid() && m_tick.is_valid() && m_init.is_valid()
-			&& m_fini.is_valid();
+		return m_object.is_valid() && m_instance && m_functions.m_tick && m_functions.m_initialize
+			&& m_functions.m_finalize;
 	}
 
 	void init()
 	{
-		m_init.invoke(m_object);
+		m_functions.m_initialize(m_instance);
 	}
 
 	void fini()
 	{
-		m_fini.invoke(m_object);
+		m_functions.m_finalize(m_instance);
+	}
+
+	void tick(Profiler &profiler)
+	{
+		const ProfileZone zone(profiler, m_name);
+		// A waiting system may run another one on its thread, see JobSystem::wait
+		const SystemData *previous = EntityManager::_setRunningSystem(this);
+		m_functions.m_tick(m_instance);
+		EntityManager::_setRunningSystem(previous);
+	}
+
+	// The system did not declare its access, so it cannot run alongside any other system
+	bool isExclusive() const
+	{
+		return m_exclusive;
+	}
+
+	bool conflictsWith(const SystemData &other) const
+	{
+		if (m_exclusive || other.m_exclusive)
+		{
+			return true;
+		}
+
+		const auto intersects = [](const vector<rttr::type> &lhs, const vector<rttr::type> &rhs)
+		{
+			for (const auto &type : lhs)
+			{
+				if (std::find(rhs.begin(), rhs.end(), type) != rhs.end())
+				{
+					return true;
+				}
+			}
+
+			return false;
+		};
+
+		return intersects(m_writes, other.m_writes) || intersects(m_writes, other.m_reads)
+			|| intersects(m_reads, other.m_writes);
 	}
 
-	void tick()
+	const vector<rttr::type>& getReads() const
 	{
-		m_tick.invoke(m_object);
+		return m_reads;
+	}
+
+	const vector<rttr::type>& getWrites() const
+	{
+		return m_writes;
 	}
 
 private:
 	rttr::variant m_object;
-	const rttr::method m_tick;
-	const rttr::method m_init;
-	const rttr::method m_fini;
+	void *m_instance;
+	// Owned by the registered type, the name of the profiler zone
+	const char *m_name;
+	reflection::SystemFunctions m_functions;
+	vector<rttr::type> m_reads;
+	vector<rttr::type> m_writes;
+	bool m_exclusive;
+	AR_PAD(7);
+};
+
+// Systems are split into phases by the exclusive systems. Inside of a phase the systems form
+// a DAG, an edge goes from an earlier system to a later one whenever their accesses conflict.
+struct SystemSchedule final
+	: NonCopyable
+{
+	struct Phase
+	{
+		// [m_begin, m_end) range of the systems
+		uint32 m_begin;
+		uint32 m_end;
+	};
+
+	vector<Phase> m_phases;
+	vector<vector<uint32>> m_successors;
+	vector<uint32> m_numDependencies;
+	std::unique_ptr<std::atomic<uint32>[]> m_pendingDependencies;
+	// Jobs of the running phase
+	JobCounter m_counter;
 };
 
 struct SystemManagerData final
 	: NonCopyable
 {
-	unordered_map<rttr::type, SystemData> m_systems;
+	// In the order of the discovery
+	vector<SystemData> m_systems;
+	SystemSchedule m_schedule;
 };
 
 // used as an interface between system manager and hot-reloading functionality
@@ -80,7 +184,8 @@ public:
 	void tick() {}
 
 private:
-	unordered_map<SystemManager*, SystemManagerData> m_data;
+	// Held by the managers, so the data must not move
+	flat_hash_map<SystemManager*, std::unique_ptr<SystemManagerData>> m_data;
 };
 
 inline SystemManagerDataProvider::SystemManagerDataProvider(ConstructionData &&data)
@@ -92,7 +197,7 @@ inline SystemManagerData& SystemManagerDataProvider::acquire(SystemManager &mana
 {
 	AR_ASSERT_MSG(m_data.find(&manager) == m_data.end(),
 		"SystemManagerDataProvider::acquire :: data is already acquired");
-	return m_data[&manager];
+	return *(m_data[&manager] = std::make_unique<SystemManagerData>());
 }
 
 inline void SystemManagerDataProvider::release(SystemManager &manager)
@@ -1,11 +1,14 @@
 #include <fundamental/debug.hpp>
 
+#include <memory/linear_arena.hpp>
+
 #include "private/construction_data_impl.hpp"
 #include "private/plugin/plugin_manager.hpp"
 #include "private/service_manager.hpp"
 #include "engine.hpp"
 #include "engine_state.hpp"
 #include "filesystem.hpp"
+#include "profiler.hpp"
 #include "reflection.hpp"
 #include "service.hpp"
 #include "space.hpp"
@@ -32,11 +35,22 @@ Engine::~Engine()
 
 void Engine::exec()
 {
-	Time timer;
+	Profiler &profiler = m_serviceManager->get<Profiler>();
+	Time &time = m_serviceManager->get<Time>();
+
+	time.restart();
 
 	while (!m_serviceManager->get<EngineState>().isShutingdown())
 	{
-		m_space->tick();
+		{
+			const ProfileZone zone(profiler, "Frame");
+			m_serviceManager->tick();
+			m_space->tick();
+		}
+
+		time.endFrame();
+		profiler.endFrame();
+		memory::resetFrameArenas();
 	}
 }
 
@@ -58,7 +72,9 @@ void Engine::_initCoreServices()
 				std::make_unique<ServiceBase::ServiceBasePrivate>(*m_serviceManager)});
 
 			privateimpl::ServiceData data(type, std::move(var));
-			m_serviceManager->m_services.emplace(type, std::move(data));
+			AR_CRITICAL(data.isValid(), "ServiceData is not valid");
+
+			m_serviceManager->_add(type, std::move(data));
 		}
 	}
 
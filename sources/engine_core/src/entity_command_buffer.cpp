@@ -0,0 +1,39 @@
+#include <fundamental/debug.hpp>
+
+#include "entity_command_buffer.hpp"
+
+namespace argon
+{
+EntityCommandBuffer::EntityCommandBuffer(EntityManager &manager)
+	: m_manager(manager)
+	, m_cache(manager.createEntityCache())
+{
+}
+
+EntityCommandBuffer::~EntityCommandBuffer() = default;
+
+Entity EntityCommandBuffer::createEntity()
+{
+	return m_manager.createEntity(m_cache);
+}
+
+void EntityCommandBuffer::destroyEntity(const Entity &e)
+{
+	AR_CRITICAL(m_manager.isValid(e), "Entity is not valid");
+
+	m_destroyed.push_back(e.m_slot);
+}
+
+bool EntityCommandBuffer::isEmpty() const
+{
+	for (const auto &commands : m_components)
+	{
+		if (!commands.second.m_commands.empty())
+		{
+			return false;
+		}
+	}
+
+	return m_destroyed.empty();
+}
+} // namespace argon
@@ -1,16 +1,33 @@
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
 #include <data_structures/sparse_storage.hpp>
 
+#include <memory/containers.hpp>
+
 #include "private/entity_manager_data_provider.hpp"
 #include "private/service_manager.hpp"
+#include "private/system_manager_data_provider.hpp"
+#include "entity_command_buffer.hpp"
 #include "entity_manager.hpp"
 #include "reflection.hpp"
 
 namespace argon
 {
-EntityManager::EntityManager(privateimpl::ServiceManager &serviceManager)
+namespace
+{
+std::atomic<uint64> s_nextManagerId(1u);
+thread_local const privateimpl::SystemData *s_runningSystem = nullptr;
+} // namespace
+
+EntityManager::EntityManager(privateimpl::ServiceManager &serviceManager,
+	ComponentStorageType storageType)
 	: m_serviceManager(serviceManager)
 	, m_impl(m_serviceManager.get<privateimpl::EntityManagerDataProvider>().acquire(this))
+	, m_storageType(storageType)
 {
+	m_impl.m_id = s_nextManagerId.fetch_add(1u, std::memory_order_relaxed);
 }
 
 EntityManager::~EntityManager()
@@ -23,8 +40,201 @@ Entity EntityManager::createEntity()
 	return Entity(m_impl.m_slotGenerator.acquire());
 }
 
+Entity EntityManager::createEntity(EntityCache &cache)
+{
+	return Entity(m_impl.m_slotGenerator.acquire(cache));
+}
+
+EntityManager::EntityCache EntityManager::createEntityCache()
+{
+	return EntityCache(m_impl.m_slotGenerator);
+}
+
 bool EntityManager::isValid(const Entity& e) const
 {
 	return m_impl.m_slotGenerator.isValid(e.m_slot);
 }
+
+void EntityManager::destroyEntity(const Entity &e)
+{
+	AR_CRITICAL(isValid(e), "Entity is not valid");
+#ifndef NDEBUG
+	_checkStructuralChange();
+#endif // ifndef NDEBUG
+
+	_destroyEntities(&e.m_slot, 1u);
+}
+
+EntityCommandBuffer& EntityManager::getCommandBuffer()
+{
+	// Manager id -> buffer of the thread, ids are never reused, so the stale entries never match
+	thread_local vector<std::pair<uint64, EntityCommandBuffer*>> s_buffers;
+
+	for (const auto &[manager, buffer] : s_buffers)
+	{
+		if (manager == m_impl.m_id)
+		{
+			return *buffer;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(m_impl.m_commandBuffersMutex);
+	m_impl.m_commandBuffers.push_back(std::make_unique<EntityCommandBuffer>(*this));
+	s_buffers.emplace_back(m_impl.m_id, m_impl.m_commandBuffers.back().get());
+
+	return *s_buffers.back().second;
+}
+
+rttr::variant& EntityManager::_getStorage(const rttr::type &type)
+{
+	auto storage = m_impl.m_storages.find(type);
+	if (storage == m_impl.m_storages.end())
+	{
+		const rttr::variant storageType = type.get_metadata(reflection::ComponentMeta::Storage);
+		AR_CRITICAL(storageType.is_valid(), "Component is not registered");
+
+		rttr::variant object = storageType.get_value<rttr::type>().create();
+		AR_CRITICAL(object.is_valid(), "Component storage cannot be created");
+
+		const rttr::variant functions = type.get_metadata(reflection::ComponentMeta::Functions);
+		m_impl.m_storageFunctions.emplace_back(object.get_value<void*>(),
+			functions.get_value<reflection::ComponentFunctions>());
+
+		storage = m_impl.m_storages.emplace(type, std::move(object)).first;
+	}
+
+	return storage->second;
+}
+
+const rttr::variant* EntityManager::_findStorage(const rttr::type &type) const
+{
+	const auto storage = m_impl.m_storages.find(type);
+	return storage != m_impl.m_storages.end() ? &storage->second : nullptr;
+}
+
+void EntityManager::_prepareStorage(const rttr::type &type)
+{
+	if (m_storageType == ComponentStorageType::Sparse
+		&& type.get_metadata(reflection::ComponentMeta::Storage).is_valid())
+	{
+		_getStorage(type);
+	}
+}
+
+const privateimpl::SystemData* EntityManager::_setRunningSystem(const privateimpl::SystemData *system)
+{
+	return std::exchange(s_runningSystem, system);
+}
+
+void EntityManager::_checkAccess(const rttr::type &type, bool write)
+{
+	const privateimpl::SystemData *system = s_runningSystem;
+	if (!system || system->isExclusive())
+	{
+		return;
+	}
+
+	const auto declares = [&type](const vector<rttr::type> &types)
+	{
+		return std::find(types.begin(), types.end(), type) != types.end();
+	};
+
+	// Undeclared accesses race with the systems scheduled alongside
+	const bool declared = declares(system->getWrites()) || (!write && declares(system->getReads()));
+	AR_CRITICAL(declared, "System accesses a component it did not declare");
+	AR_UNUSED(declared);
+}
+
+void EntityManager::_checkStructuralChange()
+{
+	// The storages are changed in place while the systems scheduled alongside iterate them
+	const privateimpl::SystemData *system = s_runningSystem;
+	AR_CRITICAL(!system || system->isExclusive(),
+		"Non-exclusive systems add and remove components and entities through getCommandBuffer()");
+	AR_UNUSED(system);
+}
+
+void EntityManager::_destroyEntities(const SlotGenerator::Slot *slots, sizet count)
+{
+	// Storage by storage, so each of them is touched once
+	if (m_storageType == ComponentStorageType::Archetype)
+	{
+		for (sizet i = 0; i < count; ++i)
+		{
+			m_impl.m_archetypes.remove(slots[i]);
+		}
+	}
+	else
+	{
+		for (const auto &[storage, functions] : m_impl.m_storageFunctions)
+		{
+			for (sizet i = 0; i < count; ++i)
+			{
+				functions.m_remove(storage, slots[i]);
+			}
+		}
+	}
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		// The same entity may be destroyed by several buffers
+		if (m_impl.m_slotGenerator.isValid(slots[i]))
+		{
+			m_impl.m_slotGenerator.release(slots[i]);
+		}
+	}
+}
+
+void EntityManager::_playbackCommands()
+{
+	using Commands = EntityCommandBuffer::ComponentCommands;
+
+	frame_vector<std::pair<ArchetypeStorage::TypeId, Commands*>> commands;
+	frame_vector<SlotGenerator::Slot> destroyed;
+
+	for (const auto &buffer : m_impl.m_commandBuffers)
+	{
+		for (auto &[id, componentCommands] : buffer->m_components)
+		{
+			if (!componentCommands.m_commands.empty())
+			{
+				commands.emplace_back(id, &componentCommands);
+			}
+		}
+
+		destroyed.insert(destroyed.end(), buffer->m_destroyed.begin(), buffer->m_destroyed.end());
+		buffer->m_destroyed.clear();
+	}
+
+	// Grouped by the component type, the buffers keep their order inside of a group
+	std::stable_sort(commands.begin(), commands.end(), [](const auto &lhs, const auto &rhs)
+	{
+		return lhs.first < rhs.first;
+	});
+
+	for (const auto &[id, componentCommands] : commands)
+	{
+		componentCommands->m_playback(*this, *componentCommands);
+	}
+
+	_destroyEntities(destroyed.data(), destroyed.size());
+}
+
+void EntityManager::_compactStorages(sizet budget)
+{
+	for (const auto &[storage, functions] : m_impl.m_storageFunctions)
+	{
+		functions.m_compact(storage, budget);
+	}
+}
+
+ArchetypeStorage& EntityManager::_getArchetypes()
+{
+	return m_impl.m_archetypes;
+}
+
+const ArchetypeStorage& EntityManager::_getArchetypes() const
+{
+	return m_impl.m_archetypes;
+}
 } // namespace argon
@@ -0,0 +1,437 @@
+#include <condition_variable>
+#include <thread>
+
+#include <fundamental/debug.hpp>
+
+#include "job_system.hpp"
+#include "reflection.hpp"
+
+RTTR_REGISTRATION
+{
+argon::reflection::Service<argon::JobSystem>("JobSystem");
+}
+
+namespace argon
+{
+namespace
+{
+// Chase-Lev deque with a fixed capacity. The owner pushes and pops at the bottom,
+// other threads steal from the top.
+class WorkStealingDeque final
+	: NonCopyable
+{
+public:
+	inline static constexpr int64 CAPACITY = 4096;
+
+	WorkStealingDeque()
+		: m_bottom(0)
+		, m_jobs(new Job[CAPACITY])
+		, m_top(0)
+	{
+	}
+
+	// Owner only, returns false if the deque is full
+	bool push(const Job &job)
+	{
+		const int64 bottom = m_bottom.load(std::memory_order_relaxed);
+		const int64 top = m_top.load(std::memory_order_acquire);
+
+		if (bottom - top >= CAPACITY)
+		{
+			return false;
+		}
+
+		m_jobs[static_cast<sizet>(bottom & MASK)] = job;
+		// Publishes the job to the thieves
+		m_bottom.store(bottom + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	// Owner only
+	bool pop(Job &job)
+	{
+		const int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+		m_bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64 top = m_top.load(std::memory_order_relaxed);
+
+		if (top > bottom)
+		{
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		job = m_jobs[static_cast<sizet>(bottom & MASK)];
+		if (top == bottom)
+		{
+			// The last job, race against the thieves
+			const bool won = m_top.compare_exchange_strong(top, top + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return won;
+		}
+
+		return true;
+	}
+
+	bool steal(Job &job)
+	{
+		int64 top = m_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+		{
+			return false;
+		}
+
+		job = m_jobs[static_cast<sizet>(top & MASK)];
+		return m_top.compare_exchange_strong(top, top + 1,
+			std::memory_order_seq_cst, std::memory_order_relaxed);
+	}
+
+private:
+	inline static constexpr int64 MASK = CAPACITY - 1;
+
+	static_assert((CAPACITY & MASK) == 0, "Capacity must be a power of two");
+
+	// The owner and the thieves write to different cache lines
+	std::atomic<int64> m_bottom;
+	std::unique_ptr<Job[]> m_jobs;
+	AR_PAD(48);
+	std::atomic<int64> m_top;
+};
+} // namespace
+
+class JobSystem::JobSystemPrivate final
+{
+public:
+	struct Worker
+	{
+		JobSystemPrivate *m_owner;
+		sizet m_index;
+		WorkStealingDeque m_deque;
+		std::thread m_thread;
+	};
+
+	JobSystemPrivate()
+		: m_queued(0)
+		, m_sleepers(0)
+		, m_stop(false)
+	{
+		const sizet numThreads = std::max<sizet>(std::thread::hardware_concurrency(), 1u);
+
+		for (sizet i = 0; i < numThreads; ++i)
+		{
+			m_workers.push_back(std::make_unique<Worker>());
+			m_workers.back()->m_owner = this;
+			m_workers.back()->m_index = i;
+		}
+
+		// Worker 0 is the creating thread
+		s_worker = m_workers.front().get();
+
+		for (sizet i = 1; i < numThreads; ++i)
+		{
+			m_workers[i]->m_thread = std::thread(&JobSystemPrivate::_workerLoop, this, m_workers[i].get());
+		}
+	}
+
+	~JobSystemPrivate()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop.store(true);
+		}
+
+		m_condition.notify_all();
+
+		for (sizet i = 1; i < m_workers.size(); ++i)
+		{
+			m_workers[i]->m_thread.join();
+		}
+
+		if (s_worker && s_worker->m_owner == this)
+		{
+			s_worker = nullptr;
+		}
+	}
+
+	sizet getNumThreads() const
+	{
+		return m_workers.size();
+	}
+
+	void push(const Job &job)
+	{
+		Worker *self = _getSelf();
+
+		// Counted before the job is published, a thief may take it right away
+		m_queued.fetch_add(1, std::memory_order_seq_cst);
+
+		if (self)
+		{
+			if (!self->m_deque.push(job))
+			{
+				// Nowhere to put the job, execute it in place
+				m_queued.fetch_sub(1, std::memory_order_relaxed);
+				execute(job);
+				return;
+			}
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_injected.push_back(job);
+		}
+
+		if (m_sleepers.load(std::memory_order_seq_cst) > 0)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_condition.notify_one();
+		}
+	}
+
+	void defer(const Job &job, const JobCounter &dependency)
+	{
+		JobCounter &counter = const_cast<JobCounter&>(dependency);
+
+		{
+			// Without unfinished jobs the dependency is met, even while the hand-off is running
+			std::lock_guard<std::mutex> lock(counter.m_mutex);
+			if ((counter.m_pending.load(std::memory_order_acquire) & JobCounter::JOB_MASK) != 0)
+			{
+				counter.m_dependents.push_back(job);
+				return;
+			}
+		}
+
+		push(job);
+	}
+
+	bool runOne()
+	{
+		Job job;
+		if (!_take(_getSelf(), job))
+		{
+			return false;
+		}
+
+		execute(job);
+		return true;
+	}
+
+	void execute(const Job &job)
+	{
+		job.m_function(job.m_data, job.m_begin, job.m_end);
+
+		JobCounter &counter = *job.m_counter;
+		uint32 pending = counter.m_pending.load(std::memory_order_relaxed);
+		uint32 next;
+
+		do
+		{
+			const uint32 jobs = pending & JobCounter::JOB_MASK;
+
+			// The last job keeps the counter from being done until the hand-off is over
+			if (jobs == 1 && !(pending & JobCounter::HANDING_OFF))
+			{
+				next = JobCounter::HANDING_OFF;
+			}
+			else if (jobs == 1)
+			{
+				next = (pending - 1) | JobCounter::RECHECK;
+			}
+			else
+			{
+				next = pending - 1;
+			}
+		}
+		while (!counter.m_pending.compare_exchange_weak(pending, next,
+			std::memory_order_acq_rel, std::memory_order_relaxed));
+
+		if (next == JobCounter::HANDING_OFF)
+		{
+			_handOff(counter);
+		}
+	}
+
+private:
+	// Takes the deferred jobs and clears the flag before pushing them, so the counter is done before
+	// its dependents run. The counter may be destroyed by a waiter right after the flag is cleared.
+	void _handOff(JobCounter &counter)
+	{
+		vector<Job> dependents;
+
+		for (;;)
+		{
+			uint32 pending;
+
+			{
+				// The deferred jobs are met only while no jobs were added meanwhile,
+				// otherwise they are handed off by the last of those
+				std::lock_guard<std::mutex> lock(counter.m_mutex);
+				pending = counter.m_pending.load(std::memory_order_acquire);
+				if ((pending & JobCounter::JOB_MASK) == 0)
+				{
+					dependents.insert(dependents.end(), counter.m_dependents.begin(), counter.m_dependents.end());
+					counter.m_dependents.clear();
+				}
+			}
+
+			// The jobs which were added and finished meanwhile may have left deferred jobs behind
+			bool cleared = false;
+			while (!cleared && !(pending & JobCounter::RECHECK))
+			{
+				cleared = counter.m_pending.compare_exchange_weak(pending, pending & ~JobCounter::HANDING_OFF,
+					std::memory_order_acq_rel, std::memory_order_acquire);
+			}
+
+			if (cleared)
+			{
+				break;
+			}
+
+			counter.m_pending.fetch_and(~JobCounter::RECHECK, std::memory_order_acq_rel);
+		}
+
+		for (const auto &dependent : dependents)
+		{
+			push(dependent);
+		}
+	}
+
+	Worker* _getSelf() const
+	{
+		return s_worker && s_worker->m_owner == this ? s_worker : nullptr;
+	}
+
+	bool _take(Worker *self, Job &job)
+	{
+		if (m_queued.load(std::memory_order_acquire) == 0)
+		{
+			return false;
+		}
+
+		bool found = self && self->m_deque.pop(job);
+
+		const sizet start = self ? self->m_index + 1 : 0;
+		for (sizet i = 0; !found && i < m_workers.size(); ++i)
+		{
+			Worker &victim = *m_workers[(start + i) % m_workers.size()];
+			found = &victim != self && victim.m_deque.steal(job);
+		}
+
+		if (!found)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (!m_injected.empty())
+			{
+				job = m_injected.front();
+				m_injected.pop_front();
+				found = true;
+			}
+		}
+
+		if (found)
+		{
+			m_queued.fetch_sub(1, std::memory_order_acq_rel);
+		}
+
+		return found;
+	}
+
+	void _workerLoop(Worker *self)
+	{
+		s_worker = self;
+
+		while (!m_stop.load(std::memory_order_acquire))
+		{
+			if (runOne())
+			{
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+			m_condition.wait(lock, [this]()
+			{
+				return m_stop.load(std::memory_order_relaxed)
+					|| m_queued.load(std::memory_order_seq_cst) > 0;
+			});
+			m_sleepers.fetch_sub(1, std::memory_order_seq_cst);
+		}
+
+		s_worker = nullptr;
+	}
+
+	static thread_local Worker *s_worker;
+
+	vector<std::unique_ptr<Worker>> m_workers;
+	// Jobs pushed by the threads which are not the workers
+	deque<Job> m_injected;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	// Jobs in the deques and the injected queue, never less than the number of the stealable ones
+	std::atomic<sizet> m_queued;
+	std::atomic<sizet> m_sleepers;
+	std::atomic<bool> m_stop;
+	AR_PAD(7);
+};
+
+thread_local JobSystem::JobSystemPrivate::Worker *JobSystem::JobSystemPrivate::s_worker = nullptr;
+
+JobCounter::JobCounter()
+	: m_pending(0)
+{
+}
+
+JobCounter::~JobCounter()
+{
+	AR_CRITICAL(isDone(), "Counter is destroyed while its jobs are running");
+}
+
+JobSystem::JobSystem(ConstructionData &&data)
+	: ServiceBase(std::move(data))
+	, m_jobs(new JobSystemPrivate())
+{
+}
+
+JobSystem::~JobSystem() = default;
+
+void JobSystem::tick()
+{
+}
+
+sizet JobSystem::getNumThreads() const
+{
+	return m_jobs->getNumThreads();
+}
+
+void JobSystem::run(const Job &job, const JobCounter *dependency)
+{
+	AR_CRITICAL(job.m_function && job.m_counter, "Job is not valid");
+
+	job.m_counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+	if (dependency)
+	{
+		m_jobs->defer(job, *dependency);
+		return;
+	}
+
+	m_jobs->push(job);
+}
+
+void JobSystem::wait(const JobCounter &counter)
+{
+	while (!counter.isDone())
+	{
+		if (!m_jobs->runOne())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+} // namespace argon
@@ -4,6 +4,7 @@
 
 #include "engine.hpp"
 #include "filesystem.hpp"
+#include "profiler.hpp"
 #include "private/plugin/plugin_manager.hpp"
 #include "private/service_manager.hpp"
 
@@ -19,6 +20,7 @@ PluginManager::~PluginManager() = default;
 void PluginManager::initialize()
 {
 	const auto &fs = m_serviceManager.get<Filesystem>();
+	auto &profiler = m_serviceManager.get<Profiler>();
 
 	const auto &pluginDir = fs.getPluginDir();
 
@@ -33,25 +35,34 @@ void PluginManager::initialize()
 		const std::string &filename = p.path().filename();
 
 		auto plugin = std::make_unique<rttr::library>(pluginPath);
-		if (!plugin->load())
+		bool loaded;
 		{
-			debug::errorMsg("Failed to load plugin: ", filename, ". Error: ",
+			const ProfileZone zone(profiler, profiler.registerName("Plugin load " + filename));
+			loaded = plugin->load();
+		}
+
+		if (!loaded)
+		{
+			AR_LOG_ERROR("Failed to load plugin: ", filename, ". Error: ",
 				plugin->get_error_string());
 			continue;
 		}
 
-		debug::statusMsg("Plugin loaded ", filename);
+		AR_LOG_STATUS("Plugin loaded ", filename);
 		m_plugins.emplace(filename, std::move(plugin));
 	}
 }
 
 void PluginManager::finalize()
 {
+	// The log thread reads the messages of the plugins from their memory
+	debug::flushLog();
+
 	for (auto &[f, p] : m_plugins)
 	{
 		p->unload();
 		p.reset();
-		debug::statusMsg("Plugin unloaded ", f);
+		AR_LOG_STATUS("Plugin unloaded ", f);
 	}
 
 	m_plugins.clear();
@@ -0,0 +1,427 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <utility>
+
+#include <data_structures/flat_hash_map.hpp>
+
+#include <fundamental/debug.hpp>
+
+#include "profiler.hpp"
+#include "reflection.hpp"
+
+RTTR_REGISTRATION
+{
+argon::reflection::Service<argon::Profiler>("Profiler");
+}
+
+namespace argon
+{
+namespace
+{
+std::atomic<uint64> s_nextProfilerId(1u);
+
+struct ZoneEvent
+{
+	const char *m_name;
+	uint64 m_begin;
+	uint64 m_end;
+};
+
+// Single producer, single consumer. The thread owning the ring pushes, endFrame drains.
+class EventRing final
+	: NonCopyable
+{
+public:
+	inline static constexpr uint64 CAPACITY = Profiler::MAX_THREAD_ZONES;
+
+	EventRing()
+		: m_head(0)
+		, m_dropped(0)
+		, m_events(new ZoneEvent[CAPACITY])
+		, m_tail(0)
+	{
+	}
+
+	// Owner only, the event is dropped if the ring is full
+	void push(const ZoneEvent &event)
+	{
+		const uint64 tail = m_tail.load(std::memory_order_relaxed);
+
+		if (tail - m_head.load(std::memory_order_acquire) >= CAPACITY)
+		{
+			m_dropped.fetch_add(1u, std::memory_order_relaxed);
+			return;
+		}
+
+		m_events[tail & MASK] = event;
+		m_tail.store(tail + 1, std::memory_order_release);
+	}
+
+	template <typename TFunc>
+	void drain(TFunc &&func)
+	{
+		const uint64 head = m_head.load(std::memory_order_relaxed);
+		const uint64 tail = m_tail.load(std::memory_order_acquire);
+
+		for (uint64 i = head; i != tail; ++i)
+		{
+			func(m_events[i & MASK]);
+		}
+
+		m_head.store(tail, std::memory_order_release);
+	}
+
+	uint64 takeDropped()
+	{
+		return m_dropped.exchange(0u, std::memory_order_relaxed);
+	}
+
+private:
+	inline static constexpr uint64 MASK = CAPACITY - 1;
+
+	static_assert((CAPACITY & MASK) == 0, "Capacity must be a power of two");
+
+	// The producer and the consumer write to different cache lines
+	std::atomic<uint64> m_head;
+	std::atomic<uint64> m_dropped;
+	std::unique_ptr<ZoneEvent[]> m_events;
+	AR_PAD(40);
+	std::atomic<uint64> m_tail;
+};
+
+void writeJsonString(std::ostream &out, const std::string &str)
+{
+	constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+	out << '"';
+	for (const char c : str)
+	{
+		const auto code = static_cast<uint8>(c);
+
+		if (c == '"' || c == '\\')
+		{
+			out << '\\' << c;
+		}
+		else if (code < 0x20u)
+		{
+			// Control characters are not allowed in the strings
+			out << "\\u00" << HEX_DIGITS[code >> 4] << HEX_DIGITS[code & 0xfu];
+		}
+		else
+		{
+			out << c;
+		}
+	}
+	out << '"';
+}
+} // namespace
+
+class Profiler::ProfilerPrivate final
+{
+public:
+	using ClockType = std::chrono::steady_clock;
+
+	// The trace keeps at most this many zones
+	inline static constexpr sizet MAX_TRACE_EVENTS = 1u << 20;
+
+	struct ThreadBuffer
+	{
+		EventRing m_ring;
+		uint32 m_thread;
+		AR_PAD(4);
+	};
+
+	struct Zone
+	{
+		std::string m_name;
+		// Indexed by the frame number modulo the window
+		array<uint64, NUM_WINDOW_FRAMES> m_ticks;
+		array<uint32, NUM_WINDOW_FRAMES> m_calls;
+	};
+
+	struct TraceEvent
+	{
+		uint32 m_zone;
+		uint32 m_thread;
+		uint64 m_begin;
+		uint64 m_end;
+	};
+
+	ProfilerPrivate()
+		: m_id(s_nextProfilerId.fetch_add(1u, std::memory_order_relaxed))
+		, m_startTicks(__rdtsc())
+		, m_startTime(ClockType::now())
+		, m_frame(0)
+		, m_capturing(false)
+	{
+	}
+
+	EventRing& getRing()
+	{
+		// Profiler id -> ring of the thread, ids are never reused, so the stale entries never match
+		thread_local vector<std::pair<uint64, EventRing*>> s_rings;
+
+		for (const auto &[profiler, ring] : s_rings)
+		{
+			if (profiler == m_id)
+			{
+				return *ring;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(m_buffersMutex);
+		m_buffers.push_back(std::make_unique<ThreadBuffer>());
+		m_buffers.back()->m_thread = static_cast<uint32>(m_buffers.size() - 1);
+		s_rings.emplace_back(m_id, &m_buffers.back()->m_ring);
+
+		return *s_rings.back().second;
+	}
+
+	void endFrame()
+	{
+		const sizet slot = m_frame % NUM_WINDOW_FRAMES;
+
+		for (auto &zone : m_zones)
+		{
+			zone.m_ticks[slot] = 0u;
+			zone.m_calls[slot] = 0u;
+		}
+
+		uint64 dropped = 0;
+
+		std::lock_guard<std::mutex> lock(m_buffersMutex);
+		for (auto &buffer : m_buffers)
+		{
+			buffer->m_ring.drain([this, slot, &buffer](const ZoneEvent &event)
+			{
+				const uint32 index = getZone(event.m_name);
+				Zone &zone = m_zones[index];
+				zone.m_ticks[slot] += event.m_end - event.m_begin;
+				++zone.m_calls[slot];
+
+				if (m_capturing && m_trace.size() < MAX_TRACE_EVENTS)
+				{
+					m_trace.push_back({index, buffer->m_thread, event.m_begin, event.m_end});
+				}
+			});
+
+			dropped += buffer->m_ring.takeDropped();
+		}
+
+		if (dropped)
+		{
+			AR_LOG_ERROR("Profiler dropped ", dropped, " zones, the ring buffer is full");
+		}
+
+		++m_frame;
+	}
+
+	uint32 getZone(const char *name)
+	{
+		const auto it = m_zoneIndices.find(name);
+		if (it != m_zoneIndices.end())
+		{
+			return it->second;
+		}
+
+		const uint32 index = static_cast<uint32>(m_zones.size());
+		m_zones.push_back({name, {}, {}});
+		m_zoneIndices.emplace(name, index);
+
+		return index;
+	}
+
+	// Calibrated against the steady clock over the lifetime of the profiler
+	float64 getTicksPerMs() const
+	{
+		const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			ClockType::now() - m_startTime).count();
+		if (elapsed <= 0)
+		{
+			return 1.0;
+		}
+
+		return static_cast<float64>(__rdtsc() - m_startTicks) * 1e6 / static_cast<float64>(elapsed);
+	}
+
+	const uint64 m_id;
+	const uint64 m_startTicks;
+	const ClockType::time_point m_startTime;
+
+	std::mutex m_buffersMutex;
+	vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+
+	flat_hash_map<const char*, uint32> m_zoneIndices;
+	vector<Zone> m_zones;
+	// Number of the ended frames
+	uint64 m_frame;
+
+	std::mutex m_namesMutex;
+	// Node based, the returned names stay valid while the set grows
+	unordered_set<std::string> m_names;
+
+	vector<TraceEvent> m_trace;
+	bool m_capturing;
+	AR_PAD(7);
+};
+
+Profiler::Profiler(ConstructionData &&data)
+	: ServiceBase(std::move(data))
+	, m_impl(new ProfilerPrivate())
+	, m_enabled(true)
+{
+}
+
+Profiler::~Profiler() = default;
+
+void Profiler::tick()
+{
+}
+
+void Profiler::setEnabled(bool enabled)
+{
+	m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::endFrame()
+{
+	m_impl->endFrame();
+}
+
+const char* Profiler::registerName(const std::string &name)
+{
+	std::lock_guard<std::mutex> lock(m_impl->m_namesMutex);
+	return m_impl->m_names.insert(name).first->c_str();
+}
+
+void Profiler::startCapture()
+{
+	m_impl->m_trace.clear();
+	m_impl->m_capturing = true;
+}
+
+void Profiler::stopCapture()
+{
+	m_impl->m_capturing = false;
+}
+
+bool Profiler::isCapturing() const
+{
+	return m_impl->m_capturing;
+}
+
+bool Profiler::exportChromeTrace(const std::string &path) const
+{
+	std::ofstream out(path);
+	if (!out)
+	{
+		AR_LOG_ERROR("Failed to open the trace file ", path);
+		return false;
+	}
+
+	const float64 ticksPerUs = m_impl->getTicksPerMs() / 1000.0;
+	const uint64 start = m_impl->m_startTicks;
+
+	out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+	bool first = true;
+	for (const auto &event : m_impl->m_trace)
+	{
+		out << (first ? "\n" : ",\n") << "{\"name\":";
+		writeJsonString(out, m_impl->m_zones[event.m_zone].m_name);
+		out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.m_thread
+			<< ",\"ts\":" << static_cast<float64>(event.m_begin - start) / ticksPerUs
+			<< ",\"dur\":" << static_cast<float64>(event.m_end - event.m_begin) / ticksPerUs << "}";
+		first = false;
+	}
+
+	out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	return static_cast<bool>(out);
+}
+
+vector<ProfileZoneStats> Profiler::getStats() const
+{
+	const float64 ticksPerMs = m_impl->getTicksPerMs();
+	const sizet numFrames = static_cast<sizet>(
+		std::min<uint64>(m_impl->m_frame, NUM_WINDOW_FRAMES));
+
+	vector<ProfileZoneStats> stats;
+	vector<uint64> samples;
+
+	for (const auto &zone : m_impl->m_zones)
+	{
+		samples.clear();
+		uint64 calls = 0;
+
+		for (sizet frame = 0; frame < numFrames; ++frame)
+		{
+			if (zone.m_calls[frame])
+			{
+				samples.push_back(zone.m_ticks[frame]);
+				calls += zone.m_calls[frame];
+			}
+		}
+
+		if (samples.empty())
+		{
+			continue;
+		}
+
+		const sizet numSamples = samples.size();
+		uint64 sum = 0;
+		for (const uint64 sample : samples)
+		{
+			sum += sample;
+		}
+
+		// Nearest rank
+		const auto p99 = samples.begin() + static_cast<ptrdiff>(
+			std::ceil(0.99 * static_cast<float64>(numSamples)) - 1.0);
+		std::nth_element(samples.begin(), p99, samples.end());
+
+		stats.push_back({zone.m_name,
+			static_cast<float64>(*std::min_element(samples.begin(), samples.end())) / ticksPerMs,
+			static_cast<float64>(sum) / static_cast<float64>(numSamples) / ticksPerMs,
+			static_cast<float64>(*p99) / ticksPerMs,
+			static_cast<float64>(calls) / static_cast<float64>(numSamples)});
+	}
+
+	return stats;
+}
+
+void Profiler::writeStats(std::ostream &out) const
+{
+	vector<ProfileZoneStats> stats = getStats();
+	std::sort(stats.begin(), stats.end(), [](const ProfileZoneStats &lhs, const ProfileZoneStats &rhs)
+	{
+		return lhs.m_averageMs > rhs.m_averageMs;
+	});
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+
+	out << std::left << std::setw(40) << "Zone" << std::right << std::setw(10) << "min ms"
+		<< std::setw(10) << "avg ms" << std::setw(10) << "p99 ms" << std::setw(10) << "calls" << '\n';
+
+	out << std::fixed << std::setprecision(3);
+	for (const auto &zone : stats)
+	{
+		out << std::left << std::setw(40) << zone.m_name << std::right
+			<< std::setw(10) << zone.m_minMs << std::setw(10) << zone.m_averageMs
+			<< std::setw(10) << zone.m_p99Ms << std::setw(10) << zone.m_callsPerFrame << '\n';
+	}
+
+	out.flags(flags);
+	out.precision(precision);
+}
+
+void Profiler::_record(const char *name, uint64 begin, uint64 end)
+{
+	m_impl->getRing().push({name, begin, end});
+}
+} // namespace argon
@@ -1,17 +1,32 @@
 #include "private/construction_data_impl.hpp"
+#include "reflection.hpp"
 #include "service.hpp"
 
 namespace argon
 {
-ServiceBase::ServiceBase(ConstructionData &&data)
-	: m_impl(std::move(data.m_impl))
+namespace detail
+{
+uint32 acquireServiceId()
 {
+	// Services are registered during the static initialization of the libraries
+	static uint32 s_nextId = 0;
+
+	AR_CRITICAL(s_nextId < MAX_SERVICES, "Too many services are registered");
+	return s_nextId++;
 }
 
-ServiceBase::~ServiceBase() = default;
+uint32 getServiceId(const rttr::type &type)
+{
+	const rttr::variant id = type.get_metadata(reflection::ServiceMeta::Id);
+	return id.is_valid() ? id.get_value<uint32>() : INVALID_SERVICE_ID;
+}
+} // namespace detail
 
-ServiceBase& ServiceBase::_get(const rttr::type &type)
+ServiceBase::ServiceBase(ConstructionData &&data)
+	: m_impl(std::move(data.m_impl))
+	, m_services(m_impl->m_serviceManager.getTable())
 {
-	return m_impl->m_serviceManager.get(type);
 }
+
+ServiceBase::~ServiceBase() = default;
 } // namespace argon
@@ -6,10 +6,16 @@
 
 namespace argon
 {
-Space::Space(privateimpl::ServiceManager &serviceManager)
+namespace
+{
+// Slots visited by the compaction of every component storage per tick
+inline constexpr sizet COMPACTION_BUDGET = 512u;
+} // namespace
+
+Space::Space(privateimpl::ServiceManager &serviceManager, ComponentStorageType storageType)
 	: m_serviceManager(serviceManager)
-	, m_entityManager(new EntityManager(serviceManager))
-	, m_systemManager(new SystemManager(serviceManager))
+	, m_entityManager(new EntityManager(serviceManager, storageType))
+	, m_systemManager(new SystemManager(serviceManager, *m_entityManager))
 {
 }
 
@@ -19,6 +25,9 @@ void Space::tick()
 {
 	//Debug::statusMsg("Space tick begin");
 	m_systemManager->tick();
+	// Sync point, no system is running
+	m_entityManager->_playbackCommands();
+	m_entityManager->_compactStorages(COMPACTION_BUDGET);
 	//Debug::statusMsg("Space tick end");
 }
 } // namespace argon
@@ -11,13 +11,14 @@ namespace argon
 
 SystemBase::SystemBase(ConstructionData &&data)
 	: m_impl(std::move(data.m_impl))
+	, m_services(m_impl->m_serviceManager.getTable())
 {
 }
 
 SystemBase::~SystemBase() = default;
 
-ServiceBase& SystemBase::_get(const rttr::type &type)
+EntityManager& SystemBase::getEntityManager()
 {
-	return m_impl->m_serviceManager.get(type);
+	return m_impl->m_entityManager;
 }
 } // namespace argon
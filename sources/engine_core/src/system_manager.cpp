@@ -2,34 +2,32 @@
 
 #include "private/system_manager_data_provider.hpp"
 #include "private/construction_data_impl.hpp"
+#include "entity_manager.hpp"
+#include "job_system.hpp"
+#include "profiler.hpp"
+#include "reflection.hpp"
 #include "system_manager.hpp"
 #include "system.hpp"
 
 namespace argon
 {
-SystemManager::SystemManager(privateimpl::ServiceManager &serviceManager)
+SystemManager::SystemManager(privateimpl::ServiceManager &serviceManager,
+	EntityManager &entityManager)
 	: m_serviceManager(serviceManager)
+	, m_entityManager(entityManager)
+	, m_jobSystem(serviceManager.get<JobSystem>())
+	, m_profiler(serviceManager.get<Profiler>())
 	, m_data(serviceManager.get<privateimpl::SystemManagerDataProvider>().acquire(*this))
 {
-	const auto sysType = rttr::type::get_by_name("SimpleAppSystem");
-	AR_CRITICAL(sysType.is_valid(), "Filesystem is not registered");
-
-	const auto ctr = sysType.get_constructor({rttr::type::get<SystemBase::ConstructionData&&>()});
-	auto var = ctr.invoke(SystemBase::ConstructionData{
-		std::make_unique<SystemBase::SystemBasePrivate>(m_serviceManager)});
-
-	privateimpl::SystemData data(sysType, std::move(var));
-	AR_CRITICAL(data.isValid(), "SystemData is not valid");
-
-	data.init();
-	m_data.m_systems.emplace(sysType, std::move(data));
+	_createSystems();
+	_buildSchedule();
 }
 
 SystemManager::~SystemManager()
 {
 	for (auto &s : m_data.m_systems)
 	{
-		s.second.fini();
+		s.fini();
 	}
 
 	m_data.m_systems.clear();
@@ -38,9 +36,130 @@ SystemManager::~SystemManager()
 
 void SystemManager::tick()
 {
-	for (auto& s : m_data.m_systems)
+	for (const auto &phase : m_data.m_schedule.m_phases)
 	{
-		s.second.tick();
+		_runPhase(phase.m_begin, phase.m_end);
 	}
 }
+
+void SystemManager::_createSystems()
+{
+	for (const auto &systemType : rttr::type::get_types())
+	{
+		const rttr::variant classTypeMeta = systemType.get_metadata(reflection::SystemMeta::Type);
+		if (!classTypeMeta.is_valid()
+			|| classTypeMeta.get_value<reflection::ClassType>() != reflection::ClassType::System)
+		{
+			continue;
+		}
+
+		const auto ctr = systemType.get_constructor({rttr::type::get<SystemBase::ConstructionData&&>()});
+		auto var = ctr.invoke(SystemBase::ConstructionData{
+			std::make_unique<SystemBase::SystemBasePrivate>(m_serviceManager, m_entityManager)});
+
+		privateimpl::SystemData data(systemType, std::move(var));
+		AR_CRITICAL(data.isValid(), "SystemData is not valid");
+
+		// Concurrently running systems must not create storages of the components they access
+		for (const auto &type : data.getReads())
+		{
+			m_entityManager._prepareStorage(type);
+		}
+
+		for (const auto &type : data.getWrites())
+		{
+			m_entityManager._prepareStorage(type);
+		}
+
+		data.init();
+		m_data.m_systems.push_back(std::move(data));
+	}
+}
+
+void SystemManager::_buildSchedule()
+{
+	auto &schedule = m_data.m_schedule;
+	const auto &systems = m_data.m_systems;
+	const uint32 numSystems = static_cast<uint32>(systems.size());
+
+	schedule.m_phases.clear();
+	schedule.m_successors.assign(numSystems, {});
+	schedule.m_numDependencies.assign(numSystems, 0u);
+	schedule.m_pendingDependencies = std::make_unique<std::atomic<uint32>[]>(numSystems);
+
+	for (uint32 begin = 0; begin < numSystems;)
+	{
+		uint32 end = begin + 1;
+		if (!systems[begin].isExclusive())
+		{
+			while (end < numSystems && !systems[end].isExclusive())
+			{
+				++end;
+			}
+		}
+
+		for (uint32 i = begin; i < end; ++i)
+		{
+			for (uint32 j = i + 1; j < end; ++j)
+			{
+				if (systems[i].conflictsWith(systems[j]))
+				{
+					schedule.m_successors[i].push_back(j);
+					++schedule.m_numDependencies[j];
+				}
+			}
+		}
+
+		schedule.m_phases.push_back({begin, end});
+		begin = end;
+	}
+}
+
+void SystemManager::_runPhase(uint32 begin, uint32 end)
+{
+	auto &schedule = m_data.m_schedule;
+
+	if (end - begin == 1)
+	{
+		m_data.m_systems[begin].tick(m_profiler);
+		return;
+	}
+
+	for (uint32 i = begin; i < end; ++i)
+	{
+		schedule.m_pendingDependencies[i].store(schedule.m_numDependencies[i], std::memory_order_relaxed);
+	}
+
+	for (uint32 i = begin; i < end; ++i)
+	{
+		if (schedule.m_numDependencies[i] == 0)
+		{
+			m_jobSystem.run(Job{&SystemManager::_systemJob, this, i, i + 1, &schedule.m_counter});
+		}
+	}
+
+	m_jobSystem.wait(schedule.m_counter);
+}
+
+void SystemManager::_runSystem(uint32 system)
+{
+	auto &schedule = m_data.m_schedule;
+
+	m_data.m_systems[system].tick(m_profiler);
+
+	// Successors are pushed before the job is finished, so the phase counter cannot drop to zero early
+	for (const uint32 successor : schedule.m_successors[system])
+	{
+		if (schedule.m_pendingDependencies[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			m_jobSystem.run(Job{&SystemManager::_systemJob, this, successor, successor + 1,
+				&schedule.m_counter});
+		}
+	}
+}
+
+void SystemManager::_systemJob(void *manager, sizet system, sizet)
+{
+	static_cast<SystemManager*>(manager)->_runSystem(static_cast<uint32>(system));
+}
 } // namespace argon
@@ -1,10 +1,21 @@
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
 #include <type_traits>
 
+#include <x86intrin.h>
+
+#include <fundamental/debug.hpp>
+
+#include "reflection.hpp"
 #include "time.hpp"
 
+RTTR_REGISTRATION
+{
+argon::reflection::Service<argon::Time>("Time");
+}
+
 namespace argon
 {
 class Time::TimePrivate final
@@ -15,9 +26,19 @@ public:
 		std::chrono::high_resolution_clock,
 		std::chrono::steady_clock>;
 	using TimeStampType = ClockType::time_point;
-	using StepPrecision = std::chrono::milliseconds;
+	using StepPrecision = std::chrono::nanoseconds;
 
-	static constexpr auto FPS_CAP = std::chrono::milliseconds(2);
+	// The sleep overshoots by up to the scheduler granularity, the rest of the wait is spinning
+	static constexpr auto SPIN_MARGIN = std::chrono::microseconds(1000);
+
+	TimePrivate()
+		: m_lastDelta(0)
+		, m_framePeriod(getPeriod(DEFAULT_FRAME_RATE))
+		, m_fixedStep(getPeriod(DEFAULT_FIXED_STEP_RATE))
+		, m_accumulator(0)
+	{
+		restart();
+	}
 
 	float32 getDelta() const
 	{
@@ -26,11 +47,17 @@ public:
 
 	float32 getUnscaledDelta() const
 	{
-		return m_lastDelta.count() / 1000.f;
+		return std::chrono::duration<float32>(m_lastDelta).count();
+	}
+
+	uint64 getUnscaledDeltaNs() const
+	{
+		return static_cast<uint64>(m_lastDelta.count());
 	}
 
 	void setDeltaScale(float32 val)
 	{
+		AR_ASSERT_MSG(val >= 0.f, "Scale is negative");
 		m_deltaScale = val;
 	}
 
@@ -39,39 +66,126 @@ public:
 		return m_deltaScale;
 	}
 
-	void endFrame()
+	void setTargetFrameRate(float64 rate)
+	{
+		AR_ASSERT_MSG(rate >= 0.0, "Rate is negative");
+		m_framePeriod = rate > 0.0 ? getPeriod(rate) : StepPrecision(0);
+		m_deadline = m_lastUpdate + m_framePeriod;
+	}
+
+	float64 getTargetFrameRate() const
+	{
+		return m_framePeriod.count() ? 1e9 / static_cast<float64>(m_framePeriod.count()) : 0.0;
+	}
+
+	void setFixedStepRate(float64 rate)
+	{
+		AR_ASSERT_MSG(rate > 0.0, "Rate is not positive");
+		m_fixedStep = getPeriod(rate);
+		m_accumulator = StepPrecision(0);
+	}
+
+	float64 getFixedStepRate() const
+	{
+		return 1e9 / static_cast<float64>(m_fixedStep.count());
+	}
+
+	float32 getFixedDelta() const
+	{
+		return std::chrono::duration<float32>(m_fixedStep).count();
+	}
+
+	uint32 consumeFixedSteps()
+	{
+		const auto numSteps = m_accumulator / m_fixedStep;
+		m_accumulator -= numSteps * m_fixedStep;
+
+		return static_cast<uint32>(numSteps);
+	}
+
+	float32 getFixedStepAlpha() const
 	{
-		updateLastDelta();
+		return static_cast<float32>(m_accumulator.count()) / static_cast<float32>(m_fixedStep.count());
+	}
+
+	void restart()
+	{
+		m_lastUpdate = ClockType::now();
+		m_deadline = m_lastUpdate + m_framePeriod;
+		m_lastDelta = StepPrecision(0);
+		m_accumulator = StepPrecision(0);
+	}
 
-		if (m_lastDelta < FPS_CAP)
+	void endFrame()
+	{
+		if (m_framePeriod.count())
 		{
-			std::this_thread::sleep_for(FPS_CAP - m_lastDelta);
-			updateLastDelta();
+			waitUntil(m_deadline);
+
+			// The deadlines stay on the grid of the period, unless a whole frame was missed
+			m_deadline += m_framePeriod;
+			const TimeStampType now = ClockType::now();
+			if (now > m_deadline)
+			{
+				m_deadline = now + m_framePeriod;
+			}
 		}
 
-		m_lastUpdate = ClockType::now();
+		const TimeStampType now = ClockType::now();
+		m_lastDelta = std::chrono::duration_cast<StepPrecision>(now - m_lastUpdate);
+		m_lastUpdate = now;
+
+		m_accumulator += StepPrecision(static_cast<StepPrecision::rep>(
+			static_cast<float64>(m_lastDelta.count()) * static_cast<float64>(m_deltaScale)));
+		// The steps above the limit are dropped
+		m_accumulator = std::min(m_accumulator,
+			m_fixedStep * static_cast<StepPrecision::rep>(MAX_FIXED_STEPS));
 	}
 
 private:
-	void updateLastDelta()
+	static StepPrecision getPeriod(float64 rate)
 	{
-		m_lastDelta = std::chrono::duration_cast<StepPrecision>(
-			ClockType::now() - m_lastUpdate);
+		return StepPrecision(static_cast<StepPrecision::rep>(1e9 / rate));
+	}
+
+	static void waitUntil(TimeStampType deadline)
+	{
+		for (TimeStampType now = ClockType::now(); deadline - now > SPIN_MARGIN; now = ClockType::now())
+		{
+			std::this_thread::sleep_for(deadline - now - SPIN_MARGIN);
+		}
+
+		while (ClockType::now() < deadline)
+		{
+			_mm_pause();
+		}
 	}
 
 	TimeStampType m_lastUpdate;
+	// Start of the next frame
+	TimeStampType m_deadline;
 	StepPrecision m_lastDelta;
+	// Zero does not limit the rate
+	StepPrecision m_framePeriod;
+	StepPrecision m_fixedStep;
+	// Scaled time, which is not consumed by the fixed steps yet
+	StepPrecision m_accumulator;
 	float32 m_deltaScale = 1.f;
-	AR_ATTR_UNUSED byte _padding[4];
+	AR_PAD(4);
 };
 
-Time::Time()
-	: m_impl(new TimePrivate())
+Time::Time(ConstructionData &&data)
+	: ServiceBase(std::move(data))
+	, m_impl(new TimePrivate())
 {
 }
 
 Time::~Time() = default;
 
+void Time::tick()
+{
+}
+
 float32 Time::getDelta() const
 {
 	return m_impl->getDelta();
@@ -82,6 +196,11 @@ float32 Time::getUnscaledDelta() const
 	return m_impl->getUnscaledDelta();
 }
 
+uint64 Time::getUnscaledDeltaNs() const
+{
+	return m_impl->getUnscaledDeltaNs();
+}
+
 void Time::setDeltaScale(float32 val)
 {
 	m_impl->setDeltaScale(val);
@@ -92,6 +211,46 @@ float32 Time::getDeltaScale() const
 	return m_impl->getDeltaScale();
 }
 
+void Time::setTargetFrameRate(float64 rate)
+{
+	m_impl->setTargetFrameRate(rate);
+}
+
+float64 Time::getTargetFrameRate() const
+{
+	return m_impl->getTargetFrameRate();
+}
+
+void Time::setFixedStepRate(float64 rate)
+{
+	m_impl->setFixedStepRate(rate);
+}
+
+float64 Time::getFixedStepRate() const
+{
+	return m_impl->getFixedStepRate();
+}
+
+float32 Time::getFixedDelta() const
+{
+	return m_impl->getFixedDelta();
+}
+
+uint32 Time::consumeFixedSteps()
+{
+	return m_impl->consumeFixedSteps();
+}
+
+float32 Time::getFixedStepAlpha() const
+{
+	return m_impl->getFixedStepAlpha();
+}
+
+void Time::restart()
+{
+	m_impl->restart();
+}
+
 void Time::endFrame()
 {
 	m_impl->endFrame();
@@ -0,0 +1,283 @@
+#include <algorithm>
+
+#include <rttr/registration.h>
+
+#include <fundamental/debug.hpp>
+
+#include <memory/containers.hpp>
+
+#include "entity_command_buffer.hpp"
+#include "entity_manager.hpp"
+#include "job_system.hpp"
+#include "reflection.hpp"
+#include "transform.hpp"
+
+RTTR_REGISTRATION
+{
+	argon::reflection::Component<argon::Transform>("Transform");
+	argon::reflection::Component<argon::WorldTransform>("WorldTransform");
+	argon::reflection::System<argon::TransformSystem>("TransformSystem")
+		.reads<argon::Transform>()
+		.writes<argon::WorldTransform>();
+}
+
+namespace argon
+{
+namespace
+{
+// Nodes computed by a single job
+inline constexpr sizet BATCH_SIZE = 256u;
+} // namespace
+
+TransformSystem::TransformSystem(ConstructionData &&data)
+	: SystemBase(std::move(data))
+{
+}
+
+TransformSystem::~TransformSystem() = default;
+
+void TransformSystem::initialize()
+{
+}
+
+void TransformSystem::finalize()
+{
+}
+
+void TransformSystem::tick()
+{
+	EntityManager &entityManager = getEntityManager();
+	m_updates.clear();
+
+	// A different number of transforms means some were assigned or erased
+	bool rebuild = entityManager.query<const Transform>().sizeHint() != m_entities.size();
+
+	entityManager.query<const Transform>(m_changed).each(
+		[this, &rebuild](Entity e, const Transform &transform)
+		{
+			const uint32 node = _findNode(e);
+			if (node == INVALID_NODE || m_parentEntities[node] != transform.m_parent)
+			{
+				rebuild = true;
+				return;
+			}
+
+			m_updates.emplace_back(node, &transform);
+		});
+
+	if (rebuild)
+	{
+		_rebuild();
+	}
+
+	if (m_updates.empty())
+	{
+		return;
+	}
+
+	_updateLocals();
+	_updateWorlds();
+	_writeWorlds();
+}
+
+void TransformSystem::_rebuild()
+{
+	frame_vector<Entity> entities;
+	frame_vector<const Transform*> transforms;
+
+	getEntityManager().query<const Transform>().each(
+		[&entities, &transforms](Entity e, const Transform &transform)
+		{
+			entities.push_back(e);
+			transforms.push_back(&transform);
+		});
+
+	const uint32 numNodes = static_cast<uint32>(entities.size());
+
+	// Entity index -> index in the collected arrays for now
+	m_nodes.clear();
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		if (entities[i].getIndex() >= m_nodes.size())
+		{
+			m_nodes.resize(entities[i].getIndex() + 1, INVALID_NODE);
+		}
+
+		m_nodes[entities[i].getIndex()] = i;
+	}
+
+	frame_vector<uint32> parents(numNodes, INVALID_NODE);
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		const Entity &parent = transforms[i]->m_parent;
+		if (parent.getIndex() < m_nodes.size())
+		{
+			const uint32 node = m_nodes[parent.getIndex()];
+			if (node != INVALID_NODE && entities[node] == parent)
+			{
+				parents[i] = node;
+			}
+		}
+	}
+
+	// Depth of every node, the chains of unknown depths are walked up once
+	constexpr uint32 UNKNOWN_DEPTH = INVALID_NODE;
+	constexpr uint32 VISITING = INVALID_NODE - 1;
+	frame_vector<uint32> depths(numNodes, UNKNOWN_DEPTH);
+	frame_vector<uint32> chain;
+	uint32 numLevels = 0;
+
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		uint32 node = i;
+		while (node != INVALID_NODE && depths[node] == UNKNOWN_DEPTH)
+		{
+			depths[node] = VISITING;
+			chain.push_back(node);
+			node = parents[node];
+		}
+
+		// The walk came back to its own chain, the last node is placed in the world instead
+		if (node != INVALID_NODE && depths[node] == VISITING)
+		{
+			AR_LOG_ERROR("Transform hierarchy has a cycle, entity ", entities[chain.back()].getIndex(),
+				" is detached from its parent");
+
+			parents[chain.back()] = INVALID_NODE;
+			node = INVALID_NODE;
+		}
+
+		uint32 depth = node == INVALID_NODE ? 0u : depths[node] + 1;
+		for (auto it = chain.rbegin(); it != chain.rend(); ++it, ++depth)
+		{
+			depths[*it] = depth;
+		}
+
+		numLevels = std::max(numLevels, depth);
+		chain.clear();
+	}
+
+	// Counting sort by the depth
+	m_levels.assign(numLevels + 1, 0u);
+	for (const uint32 depth : depths)
+	{
+		++m_levels[depth + 1];
+	}
+
+	for (uint32 level = 1; level <= numLevels; ++level)
+	{
+		m_levels[level] += m_levels[level - 1];
+	}
+
+	frame_vector<uint32> order(numNodes);
+	{
+		frame_vector<uint32> offsets(m_levels.begin(), m_levels.end() - 1);
+		for (uint32 i = 0; i < numNodes; ++i)
+		{
+			order[i] = offsets[depths[i]]++;
+		}
+	}
+
+	m_entities.resize(numNodes);
+	m_parentEntities.resize(numNodes);
+	m_parents.resize(numNodes);
+	m_locals.resize(numNodes);
+	m_worlds.resize(numNodes);
+	m_updates.clear();
+
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		const uint32 node = order[i];
+
+		m_entities[node] = entities[i];
+		m_parentEntities[node] = transforms[i]->m_parent;
+		m_parents[node] = parents[i] == INVALID_NODE ? INVALID_NODE : order[parents[i]];
+		m_nodes[entities[i].getIndex()] = node;
+		m_updates.emplace_back(node, transforms[i]);
+	}
+}
+
+uint32 TransformSystem::_findNode(const Entity &e) const
+{
+	if (e.getIndex() >= m_nodes.size())
+	{
+		return INVALID_NODE;
+	}
+
+	const uint32 node = m_nodes[e.getIndex()];
+	return node != INVALID_NODE && m_entities[node] == e ? node : INVALID_NODE;
+}
+
+void TransformSystem::_updateLocals()
+{
+	m_dirty.assign(m_entities.size(), 0u);
+
+	get<JobSystem>().parallelFor(0u, m_updates.size(), BATCH_SIZE, [this](sizet i)
+	{
+		const auto &[node, transform] = m_updates[i];
+
+		m_locals[node].setTransformation(transform->m_rotation, transform->m_scaling,
+			transform->m_translation);
+		m_dirty[node] = 1u;
+	});
+
+	// Parents precede their children, a single pass spreads the flags down the subtrees
+	m_dirtyNodes.clear();
+	for (uint32 node = 0; node < m_dirty.size(); ++node)
+	{
+		if (!m_dirty[node] && m_parents[node] != INVALID_NODE && m_dirty[m_parents[node]])
+		{
+			m_dirty[node] = 1u;
+		}
+
+		if (m_dirty[node])
+		{
+			m_dirtyNodes.push_back(node);
+		}
+	}
+}
+
+void TransformSystem::_updateWorlds()
+{
+	JobSystem &jobSystem = get<JobSystem>();
+	auto begin = m_dirtyNodes.begin();
+
+	// Every level waits for the previous one
+	for (sizet level = 1; level < m_levels.size() && begin != m_dirtyNodes.end(); ++level)
+	{
+		const auto end = std::lower_bound(begin, m_dirtyNodes.end(), m_levels[level]);
+
+		jobSystem.parallelFor(static_cast<sizet>(begin - m_dirtyNodes.begin()),
+			static_cast<sizet>(end - m_dirtyNodes.begin()), BATCH_SIZE, [this](sizet i)
+		{
+			const uint32 node = m_dirtyNodes[i];
+			const uint32 parent = m_parents[node];
+
+			m_worlds[node] = parent == INVALID_NODE
+				? m_locals[node]
+				: m_worlds[parent].multiplyAffine(m_locals[node]);
+		});
+
+		begin = end;
+	}
+}
+
+void TransformSystem::_writeWorlds()
+{
+	EntityManager &entityManager = getEntityManager();
+
+	for (const uint32 node : m_dirtyNodes)
+	{
+		const Entity &e = m_entities[node];
+
+		if (entityManager.has<WorldTransform>(e))
+		{
+			entityManager.get<WorldTransform>(e).m_matrix = m_worlds[node];
+		}
+		else
+		{
+			entityManager.getCommandBuffer().assign<WorldTransform>(e, m_worlds[node]);
+		}
+	}
+}
+} // namespace argon
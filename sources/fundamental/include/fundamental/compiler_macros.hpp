@@ -2,11 +2,13 @@
 
 #define AR_ATTR_ALIGN(alignVal)
 
-#ifdef AR_CLANG
-#define AR_VEC_CALL
+// Passes vector arguments in registers. The System V convention already does, so only
+// the Windows targets need a different one.
+#if defined(AR_CLANG) && defined(AR_WINDOWS)
+#define AR_VEC_CALL __vectorcall
 #else
 #define AR_VEC_CALL
-#endif // ifdef AR_CLANG
+#endif // if defined(AR_CLANG) && defined(AR_WINDOWS)
 
 #ifdef AR_CLANG
 #define AR_ATTR_UNUSED __attribute__((unused))
@@ -14,6 +16,10 @@
 #define AR_ATTR_UNUSED
 #endif // ifdef AR_CLANG
 
+#ifdef AR_CLANG
+#define AR_FORCE_INLINE inline __attribute__((always_inline))
+#else
 #define AR_FORCE_INLINE inline
+#endif // ifdef AR_CLANG
 
 #define AR_SYM_EXPORT __attribute__((visibility("default")))
@@ -1,7 +1,8 @@
 #pragma once
 
 #include <cassert>
-#include <iostream>
+
+#include "log.hpp"
 
 // TODO fix AR_ASSERT_MSG
 // TODO fix AR_CRITICAL
@@ -12,21 +13,23 @@
 
 namespace argon::debug
 {
+// Prefer AR_LOG_ERROR, which keeps the leading literal out of the buffer and can be stripped
 template <typename ...Args>
-void errorMsg(Args &&...args)
+void errorMsg(const Args &...args)
 {
 	static_assert(sizeof...(args), "ErrorMsg should be called with at least one argument");
 
-	std::cerr << "ERROR MSG: ";
-	(std::cerr << ... << args) << std::endl;
+	static constexpr LogSite s_site{LogLevel::Error, ""};
+	logMessage(s_site, "", args...);
 }
 
+// Prefer AR_LOG_STATUS
 template <typename ...Args>
-void statusMsg(Args &&...args)
+void statusMsg(const Args &...args)
 {
 	static_assert(sizeof...(args), "StatusMsg should be called with at least one argument");
 
-	std::cerr << "STATUS MSG: ";
-	(std::cerr << ... << args) << std::endl;
+	static constexpr LogSite s_site{LogLevel::Status, ""};
+	logMessage(s_site, "", args...);
 }
 } // namespace argon::debug
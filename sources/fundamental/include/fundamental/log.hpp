@@ -0,0 +1,196 @@
+#pragma once
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "compiler_macros.hpp"
+#include "helper_macros.hpp"
+#include "types.hpp"
+
+// Messages below the level are removed at compile time, the values are the ones of LogLevel
+#ifndef AR_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define AR_LOG_MIN_LEVEL 1
+#else
+#define AR_LOG_MIN_LEVEL 0
+#endif // ifdef NDEBUG
+#endif // ifndef AR_LOG_MIN_LEVEL
+
+#define AR_LOG_FIRST(first, ...) first
+
+// The first argument must be a string literal, it is stored once per call site and never copied.
+// The other arguments are copied into the buffer of the thread and formatted by the log thread.
+#define AR_LOG(level, ...) \
+	do \
+	{ \
+		if constexpr (static_cast<::argon::int32>(level) >= AR_LOG_MIN_LEVEL) \
+		{ \
+			static constexpr ::argon::debug::LogSite _arLogSite{level, "" AR_LOG_FIRST(__VA_ARGS__, )}; \
+			::argon::debug::logMessage(_arLogSite, __VA_ARGS__); \
+		} \
+	} while (false)
+
+#define AR_LOG_TRACE(...) AR_LOG(::argon::debug::LogLevel::Trace, __VA_ARGS__)
+#define AR_LOG_STATUS(...) AR_LOG(::argon::debug::LogLevel::Status, __VA_ARGS__)
+#define AR_LOG_WARNING(...) AR_LOG(::argon::debug::LogLevel::Warning, __VA_ARGS__)
+#define AR_LOG_ERROR(...) AR_LOG(::argon::debug::LogLevel::Error, __VA_ARGS__)
+
+namespace argon::debug
+{
+enum class LogLevel : uint32
+{
+	Trace = 0,
+	Status,
+	Warning,
+	Error
+};
+
+struct LogSite
+{
+	constexpr LogSite(LogLevel level, const char *message)
+		: m_message(message)
+		, m_level(level)
+		, _pad{}
+	{
+	}
+
+	const char *m_message;
+	LogLevel m_level;
+	AR_PAD(4);
+};
+
+enum class LogArgumentType : uint32
+{
+	Bool = 0,
+	Char,
+	Int,
+	UInt,
+	Float,
+	String,
+	// Formatted by the caller, the types without a native encoding
+	Formatted
+};
+
+// Type erased argument, the strings are referenced until logMessage returns
+struct LogArgument
+{
+	union
+	{
+		bool m_bool;
+		char m_char;
+		int64 m_int;
+		uint64 m_uint;
+		float64 m_float;
+	};
+	std::string_view m_string;
+	std::string m_formatted;
+	LogArgumentType m_type;
+	AR_PAD(4);
+};
+
+// Longer string arguments are truncated
+inline constexpr sizet MAX_LOG_STRING_LENGTH = 4096u;
+// Longer messages are truncated, the arguments which do not fit are dropped.
+// Counts the encoded arguments, every one takes 8 bytes more than its value.
+inline constexpr sizet MAX_LOG_RECORD_SIZE = 1u << 14;
+
+// Messages below the level are skipped at runtime
+AR_SYM_EXPORT void setLogLevel(LogLevel level);
+AR_SYM_EXPORT LogLevel getLogLevel();
+
+// The log is written to stderr and to the file, the empty path closes the file
+AR_SYM_EXPORT bool setLogFile(const std::string &path);
+
+// Blocks until the messages logged before the call are written
+AR_SYM_EXPORT void flushLog();
+
+// Copies the message into the buffer of the calling thread
+AR_SYM_EXPORT void pushLogMessage(const LogSite &site, const LogArgument *arguments, sizet count);
+
+template <typename T>
+LogArgument makeLogArgument(const T &value);
+
+template <typename ...Args>
+void logMessage(const LogSite &site, const char *message, const Args &...args);
+
+template <typename T>
+LogArgument makeLogArgument(const T &value)
+{
+	using Type = std::decay_t<T>;
+
+	LogArgument argument;
+	argument.m_uint = 0;
+
+	if constexpr (std::is_same_v<Type, bool>)
+	{
+		argument.m_type = LogArgumentType::Bool;
+		argument.m_bool = value;
+	}
+	else if constexpr (std::is_same_v<Type, char>)
+	{
+		argument.m_type = LogArgumentType::Char;
+		argument.m_char = value;
+	}
+	else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+	{
+		argument.m_type = LogArgumentType::Int;
+		argument.m_int = static_cast<int64>(value);
+	}
+	else if constexpr (std::is_integral_v<Type>)
+	{
+		argument.m_type = LogArgumentType::UInt;
+		argument.m_uint = static_cast<uint64>(value);
+	}
+	else if constexpr (std::is_floating_point_v<Type>)
+	{
+		argument.m_type = LogArgumentType::Float;
+		argument.m_float = static_cast<float64>(value);
+	}
+	else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>)
+	{
+		const char *str = value;
+
+		argument.m_type = LogArgumentType::String;
+		argument.m_string = str ? std::string_view(str) : std::string_view("(null)");
+	}
+	else if constexpr (std::is_convertible_v<const Type&, std::string_view>)
+	{
+		argument.m_type = LogArgumentType::String;
+		argument.m_string = value;
+	}
+	else
+	{
+		std::ostringstream stream;
+		stream << value;
+
+		argument.m_type = LogArgumentType::Formatted;
+		argument.m_formatted = stream.str();
+	}
+
+	return argument;
+}
+
+template <typename ...Args>
+void logMessage(const LogSite &site, const char *message, const Args &...args)
+{
+	// Same as the message of the site
+	AR_UNUSED(message);
+
+	if (static_cast<uint32>(site.m_level) < static_cast<uint32>(getLogLevel()))
+	{
+		return;
+	}
+
+	if constexpr (sizeof...(Args) == 0)
+	{
+		pushLogMessage(site, nullptr, 0u);
+	}
+	else
+	{
+		const LogArgument arguments[] = {makeLogArgument(args)...};
+		pushLogMessage(site, arguments, sizeof...(Args));
+	}
+}
+} // namespace argon::debug
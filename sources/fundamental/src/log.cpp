@@ -0,0 +1,630 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "helper_macros.hpp"
+#include "log.hpp"
+#include "non_copyable.hpp"
+
+namespace argon::debug
+{
+namespace
+{
+using ClockType = std::chrono::steady_clock;
+
+// Bytes of the ring of every thread
+inline constexpr uint64 RING_CAPACITY = 1u << 16;
+// The log thread wakes up at least this often, errors and full rings wake it up immediately
+inline constexpr auto WRITE_INTERVAL = std::chrono::milliseconds(10);
+
+static_assert(MAX_LOG_RECORD_SIZE <= RING_CAPACITY / 4,
+	"A record always fits into a ring drained by the log thread");
+
+const ClockType::time_point s_startTime = ClockType::now();
+std::atomic<uint32> s_level(static_cast<uint32>(LogLevel::Trace));
+// Set once the logger is destroyed, the late messages are written synchronously
+std::atomic<bool> s_destroyed(false);
+
+// Every record starts with the header, a zero size marks the skip to the beginning of the ring.
+// The arguments follow, every one is a type and a length, then 8 bytes of the value or the
+// bytes of the string, padded to 8 bytes.
+struct RecordHeader
+{
+	uint32 m_size;
+	uint32 m_numArguments;
+	int64 m_time;
+	const LogSite *m_site;
+};
+
+struct ArgumentHeader
+{
+	LogArgumentType m_type;
+	uint32 m_length;
+};
+
+int64 getTime()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(ClockType::now() - s_startTime).count();
+}
+
+constexpr sizet alignRecord(sizet size)
+{
+	return (size + 7u) & ~sizet(7u);
+}
+
+// The part of the string which fits into the record after its first offset bytes
+std::string_view getString(const LogArgument &argument, sizet offset)
+{
+	const std::string_view str = argument.m_type == LogArgumentType::Formatted
+		? std::string_view(argument.m_formatted) : argument.m_string;
+	const sizet space = offset + sizeof(ArgumentHeader) < MAX_LOG_RECORD_SIZE
+		? (MAX_LOG_RECORD_SIZE - offset - sizeof(ArgumentHeader)) & ~sizet(7u) : 0u;
+
+	return str.substr(0, std::min(MAX_LOG_STRING_LENGTH, space));
+}
+
+bool isString(const LogArgument &argument)
+{
+	return argument.m_type == LogArgumentType::String || argument.m_type == LogArgumentType::Formatted;
+}
+
+// The arguments past MAX_LOG_RECORD_SIZE are dropped, numArguments is the number of the encoded ones
+sizet getRecordSize(const LogArgument *arguments, sizet count, sizet &numArguments)
+{
+	sizet size = sizeof(RecordHeader);
+	for (numArguments = 0; numArguments < count; ++numArguments)
+	{
+		const LogArgument &argument = arguments[numArguments];
+		const sizet argumentSize = sizeof(ArgumentHeader)
+			+ (isString(argument) ? alignRecord(getString(argument, size).size()) : sizeof(uint64));
+
+		if (size + argumentSize > MAX_LOG_RECORD_SIZE)
+		{
+			break;
+		}
+
+		size += argumentSize;
+	}
+
+	return size;
+}
+
+void encodeRecord(byte *record, sizet size, int64 time, const LogSite &site,
+	const LogArgument *arguments, sizet numArguments)
+{
+	const RecordHeader header{static_cast<uint32>(size), static_cast<uint32>(numArguments), time, &site};
+	const byte *start = record;
+	std::memcpy(record, &header, sizeof(header));
+	record += sizeof(header);
+
+	for (sizet i = 0; i < numArguments; ++i)
+	{
+		const LogArgument &argument = arguments[i];
+
+		if (isString(argument))
+		{
+			const std::string_view str = getString(argument, static_cast<sizet>(record - start));
+			const ArgumentHeader argumentHeader{LogArgumentType::String, static_cast<uint32>(str.size())};
+
+			std::memcpy(record, &argumentHeader, sizeof(argumentHeader));
+			std::memcpy(record + sizeof(argumentHeader), str.data(), str.size());
+			record += sizeof(argumentHeader) + alignRecord(str.size());
+		}
+		else
+		{
+			const ArgumentHeader argumentHeader{argument.m_type, sizeof(uint64)};
+
+			std::memcpy(record, &argumentHeader, sizeof(argumentHeader));
+			std::memcpy(record + sizeof(argumentHeader), &argument.m_uint, sizeof(uint64));
+			record += sizeof(argumentHeader) + sizeof(uint64);
+		}
+	}
+}
+
+const char* getPrefix(LogLevel level)
+{
+	switch (level)
+	{
+	case LogLevel::Trace:
+		return "TRACE MSG: ";
+	case LogLevel::Status:
+		return "STATUS MSG: ";
+	case LogLevel::Warning:
+		return "WARNING MSG: ";
+	case LogLevel::Error:
+		return "ERROR MSG: ";
+	}
+
+	return "";
+}
+
+// Appends the line of the record
+void formatRecord(const byte *record, std::string &out)
+{
+	RecordHeader header;
+	std::memcpy(&header, record, sizeof(header));
+	record += sizeof(header);
+
+	char buffer[64];
+	std::snprintf(buffer, sizeof(buffer), "[%12.6f] ", static_cast<float64>(header.m_time) * 1e-9);
+	out += buffer;
+	out += getPrefix(header.m_site->m_level);
+	out += header.m_site->m_message;
+
+	for (uint32 i = 0; i < header.m_numArguments; ++i)
+	{
+		ArgumentHeader argumentHeader;
+		std::memcpy(&argumentHeader, record, sizeof(argumentHeader));
+		record += sizeof(argumentHeader);
+
+		if (argumentHeader.m_type == LogArgumentType::String)
+		{
+			out.append(reinterpret_cast<const char*>(record), argumentHeader.m_length);
+			record += alignRecord(argumentHeader.m_length);
+			continue;
+		}
+
+		uint64 bits;
+		std::memcpy(&bits, record, sizeof(bits));
+		record += sizeof(bits);
+
+		// The same output as the ostream operators
+		switch (argumentHeader.m_type)
+		{
+		case LogArgumentType::Bool:
+			out += (bits & 0xFFu) ? '1' : '0';
+			break;
+		case LogArgumentType::Char:
+			out += static_cast<char>(bits & 0xFFu);
+			break;
+		case LogArgumentType::Int:
+			std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(bits));
+			out += buffer;
+			break;
+		case LogArgumentType::UInt:
+			std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(bits));
+			out += buffer;
+			break;
+		case LogArgumentType::Float:
+		{
+			float64 value;
+			std::memcpy(&value, &bits, sizeof(value));
+			std::snprintf(buffer, sizeof(buffer), "%g", value);
+			out += buffer;
+			break;
+		}
+		case LogArgumentType::String:
+		case LogArgumentType::Formatted:
+			break;
+		}
+	}
+
+	out += '\n';
+}
+
+// Single producer, single consumer. The owning thread writes the records, the log thread reads them.
+class RecordRing final
+	: NonCopyable
+{
+public:
+	RecordRing()
+		: m_head(0)
+		, m_data(new byte[RING_CAPACITY])
+		, m_orphaned(false)
+		, m_tail(0)
+	{
+	}
+
+	// Owner only, a record never wraps around the end of the ring
+	byte* reserve(sizet size, uint64 &newTail)
+	{
+		const uint64 tail = m_tail.load(std::memory_order_relaxed);
+		const uint64 offset = tail & MASK;
+		const uint64 toEnd = RING_CAPACITY - offset;
+		const uint64 needed = size <= toEnd ? size : size + toEnd;
+
+		if (tail + needed - m_head.load(std::memory_order_acquire) > RING_CAPACITY)
+		{
+			return nullptr;
+		}
+
+		newTail = tail + needed;
+		if (size <= toEnd)
+		{
+			return m_data.get() + offset;
+		}
+
+		const uint32 skip = 0;
+		std::memcpy(m_data.get() + offset, &skip, sizeof(skip));
+
+		return m_data.get();
+	}
+
+	// Owner only
+	void commit(uint64 newTail)
+	{
+		m_tail.store(newTail, std::memory_order_release);
+	}
+
+	// Owner only
+	bool isHalfFull() const
+	{
+		return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed)
+			> RING_CAPACITY / 2;
+	}
+
+	template <typename TFunc>
+	void drain(TFunc &&func)
+	{
+		uint64 head = m_head.load(std::memory_order_relaxed);
+		const uint64 tail = m_tail.load(std::memory_order_acquire);
+
+		while (head != tail)
+		{
+			const uint64 offset = head & MASK;
+			uint32 size;
+			std::memcpy(&size, m_data.get() + offset, sizeof(size));
+
+			if (size == 0)
+			{
+				head += RING_CAPACITY - offset;
+				continue;
+			}
+
+			func(m_data.get() + offset);
+			head += size;
+		}
+
+		m_head.store(head, std::memory_order_release);
+	}
+
+	void setOrphaned()
+	{
+		m_orphaned.store(true, std::memory_order_release);
+	}
+
+	bool isOrphaned() const
+	{
+		return m_orphaned.load(std::memory_order_acquire);
+	}
+
+private:
+	inline static constexpr uint64 MASK = RING_CAPACITY - 1;
+
+	static_assert((RING_CAPACITY & MASK) == 0, "Capacity must be a power of two");
+
+	// The producer and the consumer write to different cache lines
+	std::atomic<uint64> m_head;
+	std::unique_ptr<byte[]> m_data;
+	std::atomic<bool> m_orphaned;
+	AR_PAD(47);
+	std::atomic<uint64> m_tail;
+};
+
+// Set once the ring of the thread is handed back, trivially destructible, so the destructors
+// which run after s_ringOwner may still read it
+thread_local bool s_ringReleased = false;
+
+// Hands the ring of an exited thread back to the log thread, which frees it once it is drained
+struct RingOwner
+{
+	~RingOwner()
+	{
+		if (m_ring && !s_destroyed.load(std::memory_order_acquire))
+		{
+			m_ring->setOrphaned();
+		}
+
+		s_ringReleased = true;
+	}
+
+	RecordRing *m_ring = nullptr;
+};
+
+thread_local RingOwner s_ringOwner;
+
+// Without a ring, for the exiting threads and the destructors which run after the logger
+void formatMessage(const LogSite &site, const LogArgument *arguments, sizet count, std::string &out)
+{
+	sizet numArguments;
+	const sizet size = getRecordSize(arguments, count, numArguments);
+	std::vector<byte> record(size);
+	encodeRecord(record.data(), size, getTime(), site, arguments, numArguments);
+
+	formatRecord(record.data(), out);
+}
+
+class Logger final
+	: NonCopyable
+{
+public:
+	Logger()
+		: m_file(nullptr)
+		, m_wakeRequested(false)
+		, m_stop(false)
+		, m_flushRequested(0)
+		, m_flushDone(0)
+	{
+		m_thread = std::thread(&Logger::_run, this);
+	}
+
+	~Logger()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+
+		m_wake.notify_one();
+		m_thread.join();
+		s_destroyed.store(true, std::memory_order_release);
+
+		if (m_file)
+		{
+			std::fclose(m_file);
+		}
+	}
+
+	void push(const LogSite &site, const LogArgument *arguments, sizet count)
+	{
+		// The thread logs from a destructor which runs after its ring was handed back,
+		// the earlier records of the thread are written first
+		if (s_ringReleased)
+		{
+			flush();
+
+			std::string line;
+			formatMessage(site, arguments, count, line);
+			_write(line);
+			return;
+		}
+
+		sizet numArguments;
+		const sizet size = getRecordSize(arguments, count, numArguments);
+
+		RecordRing &ring = _getRing();
+		uint64 newTail;
+		byte *record;
+
+		// The ring is full, the log thread has to catch up
+		while (!(record = ring.reserve(size, newTail)))
+		{
+			_wake();
+			std::this_thread::yield();
+		}
+
+		encodeRecord(record, size, getTime(), site, arguments, numArguments);
+		ring.commit(newTail);
+
+		if (site.m_level == LogLevel::Error || ring.isHalfFull())
+		{
+			_wake();
+		}
+	}
+
+	bool setFile(const std::string &path)
+	{
+		std::FILE *file = path.empty() ? nullptr : std::fopen(path.c_str(), "w");
+		if (!path.empty() && !file)
+		{
+			return false;
+		}
+
+		flush();
+
+		std::lock_guard<std::mutex> lock(m_fileMutex);
+		if (m_file)
+		{
+			std::fclose(m_file);
+		}
+		m_file = file;
+
+		return true;
+	}
+
+	void flush()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		const uint64 request = ++m_flushRequested;
+		m_wakeRequested.store(true, std::memory_order_release);
+		m_wake.notify_one();
+		m_flushed.wait(lock, [this, request] { return m_flushDone >= request; });
+	}
+
+private:
+	struct Entry
+	{
+		int64 m_time;
+		const byte *m_record;
+	};
+
+	RecordRing& _getRing()
+	{
+		if (!s_ringOwner.m_ring)
+		{
+			std::lock_guard<std::mutex> lock(m_ringsMutex);
+			m_rings.push_back(std::make_unique<RecordRing>());
+			s_ringOwner.m_ring = m_rings.back().get();
+		}
+
+		return *s_ringOwner.m_ring;
+	}
+
+	// Without m_mutex, so the threads which log never wait for the writes. The notification may
+	// come before the log thread waits, then the wake up is late by WRITE_INTERVAL at most.
+	void _wake()
+	{
+		if (!m_wakeRequested.exchange(true, std::memory_order_acq_rel))
+		{
+			m_wake.notify_one();
+		}
+	}
+
+	void _run()
+	{
+		std::vector<byte> records;
+		std::vector<Entry> entries;
+		std::string batch;
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for (;;)
+		{
+			m_wake.wait_for(lock, WRITE_INTERVAL, [this]
+			{
+				return m_wakeRequested.load(std::memory_order_acquire) || m_stop;
+			});
+
+			// Reset before the drain, a wake up for the records committed after it is kept
+			m_wakeRequested.exchange(false, std::memory_order_acq_rel);
+
+			const bool stop = m_stop;
+			const uint64 flushRequest = m_flushRequested;
+			lock.unlock();
+
+			_collect(records, entries);
+
+			// The rings are drained one after another, the records are merged by the time
+			std::stable_sort(entries.begin(), entries.end(), [](const Entry &lhs, const Entry &rhs)
+			{
+				return lhs.m_time < rhs.m_time;
+			});
+
+			batch.clear();
+			for (const auto &entry : entries)
+			{
+				formatRecord(entry.m_record, batch);
+			}
+
+			_write(batch);
+
+			lock.lock();
+			m_flushDone = flushRequest;
+			m_flushed.notify_all();
+
+			if (stop)
+			{
+				break;
+			}
+		}
+	}
+
+	void _collect(std::vector<byte> &records, std::vector<Entry> &entries)
+	{
+		records.clear();
+		entries.clear();
+
+		std::lock_guard<std::mutex> lock(m_ringsMutex);
+		for (auto it = m_rings.begin(); it != m_rings.end();)
+		{
+			// The thread cannot write after it is orphaned, so the ring is empty after the drain
+			const bool orphaned = (*it)->isOrphaned();
+
+			(*it)->drain([&records](const byte *record)
+			{
+				uint32 size;
+				std::memcpy(&size, record, sizeof(size));
+				records.insert(records.end(), record, record + size);
+			});
+
+			it = orphaned ? m_rings.erase(it) : it + 1;
+		}
+
+		// Offsets first, the storage is reallocated while it is filled
+		for (sizet offset = 0; offset < records.size();)
+		{
+			RecordHeader header;
+			std::memcpy(&header, records.data() + offset, sizeof(header));
+			entries.push_back({header.m_time, records.data() + offset});
+			offset += header.m_size;
+		}
+	}
+
+	void _write(const std::string &batch)
+	{
+		if (batch.empty())
+		{
+			return;
+		}
+
+		// Only setFile waits for the writes
+		std::lock_guard<std::mutex> lock(m_fileMutex);
+
+		std::fwrite(batch.data(), 1, batch.size(), stderr);
+		std::fflush(stderr);
+
+		if (m_file)
+		{
+			std::fwrite(batch.data(), 1, batch.size(), m_file);
+			std::fflush(m_file);
+		}
+	}
+
+	std::mutex m_fileMutex;
+	std::FILE *m_file;
+
+	std::mutex m_ringsMutex;
+	std::vector<std::unique_ptr<RecordRing>> m_rings;
+
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_flushed;
+	std::atomic<bool> m_wakeRequested;
+	bool m_stop;
+	AR_PAD(6);
+	uint64 m_flushRequested;
+	uint64 m_flushDone;
+
+	std::thread m_thread;
+};
+
+Logger& getLogger()
+{
+	static Logger s_logger;
+	return s_logger;
+}
+} // namespace
+
+void setLogLevel(LogLevel level)
+{
+	s_level.store(static_cast<uint32>(level), std::memory_order_relaxed);
+}
+
+LogLevel getLogLevel()
+{
+	return static_cast<LogLevel>(s_level.load(std::memory_order_relaxed));
+}
+
+bool setLogFile(const std::string &path)
+{
+	return getLogger().setFile(path);
+}
+
+void flushLog()
+{
+	if (!s_destroyed.load(std::memory_order_acquire))
+	{
+		getLogger().flush();
+	}
+}
+
+void pushLogMessage(const LogSite &site, const LogArgument *arguments, sizet count)
+{
+	if (!s_destroyed.load(std::memory_order_acquire))
+	{
+		getLogger().push(site, arguments, count);
+		return;
+	}
+
+	// Static destructors which run after the logger
+	std::string line;
+	formatMessage(site, arguments, count, line);
+	std::fwrite(line.data(), 1, line.size(), stderr);
+}
+} // namespace argon::debug
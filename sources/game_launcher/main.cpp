@@ -8,7 +8,7 @@ int main(int argc, char *argv[])
 {
 	if (argc == 0)
 	{
-		argon::debug::errorMsg("Cannot extract working directory");
+		AR_LOG_ERROR("Cannot extract working directory");
 		return 0;
 	}
 
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
+#include <fundamental/helper_macros.hpp>
+#include <fundamental/types.hpp>
+
+#include "forward_declarations.hpp"
+#include "matrix4.hpp"
+#include "vector3.hpp"
+#include "vector4.hpp"
+
+namespace argon::math
+{
+// Affine Matrix4 tagged with the kind of the transformation. The inverse and the product pick
+// the cheapest Matrix4 path for the kind, the last row is never computed.
+AR_ATTR_ALIGN(16) class AR_SYM_EXPORT AffineTransform final
+{
+public:
+	enum class Kind : uint8
+	{
+		// Rotation and translation only
+		Rigid,
+		// Any affine transformation, e.g. with scaling
+		General
+	};
+
+	AffineTransform();
+	AR_VEC_CALL AffineTransform(const AffineTransform &other);
+	explicit AR_VEC_CALL AffineTransform(const Quaternion &rotation, const Vector3 &trans);
+	// Rigid, if the scaling is (1, 1, 1)
+	explicit AR_VEC_CALL AffineTransform(const Quaternion &rotation, const Vector3 &scaling,
+		const Vector3 &trans);
+	// The matrix has to be affine, Kind::Rigid is not verified in release builds
+	explicit AR_VEC_CALL AffineTransform(const Matrix4 &m, Kind kind = Kind::General);
+
+	AffineTransform& AR_VEC_CALL operator=(const AffineTransform &other);
+
+	const Matrix4& AR_VEC_CALL getMatrix4() const;
+	Kind getKind() const;
+	bool isRigid() const;
+
+	AffineTransform AR_VEC_CALL getInverted(void) const;
+	AffineTransform& AR_VEC_CALL invert(void);
+
+	// The product is rigid, if both transforms are rigid
+	AffineTransform AR_VEC_CALL operator*(const AffineTransform &other) const;
+	AffineTransform& AR_VEC_CALL operator*=(const AffineTransform &other);
+
+	// Transforms a point
+	Vector3 AR_VEC_CALL operator*(const Vector3 &v) const;
+
+private:
+	Matrix4 m_matrix;
+	Kind m_kind;
+	AR_PAD(15);
+};
+
+AR_FORCE_INLINE AffineTransform::AffineTransform()
+	: m_matrix(Matrix4::c_identity)
+	, m_kind(Kind::Rigid)
+{
+}
+
+AR_FORCE_INLINE AR_VEC_CALL AffineTransform::AffineTransform(const AffineTransform &other)
+	: m_matrix(other.m_matrix)
+	, m_kind(other.m_kind)
+{
+}
+
+AR_FORCE_INLINE AR_VEC_CALL AffineTransform::AffineTransform(const Matrix4 &m, Kind kind)
+	: m_matrix(m)
+	, m_kind(kind)
+{
+	AR_ASSERT_MSG(m[3] == Vector4::c_wAxis, "The matrix is not affine");
+}
+
+AR_FORCE_INLINE AffineTransform& AR_VEC_CALL AffineTransform::operator=(
+	const AffineTransform &other)
+{
+	m_matrix = other.m_matrix;
+	m_kind = other.m_kind;
+
+	return *this;
+}
+
+AR_FORCE_INLINE const Matrix4& AR_VEC_CALL AffineTransform::getMatrix4() const
+{
+	return m_matrix;
+}
+
+AR_FORCE_INLINE AffineTransform::Kind AffineTransform::getKind() const
+{
+	return m_kind;
+}
+
+AR_FORCE_INLINE bool AffineTransform::isRigid() const
+{
+	return m_kind == Kind::Rigid;
+}
+
+AR_FORCE_INLINE AffineTransform AR_VEC_CALL AffineTransform::getInverted(void) const
+{
+	return AffineTransform(isRigid()
+		? m_matrix.getInvertedOrthonormal()
+		: m_matrix.getInvertedAffine(), m_kind);
+}
+
+AR_FORCE_INLINE AffineTransform& AR_VEC_CALL AffineTransform::invert(void)
+{
+	*this = getInverted();
+
+	return *this;
+}
+
+AR_FORCE_INLINE AffineTransform AR_VEC_CALL AffineTransform::operator*(
+	const AffineTransform &other) const
+{
+	return AffineTransform(m_matrix.multiplyAffine(other.m_matrix),
+		isRigid() && other.isRigid() ? Kind::Rigid : Kind::General);
+}
+
+AR_FORCE_INLINE AffineTransform& AR_VEC_CALL AffineTransform::operator*=(
+	const AffineTransform &other)
+{
+	*this = *this * other;
+
+	return *this;
+}
+
+AR_FORCE_INLINE Vector3 AR_VEC_CALL AffineTransform::operator*(const Vector3 &v) const
+{
+	return m_matrix * v;
+}
+} // namespace argon::math
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/types.hpp>
+
+#include "bounds_x8.hpp"
+#include "forward_declarations.hpp"
+#include "quaternion_x8.hpp"
+#include "vector3x8.hpp"
+
+// Operations on arrays of math types. The kernels are picked once at runtime: AVX2 with FMA,
+// AVX or the per-object implementation when neither is supported. The destination may be
+// the same array as a source.
+namespace argon::math
+{
+enum class BatchKernels : uint32
+{
+	Fallback = 0,
+	Avx,
+	// AVX2 with FMA
+	Fma
+};
+
+// Kernels used by the operations, the best ones for the processor unless replaced
+AR_SYM_EXPORT BatchKernels getBatchKernels();
+// Replaces the picked kernels, so the tests can compare every implementation. Returns false and
+// keeps the current kernels if the processor does not support the requested ones. Must not run
+// concurrently with the batch operations.
+AR_SYM_EXPORT bool setBatchKernels(BatchKernels kernels);
+
+// dst[i] = m * src[i], the points are translated
+AR_SYM_EXPORT void transformPoints(const Matrix4 &m, const Vector3 *src, Vector3 *dst,
+	sizet count);
+AR_SYM_EXPORT void transformPoints(const Matrix4 &m, const Vector3x8 *src, Vector3x8 *dst,
+	sizet count);
+
+// dst[i] = lhs[i] * rhs[i]
+AR_SYM_EXPORT void multiplyBatch(const Matrix4 *lhs, const Matrix4 *rhs, Matrix4 *dst,
+	sizet count);
+
+// dst[i] = from[i].slerp(to[i], t) for every lane, t is in [0, 1]
+AR_SYM_EXPORT void slerpBatch(const QuaternionX8 *from, const QuaternionX8 *to, float32 t,
+	QuaternionX8 *dst, sizet count);
+
+// Write the indices of the bounds intersecting the frustum to visible in increasing order and
+// return their number. count is the number of bounds, not blocks, the lanes past it in the last
+// block are ignored. visible has room for count indices.
+AR_SYM_EXPORT sizet cullSpheres(const Frustum &frustum, const SphereX8 *spheres, sizet count,
+	uint32 *visible);
+AR_SYM_EXPORT sizet cullAabbs(const Frustum &frustum, const AabbX8 *boxes, sizet count,
+	uint32 *visible);
+} // namespace argon::math
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
+#include <fundamental/helper_macros.hpp>
+#include <fundamental/types.hpp>
+
+#include "forward_declarations.hpp"
+#include "vector3.hpp"
+#include "vector4.hpp"
+
+namespace argon::math
+{
+// normal.dot(p) + d = 0, the points with a positive distance are in front of the plane
+AR_ATTR_ALIGN(16) class AR_SYM_EXPORT Plane final
+{
+public:
+	Plane();
+	explicit AR_VEC_CALL Plane(const Vector3 &normal, float32 d);
+	// The plane through the point
+	explicit AR_VEC_CALL Plane(const Vector3 &normal, const Vector3 &point);
+	// (normal, d)
+	explicit AR_VEC_CALL Plane(const Vector4 &coefficients);
+
+	Vector3 AR_VEC_CALL getNormal() const;
+	float32 AR_VEC_CALL getD() const;
+	const Vector4& AR_VEC_CALL getCoefficients() const;
+
+	// Scales the coefficients, so the normal has unit length
+	Plane& AR_VEC_CALL normalize(void);
+	Plane AR_VEC_CALL getNormalized(void) const;
+
+	// In the units of the normal's length
+	float32 AR_VEC_CALL getSignedDistance(const Vector3 &point) const;
+
+private:
+	Vector4 m_coefficients;
+};
+
+AR_ATTR_ALIGN(16) class AR_SYM_EXPORT Sphere final
+{
+public:
+	Sphere();
+	explicit AR_VEC_CALL Sphere(const Vector3 &center, float32 radius);
+
+	const Vector3& AR_VEC_CALL getCenter() const;
+	float32 AR_VEC_CALL getRadius() const;
+
+	bool AR_VEC_CALL contains(const Vector3 &point) const;
+	bool AR_VEC_CALL intersects(const Sphere &other) const;
+
+private:
+	Vector3 m_center;
+	float32 m_radius;
+	AR_PAD(12);
+};
+
+// Axis aligned bounding box
+AR_ATTR_ALIGN(16) class AR_SYM_EXPORT Aabb final
+{
+public:
+	// Inverted box, which becomes valid with the first merge
+	static const Aabb AR_ATTR_ALIGN(16) c_empty;
+
+	Aabb();
+	explicit AR_VEC_CALL Aabb(const Vector3 &min, const Vector3 &max);
+
+	const Vector3& AR_VEC_CALL getMin() const;
+	const Vector3& AR_VEC_CALL getMax() const;
+	Vector3 AR_VEC_CALL getCenter() const;
+	// Half of the size
+	Vector3 AR_VEC_CALL getExtents() const;
+
+	bool isEmpty(void) const;
+	bool AR_VEC_CALL contains(const Vector3 &point) const;
+	bool AR_VEC_CALL intersects(const Aabb &other) const;
+
+	Aabb& AR_VEC_CALL merge(const Vector3 &point);
+	Aabb& AR_VEC_CALL merge(const Aabb &other);
+
+	// The box around the transformed box
+	Aabb AR_VEC_CALL getTransformed(const Matrix4 &m) const;
+
+private:
+	Vector3 m_min;
+	Vector3 m_max;
+};
+
+// Planes of the view volume, the normals point inside. The clip space is the one of
+// Matrix4::setPerspectiveFovLH and Matrix4::setOrthographicLH: x and y in [-w, w], z in [0, w].
+AR_ATTR_ALIGN(16) class AR_SYM_EXPORT Frustum final
+{
+public:
+	enum class Side : int32
+	{
+		Left = 0,
+		Right,
+		Bottom,
+		Top,
+		Near,
+		Far
+	};
+
+	inline static constexpr int32 NUM_SIDES = 6;
+
+	Frustum();
+	explicit AR_VEC_CALL Frustum(const Matrix4 &viewProjection);
+
+	// Extracts the normalized planes from the rows of the matrix
+	void AR_VEC_CALL set(const Matrix4 &viewProjection);
+
+	const Plane& AR_VEC_CALL getPlane(Side side) const;
+
+	bool AR_VEC_CALL isVisible(const Vector3 &point) const;
+	bool AR_VEC_CALL isVisible(const Sphere &sphere) const;
+	// Conservative, a box outside of the frustum next to its edges may pass
+	bool AR_VEC_CALL isVisible(const Aabb &box) const;
+
+private:
+	Plane m_planes[NUM_SIDES];
+};
+
+AR_FORCE_INLINE Plane::Plane()
+{
+}
+
+AR_FORCE_INLINE AR_VEC_CALL Plane::Plane(const Vector3 &normal, float32 d)
+	: m_coefficients(normal[0], normal[1], normal[2], d)
+{
+}
+
+AR_FORCE_INLINE AR_VEC_CALL Plane::Plane(const Vector3 &normal, const Vector3 &point)
+	: m_coefficients(normal[0], normal[1], normal[2], -normal.dot(point))
+{
+}
+
+AR_FORCE_INLINE AR_VEC_CALL Plane::Plane(const Vector4 &coefficients)
+	: m_coefficients(coefficients)
+{
+}
+
+AR_FORCE_INLINE Vector3 AR_VEC_CALL Plane::getNormal() const
+{
+	return Vector3(m_coefficients[0], m_coefficients[1], m_coefficients[2]);
+}
+
+AR_FORCE_INLINE float32 AR_VEC_CALL Plane::getD() const
+{
+	return m_coefficients[3];
+}
+
+AR_FORCE_INLINE const Vector4& AR_VEC_CALL Plane::getCoefficients() const
+{
+	return m_coefficients;
+}
+
+AR_FORCE_INLINE Plane& AR_VEC_CALL Plane::normalize(void)
+{
+	const float32 length = getNormal().getLength();
+	AR_ASSERT_MSG(length != 0.f, "Normal is zero");
+
+	m_coefficients *= 1.f / length;
+
+	return *this;
+}
+
+AR_FORCE_INLINE Plane AR_VEC_CALL Plane::getNormalized(void) const
+{
+	return Plane(*this).normalize();
+}
+
+AR_FORCE_INLINE float32 AR_VEC_CALL Plane::getSignedDistance(const Vector3 &point) const
+{
+	// The w of the point is 1
+	return m_coefficients.dot(point);
+}
+
+AR_FORCE_INLINE Sphere::Sphere()
+{
+}
+
+AR_FORCE_INLINE AR_VEC_CALL Sphere::Sphere(const Vector3 &center, float32 radius)
+	: m_center(center)
+	, m_radius(radius)
+{
+	AR_ASSERT_MSG(radius >= 0.f, "Radius is negative");
+}
+
+AR_FORCE_INLINE const Vector3& AR_VEC_CALL Sphere::getCenter() const
+{
+	return m_center;
+}
+
+AR_FORCE_INLINE float32 AR_VEC_CALL Sphere::getRadius() const
+{
+	return m_radius;
+}
+
+AR_FORCE_INLINE bool AR_VEC_CALL Sphere::contains(const Vector3 &point) const
+{
+	return m_center.getDistanceSq(point) <= m_radius * m_radius;
+}
+
+AR_FORCE_INLINE bool AR_VEC_CALL Sphere::intersects(const Sphere &other) const
+{
+	const float32 radii = m_radius + other.m_radius;
+	return m_center.getDistanceSq(other.m_center) <= radii * radii;
+}
+
+AR_FORCE_INLINE Aabb::Aabb()
+{
+}
+
+AR_FORCE_INLINE AR_VEC_CALL Aabb::Aabb(const Vector3 &min, const Vector3 &max)
+	: m_min(min)
+	, m_max(max)
+{
+}
+
+AR_FORCE_INLINE const Vector3& AR_VEC_CALL Aabb::getMin() const
+{
+	return m_min;
+}
+
+AR_FORCE_INLINE const Vector3& AR_VEC_CALL Aabb::getMax() const
+{
+	return m_max;
+}
+
+AR_FORCE_INLINE Vector3 AR_VEC_CALL Aabb::getCenter() const
+{
+	return (m_min + m_max) * 0.5f;
+}
+
+AR_FORCE_INLINE Vector3 AR_VEC_CALL Aabb::getExtents() const
+{
+	return (m_max - m_min) * 0.5f;
+}
+
+AR_FORCE_INLINE bool Aabb::isEmpty(void) const
+{
+	return m_min[0] > m_max[0] || m_min[1] > m_max[1] || m_min[2] > m_max[2];
+}
+
+AR_FORCE_INLINE bool AR_VEC_CALL Aabb::contains(const Vector3 &point) const
+{
+	return m_min[0] <= point[0] && point[0] <= m_max[0]
+		&& m_min[1] <= point[1] && point[1] <= m_max[1]
+		&& m_min[2] <= point[2] && point[2] <= m_max[2];
+}
+
+AR_FORCE_INLINE bool AR_VEC_CALL Aabb::intersects(const Aabb &other) const
+{
+	return m_min[0] <= other.m_max[0] && other.m_min[0] <= m_max[0]
+		&& m_min[1] <= other.m_max[1] && other.m_min[1] <= m_max[1]
+		&& m_min[2] <= other.m_max[2] && other.m_min[2] <= m_max[2];
+}
+
+AR_FORCE_INLINE Frustum::Frustum()
+{
+}
+
+AR_FORCE_INLINE AR_VEC_CALL Frustum::Frustum(const Matrix4 &viewProjection)
+{
+	set(viewProjection);
+}
+
+AR_FORCE_INLINE const Plane& AR_VEC_CALL Frustum::getPlane(Side side) const
+{
+	return m_planes[static_cast<int32>(side)];
+}
+} // namespace argon::math
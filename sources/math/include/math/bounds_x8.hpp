@@ -0,0 +1,55 @@
+#pragma once
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/types.hpp>
+
+#include "forward_declarations.hpp"
+
+namespace argon::math
+{
+// Eight spheres with the components stored separately, see Vector3x8
+struct AR_SYM_EXPORT SphereX8 final
+{
+	inline static constexpr int32 LANES = 8;
+
+	SphereX8();
+	explicit SphereX8(const Sphere *s);
+
+	// Gathers LANES spheres
+	void load(const Sphere *s);
+	// Scatters LANES spheres
+	void store(Sphere *s) const;
+
+	Sphere getLane(int32 i) const;
+	void setLane(int32 i, const Sphere &s);
+
+	alignas(32) float32 m_x[LANES];
+	float32 m_y[LANES];
+	float32 m_z[LANES];
+	float32 m_radius[LANES];
+};
+
+// Eight boxes as centers and extents, the form the plane tests work with
+struct AR_SYM_EXPORT AabbX8 final
+{
+	inline static constexpr int32 LANES = 8;
+
+	AabbX8();
+	explicit AabbX8(const Aabb *b);
+
+	// Gathers LANES boxes
+	void load(const Aabb *b);
+	// Scatters LANES boxes
+	void store(Aabb *b) const;
+
+	Aabb getLane(int32 i) const;
+	void setLane(int32 i, const Aabb &b);
+
+	alignas(32) float32 m_centerX[LANES];
+	float32 m_centerY[LANES];
+	float32 m_centerZ[LANES];
+	float32 m_extentX[LANES];
+	float32 m_extentY[LANES];
+	float32 m_extentZ[LANES];
+};
+} // namespace argon::math
@@ -2,9 +2,14 @@
 
 namespace argon::math
 {
+class Aabb;
+class AffineTransform;
+class Frustum;
 class Matrix3;
 class Matrix4;
+class Plane;
 class Quaternion;
+class Sphere;
 class Vector2;
 class Vector3;
 class Vector4;
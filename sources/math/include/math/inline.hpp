@@ -0,0 +1,12 @@
+#pragma once
+
+#include <fundamental/compiler_macros.hpp>
+
+// The hot operations of the vectors, quaternions and matrices are defined in their headers.
+// exported_inlines.cpp compiles them once more out of line, so the library keeps exporting
+// them for the binaries linked against the versions which were not inlined.
+#ifdef AR_MATH_EXPORT_INLINES
+#define AR_MATH_INLINE
+#else
+#define AR_MATH_INLINE AR_FORCE_INLINE
+#endif // ifdef AR_MATH_EXPORT_INLINES
@@ -1,15 +1,17 @@
 #pragma once
 
 #include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
 #include <fundamental/types.hpp>
 
 #include "forward_declarations.hpp"
+#include "inline.hpp"
 #include "simd.hpp"
 #include "vector3.hpp"
 
 namespace argon::math
 {
-AR_ATTR_ALIGN(16) class Matrix3 final
+AR_ATTR_ALIGN(16) class AR_SYM_EXPORT Matrix3 final
 {
 public:
 	static const Matrix3 AR_ATTR_ALIGN(16) c_identity;
@@ -90,4 +92,230 @@ private:
 
 	Vector3 m_rows[3];
 };
+
+AR_MATH_INLINE Matrix3::Matrix3()
+{
+}
+
+AR_MATH_INLINE AR_VEC_CALL Matrix3::Matrix3(const Matrix3 &other)
+{
+	m_rows[0] = other.m_rows[0];
+	m_rows[1] = other.m_rows[1];
+	m_rows[2] = other.m_rows[2];
+}
+
+AR_MATH_INLINE AR_VEC_CALL Matrix3::Matrix3(
+		float32 e00, float32 e01, float32 e02,
+		float32 e10, float32 e11, float32 e12,
+		float32 e20, float32 e21, float32 e22)
+{
+	m_rows[0].set(e00, e01, e02);
+	m_rows[1].set(e10, e11, e12);
+	m_rows[2].set(e20, e21, e22);
+}
+
+AR_MATH_INLINE AR_VEC_CALL Matrix3::Matrix3(const Vector3 &v0, const Vector3 &v1,
+														 const Vector3 &v2)
+{
+	m_rows[0] = v0;
+	m_rows[1] = v1;
+	m_rows[2] = v2;
+}
+
+#ifdef AR_SIMD
+AR_MATH_INLINE AR_VEC_CALL Matrix3::Matrix3(__m128 v0, __m128 v1, __m128 v2)
+{
+	m_rows[0] = Vector3(v0);
+	m_rows[1] = Vector3(v1);
+	m_rows[2] = Vector3(v2);
+}
+#endif // ifdef AR_SIMD
+
+AR_MATH_INLINE Matrix3& AR_VEC_CALL Matrix3::operator=(const Matrix3 &other)
+{
+	m_rows[0] = other.m_rows[0];
+	m_rows[1] = other.m_rows[1];
+	m_rows[2] = other.m_rows[2];
+
+	return *this;
+}
+
+AR_MATH_INLINE Vector3 AR_VEC_CALL Matrix3::getColumn(int32 i) const
+{
+	AR_ASSERT_MSG(0 <= i && i < 3, "Index is out of range");
+
+	return Vector3(m_rows[0][i], m_rows[1][i], m_rows[2][i]);
+}
+
+AR_MATH_INLINE void AR_VEC_CALL Matrix3::setColumn(int32 i, const Vector3 &v)
+{
+	AR_ASSERT_MSG(0 <= i && i < 3, "Index is out of range");
+
+	m_rows[0][i] = v[0];
+	m_rows[1][i] = v[1];
+	m_rows[2][i] = v[2];
+}
+
+AR_MATH_INLINE Vector3& AR_VEC_CALL Matrix3::operator[](int32 i)
+{
+	AR_ASSERT_MSG(0 <= i && i < 3, "Index is out of range");
+
+	return m_rows[i];
+}
+
+AR_MATH_INLINE const Vector3& AR_VEC_CALL Matrix3::operator[](int32 i) const
+{
+	AR_ASSERT_MSG(0 <= i && i < 3, "Index is out of range");
+
+	return m_rows[i];
+}
+
+AR_MATH_INLINE Matrix3 AR_VEC_CALL Matrix3::operator+(const Matrix3 &other) const
+{
+	return Matrix3(m_rows[0] + other.m_rows[0], m_rows[1] + other.m_rows[1],
+		m_rows[2] + other.m_rows[2]);
+}
+
+AR_MATH_INLINE Matrix3 AR_VEC_CALL Matrix3::operator-(const Matrix3 &other) const
+{
+	return Matrix3(m_rows[0] - other.m_rows[0], m_rows[1] - other.m_rows[1],
+		m_rows[2] - other.m_rows[2]);
+}
+
+AR_MATH_INLINE Matrix3 AR_VEC_CALL Matrix3::operator*(const Matrix3 &other) const
+{
+#ifdef AR_SIMD
+	const __m128 tv0 = m_rows[0].get128();
+	const __m128 tv1 = m_rows[1].get128();
+	const __m128 tv2 = m_rows[2].get128();
+	const __m128 mv0 = other.m_rows[0].get128();
+	const __m128 mv1 = other.m_rows[1].get128();
+	const __m128 mv2 = other.m_rows[2].get128();
+
+	__m128 v00 = _mm_shuffle_ps(tv0, tv0, 0x0);
+	__m128 v01 = _mm_shuffle_ps(tv0, tv0, 0x55);
+	__m128 v02 = _mm_shuffle_ps(tv0, tv0, 0xAA);
+
+	v00 = _mm_mul_ps(v00, mv0);
+	v01 = _mm_mul_ps(v01, mv1);
+	v02 = _mm_mul_ps(v02, mv2);
+
+	__m128 v10 = _mm_shuffle_ps(tv1, tv1, 0x0);
+	__m128 v11 = _mm_shuffle_ps(tv1, tv1, 0x55);
+	__m128 v12 = _mm_shuffle_ps(tv1, tv1, 0xAA);
+
+	v10 = _mm_mul_ps(v10, mv0);
+	v11 = _mm_mul_ps(v11, mv1);
+	v12 = _mm_mul_ps(v12, mv2);
+
+	__m128 v20 = _mm_shuffle_ps(tv2, tv2, 0x0);
+	__m128 v21 = _mm_shuffle_ps(tv2, tv2, 0x55);
+	__m128 v22 = _mm_shuffle_ps(tv2, tv2, 0xAA);
+
+	v20 = _mm_mul_ps(v20, mv0);
+	v21 = _mm_mul_ps(v21, mv1);
+	v22 = _mm_mul_ps(v22, mv2);
+
+	return Matrix3(_mm_add_ps(v00, _mm_add_ps(v01, v02)),
+								 _mm_add_ps(v10, _mm_add_ps(v11, v12)),
+								 _mm_add_ps(v20, _mm_add_ps(v21, v22)));
+#else
+	return Matrix3(
+			m_rows[0].dot(other.getColumn(0)), m_rows[0].dot(other.getColumn(1)),
+				m_rows[0].dot(other.getColumn(2)),
+			m_rows[1].dot(other.getColumn(0)), m_rows[1].dot(other.getColumn(1)),
+				m_rows[1].dot(other.getColumn(2)),
+			m_rows[2].dot(other.getColumn(0)), m_rows[2].dot(other.getColumn(1)),
+				m_rows[2].dot(other.getColumn(2)));
+#endif // ifdef AR_SIMD
+}
+
+AR_MATH_INLINE Matrix3& AR_VEC_CALL Matrix3::operator*=(const Matrix3 &other)
+{
+#ifdef AR_SIMD
+	const __m128 tv0 = m_rows[0].get128();
+	const __m128 tv1 = m_rows[1].get128();
+	const __m128 tv2 = m_rows[2].get128();
+	__m128 mv0 = other.m_rows[0].get128();
+	__m128 mv1 = other.m_rows[1].get128();
+	__m128 mv2 = other.m_rows[2].get128();
+
+	__m128 v00 = _mm_shuffle_ps(tv0, tv0, 0x0);
+	__m128 v01 = _mm_shuffle_ps(tv0, tv0, 0x55);
+	__m128 v02 = _mm_shuffle_ps(tv0, tv0, 0xAA);
+
+	v00 = _mm_mul_ps(v00, mv0);
+	v01 = _mm_mul_ps(v01, mv1);
+	v02 = _mm_mul_ps(v02, mv2);
+
+	__m128 v10 = _mm_shuffle_ps(tv1, tv1, 0x0);
+	__m128 v11 = _mm_shuffle_ps(tv1, tv1, 0x55);
+	__m128 v12 = _mm_shuffle_ps(tv1, tv1, 0xAA);
+
+	v10 = _mm_mul_ps(v10, mv0);
+	v11 = _mm_mul_ps(v11, mv1);
+	v12 = _mm_mul_ps(v12, mv2);
+
+	__m128 v20 = _mm_shuffle_ps(tv2, tv2, 0x0);
+	__m128 v21 = _mm_shuffle_ps(tv2, tv2, 0x55);
+	__m128 v22 = _mm_shuffle_ps(tv2, tv2, 0xAA);
+
+	v20 = _mm_mul_ps(v20, mv0);
+	v21 = _mm_mul_ps(v21, mv1);
+	v22 = _mm_mul_ps(v22, mv2);
+
+	m_rows[0] = Vector3(_mm_add_ps(v00, _mm_add_ps(v01, v02)));
+	m_rows[1] = Vector3(_mm_add_ps(v10, _mm_add_ps(v11, v12)));
+	m_rows[2] = Vector3(_mm_add_ps(v20, _mm_add_ps(v21, v22)));
+#else
+	set(
+		m_rows[0].dot(other.getColumn(0)), m_rows[0].dot(other.getColumn(1)),
+			m_rows[0].dot(other.getColumn(2)),
+		m_rows[1].dot(other.getColumn(0)), m_rows[1].dot(other.getColumn(1)),
+			m_rows[1].dot(other.getColumn(2)),
+		m_rows[2].dot(other.getColumn(0)), m_rows[2].dot(other.getColumn(1)),
+			m_rows[2].dot(other.getColumn(2)));
+#endif // ifdef AR_SIMD
+
+	return *this;
+}
+
+AR_MATH_INLINE Matrix3& AR_VEC_CALL Matrix3::operator+=(const Matrix3 &other)
+{
+	m_rows[0] += other.m_rows[0];
+	m_rows[1] += other.m_rows[1];
+	m_rows[2] += other.m_rows[2];
+
+	return *this;
+}
+
+AR_MATH_INLINE Matrix3& AR_VEC_CALL Matrix3::operator-=(const Matrix3 &other)
+{
+	m_rows[0] -= other.m_rows[0];
+	m_rows[1] -= other.m_rows[1];
+	m_rows[2] -= other.m_rows[2];
+
+	return *this;
+}
+
+AR_MATH_INLINE Matrix3 AR_VEC_CALL Matrix3::operator*(float32 s) const
+{
+	return Matrix3(m_rows[0] * s, m_rows[1] * s, m_rows[2] * s);
+}
+
+AR_MATH_INLINE Vector3 AR_VEC_CALL Matrix3::operator*(const Vector3 &v) const
+{
+	return Vector3(m_rows[0].dot(v), m_rows[1].dot(v), m_rows[2].dot(v));
+}
+
+AR_MATH_INLINE bool AR_VEC_CALL Matrix3::operator==(const Matrix3 &other) const
+{
+	return (m_rows[0] == other.m_rows[0]) && (m_rows[1] == other.m_rows[1])
+		&& (m_rows[2] == other.m_rows[2]);
+}
+
+AR_MATH_INLINE bool AR_VEC_CALL Matrix3::operator!=(const Matrix3 &other) const
+{
+	return !(*this == other);
+}
 } // namespace argon::math
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
 #include <fundamental/types.hpp>
 
 #include "forward_declarations.hpp"
+#include "inline.hpp"
 #include "simd.hpp"
+#include "utils.hpp"
 #include "vector3.hpp"
 #include "vector4.hpp"
 
@@ -86,6 +89,15 @@ public:
 	Matrix4 AR_VEC_CALL getInverted(void) const;
 	Matrix4& AR_VEC_CALL invert(void);
 
+	//Assumes the matrix is an affine transformation matrix
+	//Inverts the 3x3 part and the translation, several times cheaper than getInverted
+	Matrix4 AR_VEC_CALL getInvertedAffine(void) const;
+	Matrix4& AR_VEC_CALL invertAffine(void);
+
+	//Assumes the matrix has only rotation and translation, the 3x3 part is transposed
+	Matrix4 AR_VEC_CALL getInvertedOrthonormal(void) const;
+	Matrix4& AR_VEC_CALL invertOrthonormal(void);
+
 	Vector3 AR_VEC_CALL transformNormal(const Vector3 &n) const;
 
 	Vector3 AR_VEC_CALL getColumn(int32 i) const;
@@ -102,6 +114,8 @@ public:
 
 	Matrix4 AR_VEC_CALL operator*(const Matrix4 &other) const;
 	Matrix4& AR_VEC_CALL operator*=(const Matrix4 &other);
+	//Assumes both matrices are affine, the last row is not computed
+	Matrix4 AR_VEC_CALL multiplyAffine(const Matrix4 &other) const;
 	Matrix4 AR_VEC_CALL operator*(float32 s) const;
 	Vector3 AR_VEC_CALL operator*(const Vector3 &v) const;
 	Vector4 AR_VEC_CALL operator*(const Vector4 &v) const;
@@ -114,4 +128,360 @@ private:
 
 	Vector4 m_rows[4];
 };
+
+AR_MATH_INLINE Matrix4::Matrix4()
+{
+}
+
+AR_MATH_INLINE AR_VEC_CALL Matrix4::Matrix4(const Matrix4 &other)
+{
+	m_rows[0] = other.m_rows[0];
+	m_rows[1] = other.m_rows[1];
+	m_rows[2] = other.m_rows[2];
+	m_rows[3] = other.m_rows[3];
+}
+
+AR_MATH_INLINE AR_VEC_CALL Matrix4::Matrix4(
+			float32 e00, float32 e01, float32 e02, float32 e03,
+			float32 e10, float32 e11, float32 e12, float32 e13,
+			float32 e20, float32 e21, float32 e22, float32 e23,
+			float32 e30, float32 e31, float32 e32, float32 e33)
+{
+	m_rows[0].set(e00, e01, e02, e03);
+	m_rows[1].set(e10, e11, e12, e13);
+	m_rows[2].set(e20, e21, e22, e23);
+	m_rows[3].set(e30, e31, e32, e33);
+}
+
+AR_MATH_INLINE AR_VEC_CALL Matrix4::Matrix4(const Vector4 &v0, const Vector4 &v1,
+														 const Vector4 &v2, const Vector4 &v3)
+{
+	m_rows[0] = v0;
+	m_rows[1] = v1;
+	m_rows[2] = v2;
+	m_rows[3] = v3;
+}
+
+AR_MATH_INLINE AR_VEC_CALL Matrix4::Matrix4(const Vector3 &v0, const Vector3 &v1,
+														 const Vector3 &v2, const Vector3 &v3)
+{
+	m_rows[0].set(v0.getX(), v1.getX(), v2.getX(), v3.getX());
+	m_rows[1].set(v0.getY(), v1.getY(), v2.getY(), v3.getY());
+	m_rows[2].set(v0.getZ(), v1.getZ(), v2.getZ(), v3.getZ());
+	m_rows[3].set(0.f, 0.f, 0.f, 1.f);
+}
+
+#ifdef AR_SIMD
+AR_MATH_INLINE AR_VEC_CALL Matrix4::Matrix4(__m128 v0, __m128 v1, __m128 v2, __m128 v3)
+{
+	m_rows[0] = Vector4(v0);
+	m_rows[1] = Vector4(v1);
+	m_rows[2] = Vector4(v2);
+	m_rows[3] = Vector4(v3);
+}
+#endif // ifdef AR_SIMD
+
+AR_MATH_INLINE Matrix4& AR_VEC_CALL Matrix4::operator=(const Matrix4 &other)
+{
+	m_rows[0] = other.m_rows[0];
+	m_rows[1] = other.m_rows[1];
+	m_rows[2] = other.m_rows[2];
+	m_rows[3] = other.m_rows[3];
+
+	return *this;
+}
+
+AR_MATH_INLINE Vector3 AR_VEC_CALL Matrix4::getColumn(int32 i) const
+{
+	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
+
+	return Vector3(m_rows[0][i], m_rows[1][i], m_rows[2][i]);
+}
+
+AR_MATH_INLINE void AR_VEC_CALL Matrix4::setColumn(int32 i, const Vector4 &v)
+{
+	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
+
+	m_rows[0][i] = v[0];
+	m_rows[1][i] = v[1];
+	m_rows[2][i] = v[2];
+	m_rows[3][i] = v[3];
+}
+
+AR_MATH_INLINE Vector4& AR_VEC_CALL Matrix4::operator[](int32 i)
+{
+	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
+
+	return m_rows[i];
+}
+
+AR_MATH_INLINE const Vector4& AR_VEC_CALL Matrix4::operator[](int32 i) const
+{
+	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
+
+	return m_rows[i];
+}
+
+AR_MATH_INLINE Matrix4 AR_VEC_CALL Matrix4::operator+(const Matrix4 &other) const
+{
+	return Matrix4(m_rows[0] + other.m_rows[0], m_rows[1] + other.m_rows[1],
+		m_rows[2] + other.m_rows[2], m_rows[3] + other.m_rows[3]);
+}
+
+AR_MATH_INLINE Matrix4& AR_VEC_CALL Matrix4::operator+=(const Matrix4 &other)
+{
+	m_rows[0] += other.m_rows[0];
+	m_rows[1] += other.m_rows[1];
+	m_rows[2] += other.m_rows[2];
+	m_rows[3] += other.m_rows[3];
+
+	return *this;
+}
+
+AR_MATH_INLINE Matrix4 AR_VEC_CALL Matrix4::operator-(const Matrix4 &other) const
+{
+	return Matrix4(m_rows[0] - other.m_rows[0], m_rows[1] - other.m_rows[1],
+		m_rows[2] - other.m_rows[2], m_rows[3] - other.m_rows[3]);
+}
+
+AR_MATH_INLINE Matrix4& AR_VEC_CALL Matrix4::operator-=(const Matrix4 &other)
+{
+	m_rows[0] -= other.m_rows[0];
+	m_rows[1] -= other.m_rows[1];
+	m_rows[2] -= other.m_rows[2];
+	m_rows[3] -= other.m_rows[3];
+
+	return *this;
+}
+
+AR_MATH_INLINE Matrix4 AR_VEC_CALL Matrix4::operator*(const Matrix4 &other) const
+{
+#ifdef AR_SIMD
+	const __m128 tv0 = m_rows[0].get128();
+	const __m128 tv1 = m_rows[1].get128();
+	const __m128 tv2 = m_rows[2].get128();
+	const __m128 tv3 = m_rows[3].get128();
+	const __m128 mv0 = other.m_rows[0].get128();
+	const __m128 mv1 = other.m_rows[1].get128();
+	const __m128 mv2 = other.m_rows[2].get128();
+	const __m128 mv3 = other.m_rows[3].get128();
+
+	__m128 v00 = _mm_shuffle_ps(tv0, tv0, 0x0);
+	__m128 v01 = _mm_shuffle_ps(tv0, tv0, 0x55);
+	__m128 v02 = _mm_shuffle_ps(tv0, tv0, 0xAA);
+	__m128 v03 = _mm_shuffle_ps(tv0, tv0, 0xFF);
+
+	v00 = _mm_mul_ps(v00, mv0);
+	v01 = _mm_mul_ps(v01, mv1);
+	v02 = _mm_mul_ps(v02, mv2);
+	v03 = _mm_mul_ps(v03, mv3);
+
+	__m128 v10 = _mm_shuffle_ps(tv1, tv1, 0x0);
+	__m128 v11 = _mm_shuffle_ps(tv1, tv1, 0x55);
+	__m128 v12 = _mm_shuffle_ps(tv1, tv1, 0xAA);
+	__m128 v13 = _mm_shuffle_ps(tv1, tv1, 0xFF);
+
+	v10 = _mm_mul_ps(v10, mv0);
+	v11 = _mm_mul_ps(v11, mv1);
+	v12 = _mm_mul_ps(v12, mv2);
+	v13 = _mm_mul_ps(v13, mv3);
+
+	__m128 v20 = _mm_shuffle_ps(tv2, tv2, 0x0);
+	__m128 v21 = _mm_shuffle_ps(tv2, tv2, 0x55);
+	__m128 v22 = _mm_shuffle_ps(tv2, tv2, 0xAA);
+	__m128 v23 = _mm_shuffle_ps(tv2, tv2, 0xFF);
+
+	v20 = _mm_mul_ps(v20, mv0);
+	v21 = _mm_mul_ps(v21, mv1);
+	v22 = _mm_mul_ps(v22, mv2);
+	v23 = _mm_mul_ps(v23, mv3);
+
+	__m128 v30 = _mm_shuffle_ps(tv3, tv3, 0x0);
+	__m128 v31 = _mm_shuffle_ps(tv3, tv3, 0x55);
+	__m128 v32 = _mm_shuffle_ps(tv3, tv3, 0xAA);
+	__m128 v33 = _mm_shuffle_ps(tv3, tv3, 0xFF);
+
+	v30 = _mm_mul_ps(v30, mv0);
+	v31 = _mm_mul_ps(v31, mv1);
+	v32 = _mm_mul_ps(v32, mv2);
+	v33 = _mm_mul_ps(v33, mv3);
+
+	v00 = _mm_add_ps(v00, v01);
+	v02 = _mm_add_ps(v02, v03);
+	v00 = _mm_add_ps(v00, v02);
+
+	v10 = _mm_add_ps(v10, v11);
+	v12 = _mm_add_ps(v12, v13);
+	v10 = _mm_add_ps(v10, v12);
+
+	v20 = _mm_add_ps(v20, v21);
+	v22 = _mm_add_ps(v22, v23);
+	v20 = _mm_add_ps(v20, v22);
+
+	v30 = _mm_add_ps(v30, v31);
+	v32 = _mm_add_ps(v32, v33);
+	v30 = _mm_add_ps(v30, v32);
+
+	return Matrix4(v00, v10, v20, v30);
+#else
+	return Matrix4(m_rows[0].dot(other._getColumn4(0)), m_rows[0].dot(other._getColumn4(1)),
+		m_rows[0].dot(other._getColumn4(2)), m_rows[0].dot(other._getColumn4(3)),
+		m_rows[1].dot(other._getColumn4(0)), m_rows[1].dot(other._getColumn4(1)),
+		m_rows[1].dot(other._getColumn4(2)), m_rows[1].dot(other._getColumn4(3)),
+		m_rows[2].dot(other._getColumn4(0)), m_rows[2].dot(other._getColumn4(1)),
+		m_rows[2].dot(other._getColumn4(2)), m_rows[2].dot(other._getColumn4(3)),
+		m_rows[3].dot(other._getColumn4(0)), m_rows[3].dot(other._getColumn4(1)),
+		m_rows[3].dot(other._getColumn4(2)), m_rows[3].dot(other._getColumn4(3)));
+#endif // ifdef AR_SIMD
+}
+
+AR_MATH_INLINE Matrix4& AR_VEC_CALL Matrix4::operator*=(const Matrix4 &other)
+{
+#ifdef AR_SIMD
+	const __m128 tv0 = m_rows[0].get128();
+	const __m128 tv1 = m_rows[1].get128();
+	const __m128 tv2 = m_rows[2].get128();
+	const __m128 tv3 = m_rows[3].get128();
+	const __m128 mv0 = other.m_rows[0].get128();
+	const __m128 mv1 = other.m_rows[1].get128();
+	const __m128 mv2 = other.m_rows[2].get128();
+	const __m128 mv3 = other.m_rows[3].get128();
+
+	__m128 v00 = _mm_shuffle_ps(tv0, tv0, 0x0);
+	__m128 v01 = _mm_shuffle_ps(tv0, tv0, 0x55);
+	__m128 v02 = _mm_shuffle_ps(tv0, tv0, 0xAA);
+	__m128 v03 = _mm_shuffle_ps(tv0, tv0, 0xFF);
+
+	v00 = _mm_mul_ps(v00, mv0);
+	v01 = _mm_mul_ps(v01, mv1);
+	v02 = _mm_mul_ps(v02, mv2);
+	v03 = _mm_mul_ps(v03, mv3);
+
+	__m128 v10 = _mm_shuffle_ps(tv1, tv1, 0x0);
+	__m128 v11 = _mm_shuffle_ps(tv1, tv1, 0x55);
+	__m128 v12 = _mm_shuffle_ps(tv1, tv1, 0xAA);
+	__m128 v13 = _mm_shuffle_ps(tv1, tv1, 0xFF);
+
+	v10 = _mm_mul_ps(v10, mv0);
+	v11 = _mm_mul_ps(v11, mv1);
+	v12 = _mm_mul_ps(v12, mv2);
+	v13 = _mm_mul_ps(v13, mv3);
+
+	__m128 v20 = _mm_shuffle_ps(tv2, tv2, 0x0);
+	__m128 v21 = _mm_shuffle_ps(tv2, tv2, 0x55);
+	__m128 v22 = _mm_shuffle_ps(tv2, tv2, 0xAA);
+	__m128 v23 = _mm_shuffle_ps(tv2, tv2, 0xFF);
+
+	v20 = _mm_mul_ps(v20, mv0);
+	v21 = _mm_mul_ps(v21, mv1);
+	v22 = _mm_mul_ps(v22, mv2);
+	v23 = _mm_mul_ps(v23, mv3);
+
+	__m128 v30 = _mm_shuffle_ps(tv3, tv3, 0x0);
+	__m128 v31 = _mm_shuffle_ps(tv3, tv3, 0x55);
+	__m128 v32 = _mm_shuffle_ps(tv3, tv3, 0xAA);
+	__m128 v33 = _mm_shuffle_ps(tv3, tv3, 0xFF);
+
+	v30 = _mm_mul_ps(v30, mv0);
+	v31 = _mm_mul_ps(v31, mv1);
+	v32 = _mm_mul_ps(v32, mv2);
+	v33 = _mm_mul_ps(v33, mv3);
+
+	v00 = _mm_add_ps(v00, v01);
+	v02 = _mm_add_ps(v02, v03);
+	m_rows[0].set(_mm_add_ps(v00, v02));
+
+	v10 = _mm_add_ps(v10, v11);
+	v12 = _mm_add_ps(v12, v13);
+	m_rows[1].set(_mm_add_ps(v10, v12));
+
+	v20 = _mm_add_ps(v20, v21);
+	v22 = _mm_add_ps(v22, v23);
+	m_rows[2].set(_mm_add_ps(v20, v22));
+
+	v30 = _mm_add_ps(v30, v31);
+	v32 = _mm_add_ps(v32, v33);
+	m_rows[3].set(_mm_add_ps(v30, v32));
+#else
+	m_rows[0].set(m_rows[0].dot(other._getColumn4(0)), m_rows[0].dot(other._getColumn4(1)),
+		m_rows[0].dot(other._getColumn4(2)), m_rows[0].dot(other._getColumn4(3)));
+	m_rows[1].set(m_rows[1].dot(other._getColumn4(0)), m_rows[1].dot(other._getColumn4(1)),
+		m_rows[1].dot(other._getColumn4(2)), m_rows[1].dot(other._getColumn4(3)));
+	m_rows[2].set(m_rows[2].dot(other._getColumn4(0)), m_rows[2].dot(other._getColumn4(1)),
+		m_rows[2].dot(other._getColumn4(2)), m_rows[2].dot(other._getColumn4(3)));
+	m_rows[3].set(m_rows[3].dot(other._getColumn4(0)), m_rows[3].dot(other._getColumn4(1)),
+		m_rows[3].dot(other._getColumn4(2)), m_rows[3].dot(other._getColumn4(3)));
+#endif // ifdef AR_SIMD
+
+	return *this;
+}
+
+AR_MATH_INLINE Matrix4 AR_VEC_CALL Matrix4::multiplyAffine(const Matrix4 &other) const
+{
+	AR_ASSERT_MSG(m_rows[3] == Vector4::c_wAxis && other.m_rows[3] == Vector4::c_wAxis,
+		"The matrix is not affine");
+
+#ifdef AR_SIMD
+	const __m128 mv0 = other.m_rows[0].get128();
+	const __m128 mv1 = other.m_rows[1].get128();
+	const __m128 mv2 = other.m_rows[2].get128();
+
+	__m128 rows[3];
+	for (int32 i = 0; i < 3; ++i)
+	{
+		// The last row of other is (0, 0, 0, 1), so the w element only adds the translation
+		const __m128 tv = m_rows[i].get128();
+		const __m128 v0 = _mm_mul_ps(_mm_shuffle_ps(tv, tv, 0x0), mv0);
+		const __m128 v1 = _mm_mul_ps(_mm_shuffle_ps(tv, tv, 0x55), mv1);
+		const __m128 v2 = _mm_mul_ps(_mm_shuffle_ps(tv, tv, 0xAA), mv2);
+		const __m128 v3 = _mm_andnot_ps(utils::c_SIMDXYZMask, tv);
+
+		rows[i] = _mm_add_ps(_mm_add_ps(v0, v1), _mm_add_ps(v2, v3));
+	}
+
+	return Matrix4(rows[0], rows[1], rows[2], Vector4::c_wAxis.get128());
+#else
+	const Vector4 c0 = other._getColumn4(0);
+	const Vector4 c1 = other._getColumn4(1);
+	const Vector4 c2 = other._getColumn4(2);
+	const Vector4 c3 = other._getColumn4(3);
+
+	return Matrix4(m_rows[0].dot(c0), m_rows[0].dot(c1), m_rows[0].dot(c2), m_rows[0].dot(c3),
+		m_rows[1].dot(c0), m_rows[1].dot(c1), m_rows[1].dot(c2), m_rows[1].dot(c3),
+		m_rows[2].dot(c0), m_rows[2].dot(c1), m_rows[2].dot(c2), m_rows[2].dot(c3),
+		0.f, 0.f, 0.f, 1.f);
+#endif // ifdef AR_SIMD
+}
+
+AR_MATH_INLINE Matrix4 AR_VEC_CALL Matrix4::operator*(float32 s) const
+{
+	return Matrix4(m_rows[0] * s, m_rows[1] * s, m_rows[2] * s, m_rows[3] * s);
+}
+
+AR_MATH_INLINE Vector3 AR_VEC_CALL Matrix4::operator*(const Vector3 &v) const
+{
+	return Vector3(m_rows[0].dot(v), m_rows[1].dot(v), m_rows[2].dot(v));
+}
+
+AR_MATH_INLINE Vector4 AR_VEC_CALL Matrix4::operator*(const Vector4 &v) const
+{
+	return Vector4(m_rows[0].dot(v), m_rows[1].dot(v), m_rows[2].dot(v), m_rows[3].dot(v));
+}
+
+AR_MATH_INLINE bool AR_VEC_CALL Matrix4::operator==(const Matrix4 &other) const
+{
+	return (m_rows[0] == other.m_rows[0]) && (m_rows[1] == other.m_rows[1])
+		&& (m_rows[2] == other.m_rows[2]) && (m_rows[3] == other.m_rows[3]);
+}
+
+AR_MATH_INLINE bool AR_VEC_CALL Matrix4::operator!=(const Matrix4 &other) const
+{
+	return !(*this == other);
+}
+
+AR_MATH_INLINE Vector4 AR_VEC_CALL Matrix4::_getColumn4(int32 i) const
+{
+	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
+	return Vector4(m_rows[0][i], m_rows[1][i], m_rows[2][i], m_rows[3][i]);
+}
 } // namespace argon::math
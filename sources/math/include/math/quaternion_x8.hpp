@@ -0,0 +1,32 @@
+#pragma once
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/types.hpp>
+
+#include "forward_declarations.hpp"
+
+namespace argon::math
+{
+// Eight quaternions with the components stored separately, see Vector3x8
+struct AR_SYM_EXPORT QuaternionX8 final
+{
+	inline static constexpr int32 LANES = 8;
+
+	QuaternionX8();
+	explicit QuaternionX8(const Quaternion *q);
+
+	// Gathers LANES quaternions
+	void load(const Quaternion *q);
+	// Scatters LANES quaternions
+	void store(Quaternion *q) const;
+
+	Quaternion getLane(int32 i) const;
+	void setLane(int32 i, const Quaternion &q);
+
+	//Scalar goes before the vector part, same as in Quaternion
+	alignas(32) float32 m_q0[LANES];
+	float32 m_q1[LANES];
+	float32 m_q2[LANES];
+	float32 m_q3[LANES];
+};
+} // namespace argon::math
@@ -20,6 +20,8 @@ const __m128 c_SIMDNegMask  = _mm_castsi128_ps(
 																							static_cast<int>(0x80000000),
 																							static_cast<int>(0x80000000),
 																							static_cast<int>(0x80000000)));
+// Clears the w component
+const __m128 c_SIMDXYZMask  = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
 #endif // ifdef AR_SIMD
 
 template<class T>
@@ -28,8 +30,8 @@ T getSign(const T& val)
 	return (val >= T(0)) ? T(1) : T(-1);
 }
 
-float32 round(float32 val, uint16 numDecimals);
+AR_SYM_EXPORT float32 round(float32 val, uint16 numDecimals);
 
-void gramSchmidt(Vector3 &e1, Vector3 &e2, Vector3 &e3);
+AR_SYM_EXPORT void gramSchmidt(Vector3 &e1, Vector3 &e2, Vector3 &e3);
 } // namespace utils
 } // namespace argon::math
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/types.hpp>
+
+#include "forward_declarations.hpp"
+
+namespace argon::math
+{
+// Eight vectors with the components stored separately, so each component of all lanes fills
+// a single 256-bit register. See batch.hpp for the operations.
+struct AR_SYM_EXPORT Vector3x8 final
+{
+	inline static constexpr int32 LANES = 8;
+
+	Vector3x8();
+	explicit Vector3x8(const Vector3 *v);
+
+	// Gathers LANES vectors
+	void load(const Vector3 *v);
+	// Scatters LANES vectors
+	void store(Vector3 *v) const;
+
+	Vector3 getLane(int32 i) const;
+	void setLane(int32 i, const Vector3 &v);
+
+	alignas(32) float32 m_x[LANES];
+	float32 m_y[LANES];
+	float32 m_z[LANES];
+};
+} // namespace argon::math
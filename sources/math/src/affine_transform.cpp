@@ -0,0 +1,18 @@
+#include "affine_transform.hpp"
+#include "quaternion.hpp"
+
+namespace argon::math
+{
+AR_VEC_CALL AffineTransform::AffineTransform(const Quaternion &rotation, const Vector3 &trans)
+	: m_kind(Kind::Rigid)
+{
+	m_matrix.setTransformation(rotation, Vector3(1.f, 1.f, 1.f), trans);
+}
+
+AR_VEC_CALL AffineTransform::AffineTransform(const Quaternion &rotation, const Vector3 &scaling,
+	const Vector3 &trans)
+	: m_kind(scaling == Vector3(1.f, 1.f, 1.f) ? Kind::Rigid : Kind::General)
+{
+	m_matrix.setTransformation(rotation, scaling, trans);
+}
+} // namespace argon::math
@@ -0,0 +1,206 @@
+#include <initializer_list>
+#include <limits>
+
+#include <fundamental/debug.hpp>
+
+#include "batch.hpp"
+#include "batch_kernels.hpp"
+#include "bounds.hpp"
+#include "matrix4.hpp"
+#include "quaternion.hpp"
+#include "vector3.hpp"
+
+namespace argon::math
+{
+namespace
+{
+static_assert(sizeof(Matrix4) == 16 * sizeof(float32), "The kernels expect 16 floats");
+static_assert(sizeof(Vector3) == 4 * sizeof(float32), "The kernels expect 4 floats");
+static_assert(sizeof(Frustum) == 6 * 4 * sizeof(float32), "The kernels expect 6 planes");
+
+// Per-object implementations for the processors without AVX
+void transformPointsFallback(const Matrix4 &m, const Vector3 *src, Vector3 *dst, sizet count)
+{
+	for (sizet i = 0; i < count; ++i)
+	{
+		dst[i] = m * src[i];
+	}
+}
+
+void transformPointsX8Fallback(const Matrix4 &m, const Vector3x8 *src, Vector3x8 *dst,
+	sizet count)
+{
+	for (sizet i = 0; i < count; ++i)
+	{
+		for (int32 lane = 0; lane < Vector3x8::LANES; ++lane)
+		{
+			dst[i].setLane(lane, m * src[i].getLane(lane));
+		}
+	}
+}
+
+void multiplyFallback(const Matrix4 *lhs, const Matrix4 *rhs, Matrix4 *dst, sizet count)
+{
+	for (sizet i = 0; i < count; ++i)
+	{
+		dst[i] = lhs[i] * rhs[i];
+	}
+}
+
+void slerpFallback(const QuaternionX8 *from, const QuaternionX8 *to, float32 t,
+	QuaternionX8 *dst, sizet count)
+{
+	for (sizet i = 0; i < count; ++i)
+	{
+		for (int32 lane = 0; lane < QuaternionX8::LANES; ++lane)
+		{
+			dst[i].setLane(lane, from[i].getLane(lane).slerp(to[i].getLane(lane), t));
+		}
+	}
+}
+
+sizet cullSpheresFallback(const Frustum &frustum, const SphereX8 *spheres, sizet count,
+	uint32 *visible)
+{
+	sizet numVisible = 0;
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		if (frustum.isVisible(spheres[i / SphereX8::LANES].getLane(
+			static_cast<int32>(i % SphereX8::LANES))))
+		{
+			visible[numVisible++] = static_cast<uint32>(i);
+		}
+	}
+
+	return numVisible;
+}
+
+sizet cullAabbsFallback(const Frustum &frustum, const AabbX8 *boxes, sizet count,
+	uint32 *visible)
+{
+	sizet numVisible = 0;
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		if (frustum.isVisible(boxes[i / AabbX8::LANES].getLane(
+			static_cast<int32>(i % AabbX8::LANES))))
+		{
+			visible[numVisible++] = static_cast<uint32>(i);
+		}
+	}
+
+	return numVisible;
+}
+
+const batchimpl::Kernels c_fallbackKernels = {&transformPointsFallback,
+	&transformPointsX8Fallback, &multiplyFallback, &slerpFallback, &cullSpheresFallback,
+	&cullAabbsFallback};
+
+bool isSupported(BatchKernels kernels)
+{
+	switch (kernels)
+	{
+	case BatchKernels::Fma:
+		return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+	case BatchKernels::Avx:
+		return __builtin_cpu_supports("avx");
+	case BatchKernels::Fallback:
+		return true;
+	}
+
+	return false;
+}
+
+const batchimpl::Kernels& getKernels(BatchKernels kernels)
+{
+	switch (kernels)
+	{
+	case BatchKernels::Fma:
+		return batchimpl::c_fmaKernels;
+	case BatchKernels::Avx:
+		return batchimpl::c_avxKernels;
+	case BatchKernels::Fallback:
+		break;
+	}
+
+	return c_fallbackKernels;
+}
+
+BatchKernels selectKernels()
+{
+	for (const BatchKernels kernels : {BatchKernels::Fma, BatchKernels::Avx})
+	{
+		if (isSupported(kernels))
+		{
+			return kernels;
+		}
+	}
+
+	return BatchKernels::Fallback;
+}
+
+// Picked once, replaced only by setBatchKernels
+BatchKernels& getSelected()
+{
+	static BatchKernels selected = selectKernels();
+	return selected;
+}
+
+// A switch per call, the operations are meant for whole arrays
+const batchimpl::Kernels& getKernels()
+{
+	return getKernels(getSelected());
+}
+} // namespace
+
+BatchKernels getBatchKernels()
+{
+	return getSelected();
+}
+
+bool setBatchKernels(BatchKernels kernels)
+{
+	if (!isSupported(kernels))
+	{
+		return false;
+	}
+
+	getSelected() = kernels;
+	return true;
+}
+
+void transformPoints(const Matrix4 &m, const Vector3 *src, Vector3 *dst, sizet count)
+{
+	getKernels().m_transformPoints(m, src, dst, count);
+}
+
+void transformPoints(const Matrix4 &m, const Vector3x8 *src, Vector3x8 *dst, sizet count)
+{
+	getKernels().m_transformPointsX8(m, src, dst, count);
+}
+
+void multiplyBatch(const Matrix4 *lhs, const Matrix4 *rhs, Matrix4 *dst, sizet count)
+{
+	getKernels().m_multiply(lhs, rhs, dst, count);
+}
+
+void slerpBatch(const QuaternionX8 *from, const QuaternionX8 *to, float32 t,
+	QuaternionX8 *dst, sizet count)
+{
+	AR_ASSERT_MSG(t >= 0.f && t <= 1.f, "Interpolation factor is out of range");
+	getKernels().m_slerp(from, to, t, dst, count);
+}
+
+sizet cullSpheres(const Frustum &frustum, const SphereX8 *spheres, sizet count, uint32 *visible)
+{
+	AR_ASSERT_MSG(count <= std::numeric_limits<uint32>::max(), "Indices don't fit");
+	return getKernels().m_cullSpheres(frustum, spheres, count, visible);
+}
+
+sizet cullAabbs(const Frustum &frustum, const AabbX8 *boxes, sizet count, uint32 *visible)
+{
+	AR_ASSERT_MSG(count <= std::numeric_limits<uint32>::max(), "Indices don't fit");
+	return getKernels().m_cullAabbs(frustum, boxes, count, visible);
+}
+} // namespace argon::math
@@ -0,0 +1,9 @@
+// Built with -mavx, see CMakeLists.txt
+
+#include "batch_kernels_impl.hpp"
+
+namespace argon::math::batchimpl
+{
+const Kernels c_avxKernels = {&transformPoints, &transformPointsX8, &multiply, &slerp,
+	&cullSpheres, &cullAabbs};
+} // namespace argon::math::batchimpl
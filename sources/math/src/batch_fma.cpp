@@ -0,0 +1,9 @@
+// Built with -mavx2 -mfma, see CMakeLists.txt
+
+#include "batch_kernels_impl.hpp"
+
+namespace argon::math::batchimpl
+{
+const Kernels c_fmaKernels = {&transformPoints, &transformPointsX8, &multiply, &slerp,
+	&cullSpheres, &cullAabbs};
+} // namespace argon::math::batchimpl
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <fundamental/types.hpp>
+
+#include "bounds_x8.hpp"
+#include "forward_declarations.hpp"
+#include "quaternion_x8.hpp"
+#include "vector3x8.hpp"
+
+namespace argon::math::batchimpl
+{
+// Implementations of batch.hpp for a single instruction set. The kernels are built in separate
+// translation units with the matching compiler flags, so they work on raw floats and see only
+// the declarations of the math types: matrices are 16 floats of rows, vectors are 4 floats,
+// frustums are 6 planes of 4 floats.
+struct Kernels
+{
+	void (*m_transformPoints)(const Matrix4 &m, const Vector3 *src, Vector3 *dst, sizet count);
+	void (*m_transformPointsX8)(const Matrix4 &m, const Vector3x8 *src, Vector3x8 *dst,
+		sizet count);
+	void (*m_multiply)(const Matrix4 *lhs, const Matrix4 *rhs, Matrix4 *dst, sizet count);
+	void (*m_slerp)(const QuaternionX8 *from, const QuaternionX8 *to, float32 t,
+		QuaternionX8 *dst, sizet count);
+	sizet (*m_cullSpheres)(const Frustum &frustum, const SphereX8 *spheres, sizet count,
+		uint32 *visible);
+	sizet (*m_cullAabbs)(const Frustum &frustum, const AabbX8 *boxes, sizet count,
+		uint32 *visible);
+};
+
+// batch_avx.cpp
+extern const Kernels c_avxKernels;
+// batch_fma.cpp, requires AVX2 and FMA
+extern const Kernels c_fmaKernels;
+} // namespace argon::math::batchimpl
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <immintrin.h>
+
+#include <fundamental/types.hpp>
+
+#include "batch_kernels.hpp"
+#include "constants.hpp"
+
+// Shared by batch_avx.cpp and batch_fma.cpp, everything has internal linkage so each
+// translation unit keeps its own instruction set
+namespace argon::math::batchimpl
+{
+namespace
+{
+inline __m256 vecMadd(__m256 a, __m256 b, __m256 c)
+{
+#ifdef __FMA__
+	return _mm256_fmadd_ps(a, b, c);
+#else
+	return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif // ifdef __FMA__
+}
+
+// Both halves hold the 4 floats
+inline __m256 vecBroadcast4(const float32 *src)
+{
+	const __m128 v = _mm_loadu_ps(src);
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(v), v, 1);
+}
+
+// x is in [0, pi]
+inline __m256 vecSin(__m256 x)
+{
+	// sin(x) = sin(pi - x) keeps the argument in [0, pi / 2]
+	const __m256 r = _mm256_min_ps(x, _mm256_sub_ps(_mm256_set1_ps(c_pi), x));
+	const __m256 r2 = _mm256_mul_ps(r, r);
+
+	// Taylor series up to the 11th power, the error is below 6e-8
+	__m256 p = _mm256_set1_ps(-1.f / 39916800.f);
+	p = vecMadd(p, r2, _mm256_set1_ps(1.f / 362880.f));
+	p = vecMadd(p, r2, _mm256_set1_ps(-1.f / 5040.f));
+	p = vecMadd(p, r2, _mm256_set1_ps(1.f / 120.f));
+	p = vecMadd(p, r2, _mm256_set1_ps(-1.f / 6.f));
+	p = vecMadd(p, r2, _mm256_set1_ps(1.f));
+
+	return _mm256_mul_ps(p, r);
+}
+
+// x is in [-1, 1]
+inline __m256 vecAcos(__m256 x)
+{
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 a = _mm256_andnot_ps(_mm256_set1_ps(-0.f), x);
+
+	// Abramowitz and Stegun 4.4.46, the error is below 2e-8
+	__m256 p = _mm256_set1_ps(-0.0012624911f);
+	p = vecMadd(p, a, _mm256_set1_ps(0.0066700901f));
+	p = vecMadd(p, a, _mm256_set1_ps(-0.0170881256f));
+	p = vecMadd(p, a, _mm256_set1_ps(0.0308918810f));
+	p = vecMadd(p, a, _mm256_set1_ps(-0.0501743046f));
+	p = vecMadd(p, a, _mm256_set1_ps(0.0889789874f));
+	p = vecMadd(p, a, _mm256_set1_ps(-0.2145988016f));
+	p = vecMadd(p, a, _mm256_set1_ps(1.5707963050f));
+
+	const __m256 r = _mm256_mul_ps(p,
+		_mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(1.f), a), zero)));
+
+	// acos(-x) = pi - acos(x)
+	return _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(c_pi), r),
+		_mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+}
+
+// Appends the indices of the set bits of the lane mask, the lanes past count are dropped
+inline sizet appendVisible(int32 laneMask, sizet block, sizet count, uint32 *visible,
+	sizet numVisible)
+{
+	const sizet first = block * 8;
+	auto mask = static_cast<uint32>(laneMask);
+
+	if (count - first < 8)
+	{
+		mask &= (1u << (count - first)) - 1u;
+	}
+
+	while (mask != 0)
+	{
+		visible[numVisible++] = static_cast<uint32>(first + static_cast<sizet>(__builtin_ctz(mask)));
+		mask &= mask - 1;
+	}
+
+	return numVisible;
+}
+
+void transformPoints(const Matrix4 &matrix, const Vector3 *srcVectors, Vector3 *dstVectors,
+	sizet count)
+{
+	const auto *m = reinterpret_cast<const float32*>(&matrix);
+	const auto *src = reinterpret_cast<const float32*>(srcVectors);
+	auto *dst = reinterpret_cast<float32*>(dstVectors);
+
+	__m256 e[12];
+	for (sizet i = 0; i < 12; ++i)
+	{
+		e[i] = _mm256_broadcast_ss(m + i);
+	}
+
+	const __m256 zero = _mm256_setzero_ps();
+	const sizet numBlocks = count / 8;
+
+	for (sizet block = 0; block < numBlocks; ++block, src += 32, dst += 32)
+	{
+		// Two vectors in every register, the transposition keeps the lanes in the order
+		// 0 2 4 6 1 3 5 7, which is undone by the reverse transposition
+		const __m256 p01 = _mm256_loadu_ps(src);
+		const __m256 p23 = _mm256_loadu_ps(src + 8);
+		const __m256 p45 = _mm256_loadu_ps(src + 16);
+		const __m256 p67 = _mm256_loadu_ps(src + 24);
+
+		const __m256 t0 = _mm256_unpacklo_ps(p01, p23);
+		const __m256 t1 = _mm256_unpackhi_ps(p01, p23);
+		const __m256 t2 = _mm256_unpacklo_ps(p45, p67);
+		const __m256 t3 = _mm256_unpackhi_ps(p45, p67);
+
+		const __m256 x = _mm256_shuffle_ps(t0, t2, 0x44);
+		const __m256 y = _mm256_shuffle_ps(t0, t2, 0xEE);
+		const __m256 z = _mm256_shuffle_ps(t1, t3, 0x44);
+
+		const __m256 rx = vecMadd(e[0], x, vecMadd(e[1], y, vecMadd(e[2], z, e[3])));
+		const __m256 ry = vecMadd(e[4], x, vecMadd(e[5], y, vecMadd(e[6], z, e[7])));
+		const __m256 rz = vecMadd(e[8], x, vecMadd(e[9], y, vecMadd(e[10], z, e[11])));
+
+		const __m256 u0 = _mm256_unpacklo_ps(rx, ry);
+		const __m256 u1 = _mm256_unpackhi_ps(rx, ry);
+		const __m256 v0 = _mm256_unpacklo_ps(rz, zero);
+		const __m256 v1 = _mm256_unpackhi_ps(rz, zero);
+
+		_mm256_storeu_ps(dst, _mm256_shuffle_ps(u0, v0, 0x44));
+		_mm256_storeu_ps(dst + 8, _mm256_shuffle_ps(u0, v0, 0xEE));
+		_mm256_storeu_ps(dst + 16, _mm256_shuffle_ps(u1, v1, 0x44));
+		_mm256_storeu_ps(dst + 24, _mm256_shuffle_ps(u1, v1, 0xEE));
+	}
+
+	for (sizet i = numBlocks * 8; i < count; ++i, src += 4, dst += 4)
+	{
+		const float32 x = src[0];
+		const float32 y = src[1];
+		const float32 z = src[2];
+
+		dst[0] = m[0] * x + m[1] * y + m[2] * z + m[3];
+		dst[1] = m[4] * x + m[5] * y + m[6] * z + m[7];
+		dst[2] = m[8] * x + m[9] * y + m[10] * z + m[11];
+		dst[3] = 0.f;
+	}
+}
+
+void transformPointsX8(const Matrix4 &matrix, const Vector3x8 *src, Vector3x8 *dst,
+	sizet count)
+{
+	const auto *m = reinterpret_cast<const float32*>(&matrix);
+
+	__m256 e[12];
+	for (sizet i = 0; i < 12; ++i)
+	{
+		e[i] = _mm256_broadcast_ss(m + i);
+	}
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		const __m256 x = _mm256_load_ps(src[i].m_x);
+		const __m256 y = _mm256_load_ps(src[i].m_y);
+		const __m256 z = _mm256_load_ps(src[i].m_z);
+
+		_mm256_store_ps(dst[i].m_x, vecMadd(e[0], x, vecMadd(e[1], y, vecMadd(e[2], z, e[3]))));
+		_mm256_store_ps(dst[i].m_y, vecMadd(e[4], x, vecMadd(e[5], y, vecMadd(e[6], z, e[7]))));
+		_mm256_store_ps(dst[i].m_z, vecMadd(e[8], x, vecMadd(e[9], y, vecMadd(e[10], z, e[11]))));
+	}
+}
+
+void multiply(const Matrix4 *lhsMatrices, const Matrix4 *rhsMatrices, Matrix4 *dstMatrices,
+	sizet count)
+{
+	const auto *lhs = reinterpret_cast<const float32*>(lhsMatrices);
+	const auto *rhs = reinterpret_cast<const float32*>(rhsMatrices);
+	auto *dst = reinterpret_cast<float32*>(dstMatrices);
+
+	for (sizet i = 0; i < count; ++i, lhs += 16, rhs += 16, dst += 16)
+	{
+		// Two rows of the result at once, every row is a combination of the rows of rhs
+		const __m256 a01 = _mm256_loadu_ps(lhs);
+		const __m256 a23 = _mm256_loadu_ps(lhs + 8);
+		const __m256 b0 = vecBroadcast4(rhs);
+		const __m256 b1 = vecBroadcast4(rhs + 4);
+		const __m256 b2 = vecBroadcast4(rhs + 8);
+		const __m256 b3 = vecBroadcast4(rhs + 12);
+
+		__m256 c01 = _mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0x00), b0);
+		__m256 c23 = _mm256_mul_ps(_mm256_shuffle_ps(a23, a23, 0x00), b0);
+		c01 = vecMadd(_mm256_shuffle_ps(a01, a01, 0x55), b1, c01);
+		c23 = vecMadd(_mm256_shuffle_ps(a23, a23, 0x55), b1, c23);
+		c01 = vecMadd(_mm256_shuffle_ps(a01, a01, 0xAA), b2, c01);
+		c23 = vecMadd(_mm256_shuffle_ps(a23, a23, 0xAA), b2, c23);
+		c01 = vecMadd(_mm256_shuffle_ps(a01, a01, 0xFF), b3, c01);
+		c23 = vecMadd(_mm256_shuffle_ps(a23, a23, 0xFF), b3, c23);
+
+		_mm256_storeu_ps(dst, c01);
+		_mm256_storeu_ps(dst + 8, c23);
+	}
+}
+
+void slerp(const QuaternionX8 *from, const QuaternionX8 *to, float32 t, QuaternionX8 *dst,
+	sizet count)
+{
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 half = _mm256_set1_ps(0.5f);
+	const __m256 one = _mm256_set1_ps(1.f);
+	const __m256 tv = _mm256_set1_ps(t);
+	const __m256 oneMinusT = _mm256_set1_ps(1.f - t);
+
+	for (sizet i = 0; i < count; ++i)
+	{
+		const __m256 a0 = _mm256_load_ps(from[i].m_q0);
+		const __m256 a1 = _mm256_load_ps(from[i].m_q1);
+		const __m256 a2 = _mm256_load_ps(from[i].m_q2);
+		const __m256 a3 = _mm256_load_ps(from[i].m_q3);
+		const __m256 b0 = _mm256_load_ps(to[i].m_q0);
+		const __m256 b1 = _mm256_load_ps(to[i].m_q1);
+		const __m256 b2 = _mm256_load_ps(to[i].m_q2);
+		const __m256 b3 = _mm256_load_ps(to[i].m_q3);
+
+		// Summed in the order of Quaternion::slerp
+		__m256 cosHalfTheta = _mm256_mul_ps(a0, b0);
+		cosHalfTheta = vecMadd(a1, b1, cosHalfTheta);
+		cosHalfTheta = vecMadd(a2, b2, cosHalfTheta);
+		cosHalfTheta = vecMadd(a3, b3, cosHalfTheta);
+
+		const __m256 halfTheta = vecAcos(_mm256_min_ps(_mm256_max_ps(cosHalfTheta,
+			_mm256_set1_ps(-1.f)), one));
+		const __m256 sinHalfTheta = _mm256_sqrt_ps(_mm256_max_ps(
+			_mm256_sub_ps(one, _mm256_mul_ps(cosHalfTheta, cosHalfTheta)), zero));
+
+		__m256 ratioA = _mm256_div_ps(vecSin(_mm256_mul_ps(oneMinusT, halfTheta)), sinHalfTheta);
+		__m256 ratioB = _mm256_div_ps(vecSin(_mm256_mul_ps(tv, halfTheta)), sinHalfTheta);
+
+		// The same special cases as Quaternion::slerp, the ratios of the other lanes
+		// may be infinite here and are dropped by the blend
+		const __m256 average = _mm256_cmp_ps(sinHalfTheta, _mm256_set1_ps(0.001f), _CMP_LT_OQ);
+		ratioA = _mm256_blendv_ps(ratioA, half, average);
+		ratioB = _mm256_blendv_ps(ratioB, half, average);
+
+		const __m256 same = _mm256_cmp_ps(
+			_mm256_andnot_ps(_mm256_set1_ps(-0.f), cosHalfTheta), one, _CMP_GE_OQ);
+		ratioA = _mm256_blendv_ps(ratioA, one, same);
+		ratioB = _mm256_blendv_ps(ratioB, zero, same);
+
+		_mm256_store_ps(dst[i].m_q0, vecMadd(a0, ratioA, _mm256_mul_ps(b0, ratioB)));
+		_mm256_store_ps(dst[i].m_q1, vecMadd(a1, ratioA, _mm256_mul_ps(b1, ratioB)));
+		_mm256_store_ps(dst[i].m_q2, vecMadd(a2, ratioA, _mm256_mul_ps(b2, ratioB)));
+		_mm256_store_ps(dst[i].m_q3, vecMadd(a3, ratioA, _mm256_mul_ps(b3, ratioB)));
+	}
+}
+
+sizet cullSpheres(const Frustum &frustum, const SphereX8 *spheres, sizet count,
+	uint32 *visible)
+{
+	const auto *planes = reinterpret_cast<const float32*>(&frustum);
+
+	__m256 p[24];
+	for (sizet i = 0; i < 24; ++i)
+	{
+		p[i] = _mm256_broadcast_ss(planes + i);
+	}
+
+	const sizet numBlocks = (count + SphereX8::LANES - 1) / SphereX8::LANES;
+	sizet numVisible = 0;
+
+	for (sizet block = 0; block < numBlocks; ++block)
+	{
+		const __m256 x = _mm256_load_ps(spheres[block].m_x);
+		const __m256 y = _mm256_load_ps(spheres[block].m_y);
+		const __m256 z = _mm256_load_ps(spheres[block].m_z);
+		const __m256 negRadius = _mm256_xor_ps(_mm256_load_ps(spheres[block].m_radius),
+			_mm256_set1_ps(-0.f));
+
+		// A sphere is culled, when its center is further than the radius behind any plane
+		__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		for (sizet i = 0; i < 24; i += 4)
+		{
+			const __m256 d = vecMadd(p[i], x, vecMadd(p[i + 1], y, vecMadd(p[i + 2], z, p[i + 3])));
+			inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, negRadius, _CMP_GE_OQ));
+		}
+
+		numVisible = appendVisible(_mm256_movemask_ps(inside), block, count, visible, numVisible);
+	}
+
+	return numVisible;
+}
+
+sizet cullAabbs(const Frustum &frustum, const AabbX8 *boxes, sizet count, uint32 *visible)
+{
+	const auto *planes = reinterpret_cast<const float32*>(&frustum);
+	const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+
+	__m256 p[24];
+	__m256 absP[24];
+	for (sizet i = 0; i < 24; ++i)
+	{
+		p[i] = _mm256_broadcast_ss(planes + i);
+		absP[i] = _mm256_and_ps(p[i], absMask);
+	}
+
+	const sizet numBlocks = (count + AabbX8::LANES - 1) / AabbX8::LANES;
+	sizet numVisible = 0;
+
+	for (sizet block = 0; block < numBlocks; ++block)
+	{
+		const __m256 cx = _mm256_load_ps(boxes[block].m_centerX);
+		const __m256 cy = _mm256_load_ps(boxes[block].m_centerY);
+		const __m256 cz = _mm256_load_ps(boxes[block].m_centerZ);
+		const __m256 ex = _mm256_load_ps(boxes[block].m_extentX);
+		const __m256 ey = _mm256_load_ps(boxes[block].m_extentY);
+		const __m256 ez = _mm256_load_ps(boxes[block].m_extentZ);
+
+		// The extents projected on the normal act as the radius, see Frustum::isVisible
+		__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		for (sizet i = 0; i < 24; i += 4)
+		{
+			const __m256 d = vecMadd(p[i], cx,
+				vecMadd(p[i + 1], cy, vecMadd(p[i + 2], cz, p[i + 3])));
+			const __m256 radius = vecMadd(absP[i], ex,
+				vecMadd(absP[i + 1], ey, _mm256_mul_ps(absP[i + 2], ez)));
+			inside = _mm256_and_ps(inside,
+				_mm256_cmp_ps(d, _mm256_xor_ps(radius, _mm256_set1_ps(-0.f)), _CMP_GE_OQ));
+		}
+
+		numVisible = appendVisible(_mm256_movemask_ps(inside), block, count, visible, numVisible);
+	}
+
+	return numVisible;
+}
+} // namespace
+} // namespace argon::math::batchimpl
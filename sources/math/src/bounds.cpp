@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "bounds.hpp"
+#include "matrix4.hpp"
+
+namespace argon::math
+{
+const Aabb AR_ATTR_ALIGN(16) Aabb::c_empty = Aabb(
+	Vector3(std::numeric_limits<float32>::max(), std::numeric_limits<float32>::max(),
+		std::numeric_limits<float32>::max()),
+	Vector3(-std::numeric_limits<float32>::max(), -std::numeric_limits<float32>::max(),
+		-std::numeric_limits<float32>::max()));
+
+Aabb& AR_VEC_CALL Aabb::merge(const Vector3 &point)
+{
+	m_min.set(std::min(m_min[0], point[0]), std::min(m_min[1], point[1]),
+		std::min(m_min[2], point[2]));
+	m_max.set(std::max(m_max[0], point[0]), std::max(m_max[1], point[1]),
+		std::max(m_max[2], point[2]));
+
+	return *this;
+}
+
+Aabb& AR_VEC_CALL Aabb::merge(const Aabb &other)
+{
+	m_min.set(std::min(m_min[0], other.m_min[0]), std::min(m_min[1], other.m_min[1]),
+		std::min(m_min[2], other.m_min[2]));
+	m_max.set(std::max(m_max[0], other.m_max[0]), std::max(m_max[1], other.m_max[1]),
+		std::max(m_max[2], other.m_max[2]));
+
+	return *this;
+}
+
+Aabb AR_VEC_CALL Aabb::getTransformed(const Matrix4 &m) const
+{
+	AR_ASSERT_MSG(!isEmpty(), "Box is empty");
+
+	// Every extent of the result is the projection of the transformed extents on its axis
+	const Vector3 center = m * getCenter();
+	const Vector3 extents = getExtents();
+	float32 newExtents[3];
+
+	for (int32 i = 0; i < 3; ++i)
+	{
+		newExtents[i] = std::abs(m[i][0]) * extents[0] + std::abs(m[i][1]) * extents[1]
+			+ std::abs(m[i][2]) * extents[2];
+	}
+
+	const Vector3 delta(newExtents[0], newExtents[1], newExtents[2]);
+
+	return Aabb(center - delta, center + delta);
+}
+
+void AR_VEC_CALL Frustum::set(const Matrix4 &viewProjection)
+{
+	// The clip coordinates are the dot products with the rows, -w <= x <= w gives
+	// the planes w + x >= 0 and w - x >= 0, the same for y, and 0 <= z <= w
+	const Vector4 &x = viewProjection[0];
+	const Vector4 &y = viewProjection[1];
+	const Vector4 &z = viewProjection[2];
+	const Vector4 &w = viewProjection[3];
+
+	m_planes[static_cast<int32>(Side::Left)] = Plane(w + x).normalize();
+	m_planes[static_cast<int32>(Side::Right)] = Plane(w - x).normalize();
+	m_planes[static_cast<int32>(Side::Bottom)] = Plane(w + y).normalize();
+	m_planes[static_cast<int32>(Side::Top)] = Plane(w - y).normalize();
+	m_planes[static_cast<int32>(Side::Near)] = Plane(z).normalize();
+	m_planes[static_cast<int32>(Side::Far)] = Plane(w - z).normalize();
+}
+
+bool AR_VEC_CALL Frustum::isVisible(const Vector3 &point) const
+{
+	for (const Plane &plane : m_planes)
+	{
+		if (plane.getSignedDistance(point) < 0.f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool AR_VEC_CALL Frustum::isVisible(const Sphere &sphere) const
+{
+	for (const Plane &plane : m_planes)
+	{
+		if (plane.getSignedDistance(sphere.getCenter()) < -sphere.getRadius())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool AR_VEC_CALL Frustum::isVisible(const Aabb &box) const
+{
+	const Vector3 center = box.getCenter();
+	const Vector3 extents = box.getExtents();
+
+	for (const Plane &plane : m_planes)
+	{
+		// The extents projected on the normal, the corner furthest along it decides
+		const Vector3 normal = plane.getNormal();
+		const float32 radius = std::abs(normal[0]) * extents[0] + std::abs(normal[1]) * extents[1]
+			+ std::abs(normal[2]) * extents[2];
+
+		if (plane.getSignedDistance(center) < -radius)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+} // namespace argon::math
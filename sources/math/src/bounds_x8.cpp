@@ -0,0 +1,97 @@
+#include <fundamental/debug.hpp>
+
+#include "bounds.hpp"
+#include "bounds_x8.hpp"
+#include "vector3.hpp"
+
+namespace argon::math
+{
+SphereX8::SphereX8()
+{
+
+}
+
+SphereX8::SphereX8(const Sphere *s)
+{
+	load(s);
+}
+
+void SphereX8::load(const Sphere *s)
+{
+	for (int32 i = 0; i < LANES; ++i)
+	{
+		setLane(i, s[i]);
+	}
+}
+
+void SphereX8::store(Sphere *s) const
+{
+	for (int32 i = 0; i < LANES; ++i)
+	{
+		s[i] = getLane(i);
+	}
+}
+
+Sphere SphereX8::getLane(int32 i) const
+{
+	AR_ASSERT_MSG(i >= 0 && i < LANES, "Index is out of range");
+	return Sphere(Vector3(m_x[i], m_y[i], m_z[i]), m_radius[i]);
+}
+
+void SphereX8::setLane(int32 i, const Sphere &s)
+{
+	AR_ASSERT_MSG(i >= 0 && i < LANES, "Index is out of range");
+	const Vector3 &center = s.getCenter();
+	m_x[i] = center[0];
+	m_y[i] = center[1];
+	m_z[i] = center[2];
+	m_radius[i] = s.getRadius();
+}
+
+AabbX8::AabbX8()
+{
+
+}
+
+AabbX8::AabbX8(const Aabb *b)
+{
+	load(b);
+}
+
+void AabbX8::load(const Aabb *b)
+{
+	for (int32 i = 0; i < LANES; ++i)
+	{
+		setLane(i, b[i]);
+	}
+}
+
+void AabbX8::store(Aabb *b) const
+{
+	for (int32 i = 0; i < LANES; ++i)
+	{
+		b[i] = getLane(i);
+	}
+}
+
+Aabb AabbX8::getLane(int32 i) const
+{
+	AR_ASSERT_MSG(i >= 0 && i < LANES, "Index is out of range");
+	const Vector3 center(m_centerX[i], m_centerY[i], m_centerZ[i]);
+	const Vector3 extents(m_extentX[i], m_extentY[i], m_extentZ[i]);
+	return Aabb(center - extents, center + extents);
+}
+
+void AabbX8::setLane(int32 i, const Aabb &b)
+{
+	AR_ASSERT_MSG(i >= 0 && i < LANES, "Index is out of range");
+	const Vector3 center = b.getCenter();
+	const Vector3 extents = b.getExtents();
+	m_centerX[i] = center[0];
+	m_centerY[i] = center[1];
+	m_centerZ[i] = center[2];
+	m_extentX[i] = extents[0];
+	m_extentY[i] = extents[1];
+	m_extentZ[i] = extents[2];
+}
+} // namespace argon::math
@@ -0,0 +1,9 @@
+// Out-of-line definitions of the operations inlined in the headers, see inline.hpp
+#define AR_MATH_EXPORT_INLINES
+
+#include "matrix3.hpp"
+#include "matrix4.hpp"
+#include "quaternion.hpp"
+#include "vector2.hpp"
+#include "vector3.hpp"
+#include "vector4.hpp"
@@ -12,17 +12,6 @@ namespace argon::math
 const Matrix3 AR_ATTR_ALIGN(16) Matrix3::c_identity(Vector3::c_xAxis, Vector3::c_yAxis,
 																										Vector3::c_zAxis);
 
-Matrix3::Matrix3()
-{
-}
-
-AR_VEC_CALL Matrix3::Matrix3(const Matrix3 &other)
-{
-	m_rows[0] = other.m_rows[0];
-	m_rows[1] = other.m_rows[1];
-	m_rows[2] = other.m_rows[2];
-}
-
 AR_VEC_CALL Matrix3::Matrix3(const Quaternion &q)
 {
 	float32 s = q.getLengthSq();
@@ -97,42 +86,6 @@ AR_VEC_CALL Matrix3::Matrix3(const Quaternion &q)
 #endif // ifdef AR_SIMD
 }
 
-AR_VEC_CALL Matrix3::Matrix3(
-		float32 e00, float32 e01, float32 e02,
-		float32 e10, float32 e11, float32 e12,
-		float32 e20, float32 e21, float32 e22)
-{
-	m_rows[0].set(e00, e01, e02);
-	m_rows[1].set(e10, e11, e12);
-	m_rows[2].set(e20, e21, e22);
-}
-
-AR_VEC_CALL Matrix3::Matrix3(const Vector3 &v0, const Vector3 &v1,
-														 const Vector3 &v2)
-{
-	m_rows[0] = v0;
-	m_rows[1] = v1;
-	m_rows[2] = v2;
-}
-
-#ifdef AR_SIMD
-AR_VEC_CALL Matrix3::Matrix3(__m128 v0, __m128 v1, __m128 v2)
-{
-	m_rows[0] = Vector3(v0);
-	m_rows[1] = Vector3(v1);
-	m_rows[2] = Vector3(v2);
-}
-#endif // ifdef AR_SIMD
-
-Matrix3& AR_VEC_CALL Matrix3::operator=(const Matrix3 &other)
-{
-	m_rows[0] = other.m_rows[0];
-	m_rows[1] = other.m_rows[1];
-	m_rows[2] = other.m_rows[2];
-
-	return *this;
-}
-
 void AR_VEC_CALL Matrix3::set(float32 e00, float32 e01, float32 e02,
 															float32 e10, float32 e11, float32 e12,
 															float32 e20, float32 e21, float32 e22)
@@ -329,7 +282,6 @@ Matrix3 AR_VEC_CALL Matrix3::getTransposed(void) const
 	const __m128 temp = _mm_unpackhi_ps(m_rows[0].get128(), m_rows[1].get128());
 	__m128 v0 = _mm_unpacklo_ps(m_rows[0].get128(), m_rows[1].get128());
 
-
 	const __m128 v1 = _mm_shuffle_ps(v0, m_rows[2].get128(), 0xDE); //_MM_SHUFFLE(3, 1, 3, 2)
 	const __m128 v2 = _mm_shuffle_ps(temp, m_rows[2].get128(), 0xE4); //_MM_SHUFFLE(3, 2, 1, 0)
 	v0 = _mm_shuffle_ps(v0, m_rows[2].get128(), 0xC4); //_MM_SHUFFLE(3, 0, 1, 0)
@@ -383,185 +335,6 @@ Matrix3& AR_VEC_CALL Matrix3::invert(void)
 	return *this;
 }
 
-Vector3 AR_VEC_CALL Matrix3::getColumn(int32 i) const
-{
-	AR_ASSERT_MSG(0 <= i && i < 3, "Index is out of range");
-
-	return Vector3(m_rows[0][i], m_rows[1][i], m_rows[2][i]);
-}
-
-void AR_VEC_CALL Matrix3::setColumn(int32 i, const Vector3 &v)
-{
-	AR_ASSERT_MSG(0 <= i && i < 3, "Index is out of range");
-
-	m_rows[0][i] = v[0];
-	m_rows[1][i] = v[1];
-	m_rows[2][i] = v[2];
-}
-
-Vector3& AR_VEC_CALL Matrix3::operator[](int32 i)
-{
-	AR_ASSERT_MSG(0 <= i && i < 3, "Index is out of range");
-
-	return m_rows[i];
-}
-
-const Vector3& AR_VEC_CALL Matrix3::operator[](int32 i) const
-{
-	AR_ASSERT_MSG(0 <= i && i < 3, "Index is out of range");
-
-	return m_rows[i];
-}
-
-Matrix3 AR_VEC_CALL Matrix3::operator+(const Matrix3 &other) const
-{
-	return Matrix3(m_rows[0] + other.m_rows[0], m_rows[1] + other.m_rows[1],
-		m_rows[2] + other.m_rows[2]);
-}
-
-Matrix3 AR_VEC_CALL Matrix3::operator-(const Matrix3 &other) const
-{
-	return Matrix3(m_rows[0] - other.m_rows[0], m_rows[1] - other.m_rows[1],
-		m_rows[2] - other.m_rows[2]);
-}
-
-Matrix3 AR_VEC_CALL Matrix3::operator*(const Matrix3 &other) const
-{
-#ifdef AR_SIMD
-	const __m128 tv0 = m_rows[0].get128();
-	const __m128 tv1 = m_rows[1].get128();
-	const __m128 tv2 = m_rows[2].get128();
-	const __m128 mv0 = other.m_rows[0].get128();
-	const __m128 mv1 = other.m_rows[1].get128();
-	const __m128 mv2 = other.m_rows[2].get128();
-
-	__m128 v00 = _mm_shuffle_ps(tv0, tv0, 0x0);
-	__m128 v01 = _mm_shuffle_ps(tv0, tv0, 0x55);
-	__m128 v02 = _mm_shuffle_ps(tv0, tv0, 0xAA);
-
-	v00 = _mm_mul_ps(v00, mv0);
-	v01 = _mm_mul_ps(v01, mv1);
-	v02 = _mm_mul_ps(v02, mv2);
-
-	__m128 v10 = _mm_shuffle_ps(tv1, tv1, 0x0);
-	__m128 v11 = _mm_shuffle_ps(tv1, tv1, 0x55);
-	__m128 v12 = _mm_shuffle_ps(tv1, tv1, 0xAA);
-
-	v10 = _mm_mul_ps(v10, mv0);
-	v11 = _mm_mul_ps(v11, mv1);
-	v12 = _mm_mul_ps(v12, mv2);
-
-	__m128 v20 = _mm_shuffle_ps(tv2, tv2, 0x0);
-	__m128 v21 = _mm_shuffle_ps(tv2, tv2, 0x55);
-	__m128 v22 = _mm_shuffle_ps(tv2, tv2, 0xAA);
-
-	v20 = _mm_mul_ps(v20, mv0);
-	v21 = _mm_mul_ps(v21, mv1);
-	v22 = _mm_mul_ps(v22, mv2);
-
-	return Matrix3(_mm_add_ps(v00, _mm_add_ps(v01, v02)),
-								 _mm_add_ps(v10, _mm_add_ps(v11, v12)),
-								 _mm_add_ps(v20, _mm_add_ps(v21, v22)));
-#else
-	return Matrix3(
-			m_rows[0].dot(other.getColumn(0)), m_rows[0].dot(other.getColumn(1)),
-				m_rows[0].dot(other.getColumn(2)),
-			m_rows[1].dot(other.getColumn(0)), m_rows[1].dot(other.getColumn(1)),
-				m_rows[1].dot(other.getColumn(2)),
-			m_rows[2].dot(other.getColumn(0)), m_rows[2].dot(other.getColumn(1)),
-				m_rows[2].dot(other.getColumn(2)));
-#endif // ifdef AR_SIMD
-}
-
-Matrix3& AR_VEC_CALL Matrix3::operator*=(const Matrix3 &other)
-{
-#ifdef AR_SIMD
-	const __m128 tv0 = m_rows[0].get128();
-	const __m128 tv1 = m_rows[1].get128();
-	const __m128 tv2 = m_rows[2].get128();
-	__m128 mv0 = other.m_rows[0].get128();
-	__m128 mv1 = other.m_rows[1].get128();
-	__m128 mv2 = other.m_rows[2].get128();
-
-	__m128 v00 = _mm_shuffle_ps(tv0, tv0, 0x0);
-	__m128 v01 = _mm_shuffle_ps(tv0, tv0, 0x55);
-	__m128 v02 = _mm_shuffle_ps(tv0, tv0, 0xAA);
-
-	v00 = _mm_mul_ps(v00, mv0);
-	v01 = _mm_mul_ps(v01, mv1);
-	v02 = _mm_mul_ps(v02, mv2);
-
-	__m128 v10 = _mm_shuffle_ps(tv1, tv1, 0x0);
-	__m128 v11 = _mm_shuffle_ps(tv1, tv1, 0x55);
-	__m128 v12 = _mm_shuffle_ps(tv1, tv1, 0xAA);
-
-	v10 = _mm_mul_ps(v10, mv0);
-	v11 = _mm_mul_ps(v11, mv1);
-	v12 = _mm_mul_ps(v12, mv2);
-
-	__m128 v20 = _mm_shuffle_ps(tv2, tv2, 0x0);
-	__m128 v21 = _mm_shuffle_ps(tv2, tv2, 0x55);
-	__m128 v22 = _mm_shuffle_ps(tv2, tv2, 0xAA);
-
-	v20 = _mm_mul_ps(v20, mv0);
-	v21 = _mm_mul_ps(v21, mv1);
-	v22 = _mm_mul_ps(v22, mv2);
-
-	m_rows[0] = Vector3(_mm_add_ps(v00, _mm_add_ps(v01, v02)));
-	m_rows[1] = Vector3(_mm_add_ps(v10, _mm_add_ps(v11, v12)));
-	m_rows[2] = Vector3(_mm_add_ps(v20, _mm_add_ps(v21, v22)));
-#else
-	set(
-		m_rows[0].dot(other.getColumn(0)), m_rows[0].dot(other.getColumn(1)),
-			m_rows[0].dot(other.getColumn(2)),
-		m_rows[1].dot(other.getColumn(0)), m_rows[1].dot(other.getColumn(1)),
-			m_rows[1].dot(other.getColumn(2)),
-		m_rows[2].dot(other.getColumn(0)), m_rows[2].dot(other.getColumn(1)),
-			m_rows[2].dot(other.getColumn(2)));
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Matrix3& AR_VEC_CALL Matrix3::operator+=(const Matrix3 &other)
-{
-	m_rows[0] += other.m_rows[0];
-	m_rows[1] += other.m_rows[1];
-	m_rows[2] += other.m_rows[2];
-
-	return *this;
-}
-
-Matrix3& AR_VEC_CALL Matrix3::operator-=(const Matrix3 &other)
-{
-	m_rows[0] -= other.m_rows[0];
-	m_rows[1] -= other.m_rows[1];
-	m_rows[2] -= other.m_rows[2];
-
-	return *this;
-}
-
-Matrix3 AR_VEC_CALL Matrix3::operator*(float32 s) const
-{
-	return Matrix3(m_rows[0] * s, m_rows[1] * s, m_rows[2] * s);
-}
-
-Vector3 AR_VEC_CALL Matrix3::operator*(const Vector3 &v) const
-{
-	return Vector3(m_rows[0].dot(v), m_rows[1].dot(v), m_rows[2].dot(v));
-}
-
-bool AR_VEC_CALL Matrix3::operator==(const Matrix3 &other) const
-{
-	return (m_rows[0] == other.m_rows[0]) && (m_rows[1] == other.m_rows[1])
-		&& (m_rows[2] == other.m_rows[2]);
-}
-
-bool AR_VEC_CALL Matrix3::operator!=(const Matrix3 &other) const
-{
-	return !(*this == other);
-}
-
 float32 AR_VEC_CALL Matrix3::_cofactor(int32 r1, int32 c1, int32 r2, int32 c2) const
 {
 	return m_rows[r1][c1] * m_rows[r2][c2] - m_rows[r2][c1] * m_rows[r1][c2];
@@ -8,24 +8,27 @@
 
 namespace argon::math
 {
+#ifdef AR_SIMD
+namespace
+{
+// The w elements of the arguments have to be zero, the result's w is zero too
+__m128 cross(__m128 a, __m128 b)
+{
+	const __m128 ayzx = _mm_shuffle_ps(a, a, 0xC9); //_MM_SHUFFLE(3, 0, 2, 1)
+	const __m128 byzx = _mm_shuffle_ps(b, b, 0xC9);
+	const __m128 c = _mm_sub_ps(_mm_mul_ps(a, byzx), _mm_mul_ps(ayzx, b));
+
+	return _mm_shuffle_ps(c, c, 0xC9);
+}
+} // namespace
+#endif // ifdef AR_SIMD
+
 const Matrix4 AR_ATTR_ALIGN(16) Matrix4::c_identity(
 	1.f, 0.f, 0.f, 0.f,
 	0.f, 1.f, 0.f, 0.f,
 	0.f, 0.f, 1.f, 0.f,
 	0.f, 0.f, 0.f, 1.f);
 
-Matrix4::Matrix4()
-{
-}
-
-AR_VEC_CALL Matrix4::Matrix4(const Matrix4 &other)
-{
-	m_rows[0] = other.m_rows[0];
-	m_rows[1] = other.m_rows[1];
-	m_rows[2] = other.m_rows[2];
-	m_rows[3] = other.m_rows[3];
-}
-
 AR_VEC_CALL Matrix4::Matrix4(const Quaternion &q)
 {
 	float32 s = q.getLength();
@@ -105,57 +108,6 @@ AR_VEC_CALL Matrix4::Matrix4(const Quaternion &q)
 #endif // ifdef AR_SIMD
 }
 
-AR_VEC_CALL Matrix4::Matrix4(
-			float32 e00, float32 e01, float32 e02, float32 e03,
-			float32 e10, float32 e11, float32 e12, float32 e13,
-			float32 e20, float32 e21, float32 e22, float32 e23,
-			float32 e30, float32 e31, float32 e32, float32 e33)
-{
-	m_rows[0].set(e00, e01, e02, e03);
-	m_rows[1].set(e10, e11, e12, e13);
-	m_rows[2].set(e20, e21, e22, e23);
-	m_rows[3].set(e30, e31, e32, e33);
-}
-
-AR_VEC_CALL Matrix4::Matrix4(const Vector4 &v0, const Vector4 &v1,
-														 const Vector4 &v2, const Vector4 &v3)
-{
-	m_rows[0] = v0;
-	m_rows[1] = v1;
-	m_rows[2] = v2;
-	m_rows[3] = v3;
-}
-
-// Will set e33 to 1.0
-AR_VEC_CALL Matrix4::Matrix4(const Vector3 &v0, const Vector3 &v1,
-														 const Vector3 &v2, const Vector3 &v3)
-{
-	m_rows[0].set(v0.getX(), v1.getX(), v2.getX(), v3.getX());
-	m_rows[1].set(v0.getY(), v1.getY(), v2.getY(), v3.getY());
-	m_rows[2].set(v0.getZ(), v1.getZ(), v2.getZ(), v3.getZ());
-	m_rows[3].set(0.f, 0.f, 0.f, 1.f);
-}
-
-#ifdef AR_SIMD
-AR_VEC_CALL Matrix4::Matrix4(__m128 v0, __m128 v1, __m128 v2, __m128 v3)
-	{
-		m_rows[0] = Vector4(v0);
-		m_rows[1] = Vector4(v1);
-		m_rows[2] = Vector4(v2);
-		m_rows[3] = Vector4(v3);
-	}
-#endif
-
-Matrix4& AR_VEC_CALL Matrix4::operator=(const Matrix4 &other)
-{
-	m_rows[0] = other.m_rows[0];
-	m_rows[1] = other.m_rows[1];
-	m_rows[2] = other.m_rows[2];
-	m_rows[3] = other.m_rows[3];
-
-	return *this;
-}
-
 void AR_VEC_CALL Matrix4::set(
 			float32 e00, float32 e01, float32 e02, float32 e03,
 			float32 e10, float32 e11, float32 e12, float32 e13,
@@ -975,63 +927,63 @@ Matrix4 AR_VEC_CALL Matrix4::getInverted(void) const
 		= m_rows[1][1] * (m_rows[2][2] * m_rows[3][3] - m_rows[3][2] * m_rows[2][3])
 		- m_rows[2][1] * (m_rows[1][2] * m_rows[3][3] - m_rows[3][2] * m_rows[1][3])
 		+ m_rows[3][1] * (m_rows[1][2] * m_rows[2][3] - m_rows[2][2] * m_rows[1][3]);
-	float32 c01
+	const float32 c01
 		= m_rows[1][0] * (m_rows[2][2] * m_rows[3][3] - m_rows[3][2] * m_rows[2][3])
 		- m_rows[2][0] * (m_rows[1][2] * m_rows[3][3] - m_rows[3][2] * m_rows[1][3])
 		+ m_rows[3][0] * (m_rows[1][2] * m_rows[2][3] - m_rows[2][2] * m_rows[1][3]);
-	float32 c02
+	const float32 c02
 		= m_rows[1][0] * (m_rows[2][1] * m_rows[3][3] - m_rows[3][1] * m_rows[2][3])
 		- m_rows[2][0] * (m_rows[1][1] * m_rows[3][3] - m_rows[3][1] * m_rows[1][3])
 		+ m_rows[3][0] * (m_rows[1][1] * m_rows[2][3] - m_rows[2][1] * m_rows[1][3]);
-	float32 c03
+	const float32 c03
 		= m_rows[1][0] * (m_rows[2][1] * m_rows[3][2] - m_rows[3][1] * m_rows[2][2])
 		- m_rows[2][0] * (m_rows[1][1] * m_rows[3][2] - m_rows[3][1] * m_rows[1][2])
 		+ m_rows[3][0] * (m_rows[1][1] * m_rows[2][2] - m_rows[2][1] * m_rows[1][2]);
-	float32 c10
+	const float32 c10
 		= m_rows[0][1] * (m_rows[2][2] * m_rows[3][3] - m_rows[3][2] * m_rows[2][3])
 		- m_rows[2][1] * (m_rows[0][2] * m_rows[3][3] - m_rows[3][2] * m_rows[0][3])
 		+ m_rows[3][1] * (m_rows[0][2] * m_rows[2][3] - m_rows[2][2] * m_rows[0][3]);
-	float32 c11
+	const float32 c11
 		= m_rows[0][0] * (m_rows[2][2] * m_rows[3][3] - m_rows[3][2] * m_rows[2][3])
 		- m_rows[2][0] * (m_rows[0][2] * m_rows[3][3] - m_rows[3][2] * m_rows[0][3])
 		+ m_rows[3][0] * (m_rows[0][2] * m_rows[2][3] - m_rows[2][2] * m_rows[0][3]);
-	float32 c12
+	const float32 c12
 		= m_rows[0][0] * (m_rows[2][1] * m_rows[3][3] - m_rows[3][1] * m_rows[2][3])
 		- m_rows[2][0] * (m_rows[0][1] * m_rows[3][3] - m_rows[3][1] * m_rows[0][3])
 		+ m_rows[3][0] * (m_rows[0][1] * m_rows[2][3] - m_rows[2][1] * m_rows[0][3]);
-	float32 c13
+	const float32 c13
 		= m_rows[0][0] * (m_rows[2][1] * m_rows[3][2] - m_rows[3][1] * m_rows[2][2])
 		- m_rows[2][0] * (m_rows[0][1] * m_rows[3][2] - m_rows[3][1] * m_rows[0][2])
 		+ m_rows[3][0] * (m_rows[0][1] * m_rows[2][2] - m_rows[2][1] * m_rows[0][2]);
-	float32 c20
+	const float32 c20
 		= m_rows[0][1] * (m_rows[1][2] * m_rows[3][3] - m_rows[3][2] * m_rows[1][3])
 		- m_rows[1][1] * (m_rows[0][2] * m_rows[3][3] - m_rows[3][2] * m_rows[0][3])
 		+ m_rows[3][1] * (m_rows[0][2] * m_rows[1][3] - m_rows[1][2] * m_rows[0][3]);
-	float32 c21
+	const float32 c21
 		= m_rows[0][0] * (m_rows[1][2] * m_rows[3][3] - m_rows[3][2] * m_rows[1][3])
 		- m_rows[1][0] * (m_rows[0][2] * m_rows[3][3] - m_rows[3][2] * m_rows[0][3])
-		+ m_rows[3][0] * (m_rows[0][2] * m_rows[1][3] - m_rows[1][2] * m_rows[1][3]);
-	float32 c22
-		= m_rows[0][0] * (m_rows[1][1] * m_rows[3][3] - m_rows[3][2] * m_rows[1][3])
-		- m_rows[1][0] * (m_rows[0][1] * m_rows[3][3] - m_rows[3][2] * m_rows[0][3])
+		+ m_rows[3][0] * (m_rows[0][2] * m_rows[1][3] - m_rows[1][2] * m_rows[0][3]);
+	const float32 c22
+		= m_rows[0][0] * (m_rows[1][1] * m_rows[3][3] - m_rows[3][1] * m_rows[1][3])
+		- m_rows[1][0] * (m_rows[0][1] * m_rows[3][3] - m_rows[3][1] * m_rows[0][3])
 		+ m_rows[3][0] * (m_rows[0][1] * m_rows[1][3] - m_rows[1][1] * m_rows[0][3]);
-	float32 c23
-		= m_rows[0][0] * (m_rows[1][1] * m_rows[3][2] - m_rows[3][2] * m_rows[1][2])
-		- m_rows[1][0] * (m_rows[0][1] * m_rows[3][2] - m_rows[3][2] * m_rows[0][2])
+	const float32 c23
+		= m_rows[0][0] * (m_rows[1][1] * m_rows[3][2] - m_rows[3][1] * m_rows[1][2])
+		- m_rows[1][0] * (m_rows[0][1] * m_rows[3][2] - m_rows[3][1] * m_rows[0][2])
 		+ m_rows[3][0] * (m_rows[0][1] * m_rows[1][2] - m_rows[1][1] * m_rows[0][2]);
-	float32 c30
+	const float32 c30
 		= m_rows[0][1] * (m_rows[1][2] * m_rows[2][3] - m_rows[2][2] * m_rows[1][3])
 		- m_rows[1][1] * (m_rows[0][2] * m_rows[2][3] - m_rows[2][2] * m_rows[0][3])
 		+ m_rows[2][1] * (m_rows[0][2] * m_rows[1][3] - m_rows[1][2] * m_rows[0][3]);
-	float32 c31
+	const float32 c31
 		= m_rows[0][0] * (m_rows[1][2] * m_rows[2][3] - m_rows[2][2] * m_rows[1][3])
 		- m_rows[1][0] * (m_rows[0][2] * m_rows[2][3] - m_rows[2][2] * m_rows[0][3])
 		+ m_rows[2][0] * (m_rows[0][2] * m_rows[1][3] - m_rows[1][2] * m_rows[0][3]);
-	float32 c32
+	const float32 c32
 		= m_rows[0][0] * (m_rows[1][1] * m_rows[2][3] - m_rows[2][1] * m_rows[1][3])
 		- m_rows[1][0] * (m_rows[0][1] * m_rows[2][3] - m_rows[2][1] * m_rows[0][3])
-		+ m_rows[2][0] * (m_rows[0][1] * m_rows[1][3] - m_rows[1][1] * m_rows[1][3]);
-	float32 c33
+		+ m_rows[2][0] * (m_rows[0][1] * m_rows[1][3] - m_rows[1][1] * m_rows[0][3]);
+	const float32 c33
 		= m_rows[0][0] * (m_rows[1][1] * m_rows[2][2] - m_rows[2][1] * m_rows[1][2])
 		- m_rows[1][0] * (m_rows[0][1] * m_rows[2][2] - m_rows[2][1] * m_rows[0][2])
 		+ m_rows[2][0] * (m_rows[0][1] * m_rows[1][2] - m_rows[1][1] * m_rows[0][2]);
@@ -1053,6 +1005,109 @@ Matrix4& AR_VEC_CALL Matrix4::invert(void)
 	return *this;
 }
 
+Matrix4 AR_VEC_CALL Matrix4::getInvertedAffine(void) const
+{
+	AR_ASSERT_MSG(m_rows[3] == Vector4::c_wAxis, "The matrix is not affine");
+	AR_ASSERT_MSG(getDeterminantFast() != 0.f, "Determinant is zero");
+
+	// The inverse of the 3x3 part has the columns (r1 x r2, r2 x r0, r0 x r1) / det,
+	// the translation is moved by the inverse and negated
+#ifdef AR_SIMD
+	const __m128 r0 = m_rows[0].get128();
+	const __m128 r1 = m_rows[1].get128();
+	const __m128 r2 = m_rows[2].get128();
+	const __m128 a = _mm_and_ps(r0, utils::c_SIMDXYZMask);
+	const __m128 b = _mm_and_ps(r1, utils::c_SIMDXYZMask);
+	const __m128 c = _mm_and_ps(r2, utils::c_SIMDXYZMask);
+
+	__m128 c0 = cross(b, c);
+	__m128 c1 = cross(c, a);
+	__m128 c2 = cross(a, b);
+
+	__m128 det = _mm_mul_ps(a, c0);
+	const __m128 z = _mm_movehl_ps(det, det);
+	const __m128 y = _mm_shuffle_ps(det, det, 0xFD); //_MM_SHUFFLE(3, 3, 3, 1)
+	det = _mm_add_ps(z, _mm_add_ps(y, det));
+
+	const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.f), _mm_shuffle_ps(det, det, 0x0));
+	c0 = _mm_mul_ps(c0, invDet);
+	c1 = _mm_mul_ps(c1, invDet);
+	c2 = _mm_mul_ps(c2, invDet);
+
+	__m128 t = _mm_mul_ps(c0, _mm_shuffle_ps(r0, r0, 0xFF)); //_MM_SHUFFLE(3, 3, 3, 3)
+	t = _mm_add_ps(t, _mm_mul_ps(c1, _mm_shuffle_ps(r1, r1, 0xFF)));
+	t = _mm_add_ps(t, _mm_mul_ps(c2, _mm_shuffle_ps(r2, r2, 0xFF)));
+	t = _mm_sub_ps(Vector4::c_wAxis.get128(), t);
+
+	return Matrix4(c0, c1, c2, t).getTransposed();
+#else
+	const Vector3 a(m_rows[0][0], m_rows[0][1], m_rows[0][2]);
+	const Vector3 b(m_rows[1][0], m_rows[1][1], m_rows[1][2]);
+	const Vector3 c(m_rows[2][0], m_rows[2][1], m_rows[2][2]);
+
+	const Vector3 bc = b.cross(c);
+	const float32 invDet = 1.f / a.dot(bc);
+	const Vector3 c0 = bc * invDet;
+	const Vector3 c1 = c.cross(a) * invDet;
+	const Vector3 c2 = a.cross(b) * invDet;
+	const Vector3 t = -(c0 * m_rows[0][3] + c1 * m_rows[1][3] + c2 * m_rows[2][3]);
+
+	return Matrix4(c0[0], c1[0], c2[0], t[0],
+		c0[1], c1[1], c2[1], t[1],
+		c0[2], c1[2], c2[2], t[2],
+		0.f, 0.f, 0.f, 1.f);
+#endif // ifdef AR_SIMD
+}
+
+Matrix4& AR_VEC_CALL Matrix4::invertAffine(void)
+{
+	*this = getInvertedAffine();
+
+	return *this;
+}
+
+Matrix4 AR_VEC_CALL Matrix4::getInvertedOrthonormal(void) const
+{
+	AR_ASSERT_MSG(m_rows[3] == Vector4::c_wAxis, "The matrix is not affine");
+	AR_ASSERT_MSG(std::abs(getDeterminantFast() - 1.f) < 0.001f, "The matrix is not orthonormal");
+
+	// The rotation is transposed, the translation is rotated back and negated
+#ifdef AR_SIMD
+	const __m128 r0 = m_rows[0].get128();
+	const __m128 r1 = m_rows[1].get128();
+	const __m128 r2 = m_rows[2].get128();
+	const __m128 a = _mm_and_ps(r0, utils::c_SIMDXYZMask);
+	const __m128 b = _mm_and_ps(r1, utils::c_SIMDXYZMask);
+	const __m128 c = _mm_and_ps(r2, utils::c_SIMDXYZMask);
+
+	__m128 t = _mm_mul_ps(a, _mm_shuffle_ps(r0, r0, 0xFF)); //_MM_SHUFFLE(3, 3, 3, 3)
+	t = _mm_add_ps(t, _mm_mul_ps(b, _mm_shuffle_ps(r1, r1, 0xFF)));
+	t = _mm_add_ps(t, _mm_mul_ps(c, _mm_shuffle_ps(r2, r2, 0xFF)));
+	t = _mm_sub_ps(Vector4::c_wAxis.get128(), t);
+
+	return Matrix4(a, b, c, t).getTransposed();
+#else
+	const float32 t0 = m_rows[0][3];
+	const float32 t1 = m_rows[1][3];
+	const float32 t2 = m_rows[2][3];
+
+	return Matrix4(m_rows[0][0], m_rows[1][0], m_rows[2][0],
+		-(m_rows[0][0] * t0 + m_rows[1][0] * t1 + m_rows[2][0] * t2),
+		m_rows[0][1], m_rows[1][1], m_rows[2][1],
+		-(m_rows[0][1] * t0 + m_rows[1][1] * t1 + m_rows[2][1] * t2),
+		m_rows[0][2], m_rows[1][2], m_rows[2][2],
+		-(m_rows[0][2] * t0 + m_rows[1][2] * t1 + m_rows[2][2] * t2),
+		0.f, 0.f, 0.f, 1.f);
+#endif // ifdef AR_SIMD
+}
+
+Matrix4& AR_VEC_CALL Matrix4::invertOrthonormal(void)
+{
+	*this = getInvertedOrthonormal();
+
+	return *this;
+}
+
 Vector3 AR_VEC_CALL Matrix4::transformNormal(const Vector3 &n) const
 {
 #ifdef AR_SIMD
@@ -1092,260 +1147,4 @@ Vector3 AR_VEC_CALL Matrix4::transformNormal(const Vector3 &n) const
 #endif // ifdef AR_SIMD
 }
 
-Vector3 AR_VEC_CALL Matrix4::getColumn(int32 i) const
-{
-	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
-
-	return Vector3(m_rows[0][i], m_rows[1][i], m_rows[2][i]);
-}
-
-void AR_VEC_CALL Matrix4::setColumn(int32 i, const Vector4 &v)
-{
-	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
-
-	m_rows[0][i] = v[0];
-	m_rows[1][i] = v[1];
-	m_rows[2][i] = v[2];
-	m_rows[3][i] = v[3];
-}
-
-Vector4& AR_VEC_CALL Matrix4::operator[](int32 i)
-{
-	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
-
-	return m_rows[i];
-}
-
-const Vector4& AR_VEC_CALL Matrix4::operator[](int32 i) const
-{
-	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
-
-	return m_rows[i];
-}
-
-Matrix4 AR_VEC_CALL Matrix4::operator+(const Matrix4 &other) const
-{
-	return Matrix4(m_rows[0] + other.m_rows[0], m_rows[1] + other.m_rows[1],
-		m_rows[2] + other.m_rows[2], m_rows[3] + other.m_rows[3]);
-}
-
-Matrix4& AR_VEC_CALL Matrix4::operator+=(const Matrix4 &other)
-{
-	m_rows[0] += other.m_rows[0];
-	m_rows[1] += other.m_rows[1];
-	m_rows[2] += other.m_rows[2];
-	m_rows[3] += other.m_rows[3];
-
-	return *this;
-}
-
-Matrix4 AR_VEC_CALL Matrix4::operator-(const Matrix4 &other) const
-{
-	return Matrix4(m_rows[0] - other.m_rows[0], m_rows[1] - other.m_rows[1],
-		m_rows[2] - other.m_rows[2], m_rows[3] - other.m_rows[3]);
-}
-
-Matrix4& AR_VEC_CALL Matrix4::operator-=(const Matrix4 &other)
-{
-	m_rows[0] -= other.m_rows[0];
-	m_rows[1] -= other.m_rows[1];
-	m_rows[2] -= other.m_rows[2];
-	m_rows[3] -= other.m_rows[3];
-
-	return *this;
-}
-
-Matrix4 AR_VEC_CALL Matrix4::operator*(const Matrix4 &other) const
-{
-#ifdef AR_SIMD
-	const __m128 tv0 = m_rows[0].get128();
-	const __m128 tv1 = m_rows[1].get128();
-	const __m128 tv2 = m_rows[2].get128();
-	const __m128 tv3 = m_rows[3].get128();
-	const __m128 mv0 = other.m_rows[0].get128();
-	const __m128 mv1 = other.m_rows[1].get128();
-	const __m128 mv2 = other.m_rows[2].get128();
-	const __m128 mv3 = other.m_rows[3].get128();
-
-	__m128 v00 = _mm_shuffle_ps(tv0, tv0, 0x0);
-	__m128 v01 = _mm_shuffle_ps(tv0, tv0, 0x55);
-	__m128 v02 = _mm_shuffle_ps(tv0, tv0, 0xAA);
-	__m128 v03 = _mm_shuffle_ps(tv0, tv0, 0xFF);
-
-	v00 = _mm_mul_ps(v00, mv0);
-	v01 = _mm_mul_ps(v01, mv1);
-	v02 = _mm_mul_ps(v02, mv2);
-	v03 = _mm_mul_ps(v03, mv3);
-
-	__m128 v10 = _mm_shuffle_ps(tv1, tv1, 0x0);
-	__m128 v11 = _mm_shuffle_ps(tv1, tv1, 0x55);
-	__m128 v12 = _mm_shuffle_ps(tv1, tv1, 0xAA);
-	__m128 v13 = _mm_shuffle_ps(tv1, tv1, 0xFF);
-
-	v10 = _mm_mul_ps(v10, mv0);
-	v11 = _mm_mul_ps(v11, mv1);
-	v12 = _mm_mul_ps(v12, mv2);
-	v13 = _mm_mul_ps(v13, mv3);
-
-	__m128 v20 = _mm_shuffle_ps(tv2, tv2, 0x0);
-	__m128 v21 = _mm_shuffle_ps(tv2, tv2, 0x55);
-	__m128 v22 = _mm_shuffle_ps(tv2, tv2, 0xAA);
-	__m128 v23 = _mm_shuffle_ps(tv2, tv2, 0xFF);
-
-	v20 = _mm_mul_ps(v20, mv0);
-	v21 = _mm_mul_ps(v21, mv1);
-	v22 = _mm_mul_ps(v22, mv2);
-	v23 = _mm_mul_ps(v23, mv3);
-
-	__m128 v30 = _mm_shuffle_ps(tv3, tv3, 0x0);
-	__m128 v31 = _mm_shuffle_ps(tv3, tv3, 0x55);
-	__m128 v32 = _mm_shuffle_ps(tv3, tv3, 0xAA);
-	__m128 v33 = _mm_shuffle_ps(tv3, tv3, 0xFF);
-
-	v30 = _mm_mul_ps(v30, mv0);
-	v31 = _mm_mul_ps(v31, mv1);
-	v32 = _mm_mul_ps(v32, mv2);
-	v33 = _mm_mul_ps(v33, mv3);
-
-	v00 = _mm_add_ps(v00, v01);
-	v02 = _mm_add_ps(v02, v03);
-	v00 = _mm_add_ps(v00, v02);
-
-	v10 = _mm_add_ps(v10, v11);
-	v12 = _mm_add_ps(v12, v13);
-	v10 = _mm_add_ps(v10, v12);
-
-	v20 = _mm_add_ps(v20, v21);
-	v22 = _mm_add_ps(v22, v23);
-	v20 = _mm_add_ps(v20, v22);
-
-	v30 = _mm_add_ps(v30, v31);
-	v32 = _mm_add_ps(v32, v33);
-	v30 = _mm_add_ps(v30, v32);
-
-	return Matrix4(v00, v10, v20, v30);
-#else
-	return Matrix4(m_rows[0].dot(other._getColumn4(0)), m_rows[0].dot(other._getColumn4(1)),
-		m_rows[0].dot(other._getColumn4(2)), m_rows[0].dot(other._getColumn4(3)),
-		m_rows[1].dot(other._getColumn4(0)), m_rows[1].dot(other._getColumn4(1)),
-		m_rows[1].dot(other._getColumn4(2)), m_rows[1].dot(other._getColumn4(3)),
-		m_rows[2].dot(other._getColumn4(0)), m_rows[2].dot(other._getColumn4(1)),
-		m_rows[2].dot(other._getColumn4(2)), m_rows[2].dot(other._getColumn4(3)),
-		m_rows[3].dot(other._getColumn4(0)), m_rows[3].dot(other._getColumn4(1)),
-		m_rows[3].dot(other._getColumn4(2)), m_rows[3].dot(other._getColumn4(3)));
-#endif // ifdef AR_SIMD
-}
-
-Matrix4& AR_VEC_CALL Matrix4::operator*=(const Matrix4 &other)
-{
-#ifdef AR_SIMD
-	const __m128 tv0 = m_rows[0].get128();
-	const __m128 tv1 = m_rows[1].get128();
-	const __m128 tv2 = m_rows[2].get128();
-	const __m128 tv3 = m_rows[3].get128();
-	const __m128 mv0 = other.m_rows[0].get128();
-	const __m128 mv1 = other.m_rows[1].get128();
-	const __m128 mv2 = other.m_rows[2].get128();
-	const __m128 mv3 = other.m_rows[3].get128();
-
-	__m128 v00 = _mm_shuffle_ps(tv0, tv0, 0x0);
-	__m128 v01 = _mm_shuffle_ps(tv0, tv0, 0x55);
-	__m128 v02 = _mm_shuffle_ps(tv0, tv0, 0xAA);
-	__m128 v03 = _mm_shuffle_ps(tv0, tv0, 0xFF);
-
-	v00 = _mm_mul_ps(v00, mv0);
-	v01 = _mm_mul_ps(v01, mv1);
-	v02 = _mm_mul_ps(v02, mv2);
-	v03 = _mm_mul_ps(v03, mv3);
-
-	__m128 v10 = _mm_shuffle_ps(tv1, tv1, 0x0);
-	__m128 v11 = _mm_shuffle_ps(tv1, tv1, 0x55);
-	__m128 v12 = _mm_shuffle_ps(tv1, tv1, 0xAA);
-	__m128 v13 = _mm_shuffle_ps(tv1, tv1, 0xFF);
-
-	v10 = _mm_mul_ps(v10, mv0);
-	v11 = _mm_mul_ps(v11, mv1);
-	v12 = _mm_mul_ps(v12, mv2);
-	v13 = _mm_mul_ps(v13, mv3);
-
-	__m128 v20 = _mm_shuffle_ps(tv2, tv2, 0x0);
-	__m128 v21 = _mm_shuffle_ps(tv2, tv2, 0x55);
-	__m128 v22 = _mm_shuffle_ps(tv2, tv2, 0xAA);
-	__m128 v23 = _mm_shuffle_ps(tv2, tv2, 0xFF);
-
-	v20 = _mm_mul_ps(v20, mv0);
-	v21 = _mm_mul_ps(v21, mv1);
-	v22 = _mm_mul_ps(v22, mv2);
-	v23 = _mm_mul_ps(v23, mv3);
-
-	__m128 v30 = _mm_shuffle_ps(tv3, tv3, 0x0);
-	__m128 v31 = _mm_shuffle_ps(tv3, tv3, 0x55);
-	__m128 v32 = _mm_shuffle_ps(tv3, tv3, 0xAA);
-	__m128 v33 = _mm_shuffle_ps(tv3, tv3, 0xFF);
-
-	v30 = _mm_mul_ps(v30, mv0);
-	v31 = _mm_mul_ps(v31, mv1);
-	v32 = _mm_mul_ps(v32, mv2);
-	v33 = _mm_mul_ps(v33, mv3);
-
-	v00 = _mm_add_ps(v00, v01);
-	v02 = _mm_add_ps(v02, v03);
-	m_rows[0].set(_mm_add_ps(v00, v02));
-
-	v10 = _mm_add_ps(v10, v11);
-	v12 = _mm_add_ps(v12, v13);
-	m_rows[1].set(_mm_add_ps(v10, v12));
-
-	v20 = _mm_add_ps(v20, v21);
-	v22 = _mm_add_ps(v22, v23);
-	m_rows[2].set(_mm_add_ps(v20, v22));
-
-	v30 = _mm_add_ps(v30, v31);
-	v32 = _mm_add_ps(v32, v33);
-	m_rows[3].set(_mm_add_ps(v30, v32));
-#else
-	m_rows[0].set(m_rows[0].dot(other._getColumn4(0)), m_rows[0].dot(other._getColumn4(1)),
-		m_rows[0].dot(other._getColumn4(2)), m_rows[0].dot(other._getColumn4(3)));
-	m_rows[1].set(m_rows[1].dot(other._getColumn4(0)), m_rows[1].dot(other._getColumn4(1)),
-		m_rows[1].dot(other._getColumn4(2)), m_rows[1].dot(other._getColumn4(3)));
-	m_rows[2].set(m_rows[2].dot(other._getColumn4(0)), m_rows[2].dot(other._getColumn4(1)),
-		m_rows[2].dot(other._getColumn4(2)), m_rows[2].dot(other._getColumn4(3)));
-	m_rows[3].set(m_rows[3].dot(other._getColumn4(0)), m_rows[3].dot(other._getColumn4(1)),
-		m_rows[3].dot(other._getColumn4(2)), m_rows[3].dot(other._getColumn4(3)));
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Matrix4 AR_VEC_CALL Matrix4::operator*(float32 s) const
-{
-	return Matrix4(m_rows[0] * s, m_rows[1] * s, m_rows[2] * s, m_rows[3] * s);
-}
-
-Vector3 AR_VEC_CALL Matrix4::operator*(const Vector3 &v) const
-{
-	return Vector3(m_rows[0].dot(v), m_rows[1].dot(v), m_rows[2].dot(v));
-}
-
-Vector4 AR_VEC_CALL Matrix4::operator*(const Vector4 &v) const
-{
-	return Vector4(m_rows[0].dot(v), m_rows[1].dot(v), m_rows[2].dot(v), m_rows[3].dot(v));
-}
-
-bool AR_VEC_CALL Matrix4::operator==(const Matrix4 &other) const
-{
-	return (m_rows[0] == other.m_rows[0]) && (m_rows[1] == other.m_rows[1])
-		&& (m_rows[2] == other.m_rows[2]) && (m_rows[3] == other.m_rows[3]);
-}
-
-bool AR_VEC_CALL Matrix4::operator!=(const Matrix4 &other) const
-{
-	return !(*this == other);
-}
-
-Vector4 AR_VEC_CALL Matrix4::_getColumn4(int32 i) const
-{
-	AR_ASSERT_MSG(0 <= i && i < 4, "Index is out of range");
-	return Vector4(m_rows[0][i], m_rows[1][i], m_rows[2][i], m_rows[3][i]);
-}
 } // namespace argon::math
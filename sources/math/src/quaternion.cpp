@@ -8,18 +8,6 @@
 
 namespace argon::math
 {
-Quaternion::Quaternion()
-{
-	set(1.f, 0.f, 0.f, 0.f);
-}
-
-Quaternion::Quaternion(const Quaternion &) = default;
-
-AR_VEC_CALL Quaternion::Quaternion(float32 q0, float32 q1, float32 q2, float32 q3)
-{
-	set(q0, q1, q2, q3);
-}
-
 AR_VEC_CALL Quaternion::Quaternion(const Vector3 &axis, float32 angleRad)
 {
 	set(axis, angleRad);
@@ -111,18 +99,6 @@ AR_VEC_CALL Quaternion::Quaternion(const Matrix4 &m)
 	}
 }
 
-#ifdef AR_SIMD
-	AR_VEC_CALL Quaternion::Quaternion(__m128 vec)
-		: m_data(vec)
-	{
-	}
-
-	__m128 AR_VEC_CALL Quaternion::get128() const
-	{
-		return m_data;
-	}
-#endif // ifdef AR_SIMD
-
 Matrix3 AR_VEC_CALL Quaternion::getMatrix3() const
 {
 	return Matrix3(*this);
@@ -309,15 +285,6 @@ void AR_VEC_CALL Quaternion::set(const Matrix4 &m)
 	}
 }
 
-void AR_VEC_CALL Quaternion::set(float32 q0, float32 q1, float32 q2, float32 q3)
-{
-#ifdef AR_SIMD
-	m_data = _mm_set_ps(q3, q2, q1, q0);
-#else
-	m_comps[0] = q0, m_comps[1] = q1, m_comps[2] = q2, m_comps[3] = q3;
-#endif // ifdef AR_SIMD
-}
-
 void AR_VEC_CALL Quaternion::setEuler(float32 roll, float32 pitch, float32 yaw)
 {
 	const float32 cx = std::cos(yaw * 0.5f);  //heading
@@ -374,56 +341,6 @@ Quaternion AR_VEC_CALL Quaternion::getInverted(void) const
 #endif // ifdef AR_SIMD
 }
 
-float32 AR_VEC_CALL Quaternion::dot(const Quaternion &other) const
-{
-#ifdef AR_SIMD
-	const __m128 mul = _mm_mul_ps(m_data, other.m_data);
-	//_MM_SHUFFLE(0, 0, 3, 2)
-	const __m128 sum1 = _mm_add_ps(mul, _mm_shuffle_ps(mul, mul, 0xE));
-	//_MM_SHUFFLE(0, 0, 0, 1)
-	const __m128 sum = _mm_add_ps(sum1, _mm_shuffle_ps(sum1, sum1, 0x1));
-
-	return _mm_cvtss_f32(sum);
-#else
-	return m_comps[0] * other.m_comps[0] + m_comps[1] * other.m_comps[1]
-		+ m_comps[2] * other.m_comps[2] + m_comps[3] * other.m_comps[3];
-#endif // ifdef AR_SIMD
-}
-
-float32 AR_VEC_CALL Quaternion::getLength(void) const
-{
-#ifdef AR_SIMD
-	const __m128 qMul = _mm_mul_ps(m_data, m_data);
-	//_MM_SHUFFLE(0, 0, 3, 2)
-	const __m128 sum1 = _mm_add_ps(qMul, _mm_shuffle_ps(qMul, qMul, 0xE));
-	//_MM_SHUFFLE(0, 0, 0, 1)
-	__m128 sum = _mm_add_ps(sum1, _mm_shuffle_ps(sum1, sum1, 0x1));
-
-	sum = _mm_sqrt_ps(sum);
-
-	return _mm_cvtss_f32(sum);
-#else
-	return std::sqrt(m_comps[0] * m_comps[0] + m_comps[1] * m_comps[1]
-	+ m_comps[2] * m_comps[2] + m_comps[3] * m_comps[3]);
-#endif // ifdef AR_SIMD
-}
-
-float32 AR_VEC_CALL Quaternion::getLengthSq(void) const
-{
-#ifdef AR_SIMD
-	const __m128 qMul = _mm_mul_ps(m_data, m_data);
-	//_MM_SHUFFLE(0, 0, 3, 2)
-	const __m128 sum1 = _mm_add_ps(qMul, _mm_shuffle_ps(qMul, qMul, 0xE));
-	//_MM_SHUFFLE(0, 0, 0, 1)
-	const __m128 sum = _mm_add_ps(sum1, _mm_shuffle_ps(sum1, sum1, 0x1));
-
-	return _mm_cvtss_f32(sum);
-#else
-	return m_comps[0] * m_comps[0] + m_comps[1] * m_comps[1]
-		+ m_comps[2] * m_comps[2] + m_comps[3] * m_comps[3];
-#endif // ifdef AR_SIMD
-}
-
 Quaternion AR_VEC_CALL Quaternion::getNormalized(void) const
 {
 	AR_ASSERT_MSG(this->getLength() != 0.f, "Normalization of zero length Quaternion");
@@ -480,229 +397,6 @@ Quaternion& AR_VEC_CALL Quaternion::normalize(void)
 	return *this;
 }
 
-Quaternion& AR_VEC_CALL Quaternion::operator=(const Quaternion &other)
-{
-#ifdef AR_SIMD
-	m_data = other.m_data;
-#else
-	m_comps[0] = other.m_comps[0];
-	m_comps[1] = other.m_comps[1];
-	m_comps[2] = other.m_comps[2];
-	m_comps[3] = other.m_comps[3];
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Quaternion AR_VEC_CALL Quaternion::operator+(const Quaternion &other) const
-{
-#ifdef AR_SIMD
-	return Quaternion(_mm_add_ps(m_data, other.m_data));
-#else
-	return Quaternion(m_comps[0] + other.m_comps[0], m_comps[1] + other.m_comps[1],
-		m_comps[2] + other.m_comps[2], m_comps[3] + other.m_comps[3]);
-#endif // ifdef AR_SIMD
-}
-
-Quaternion& AR_VEC_CALL Quaternion::operator+=(const Quaternion &other)
-{
-#ifdef AR_SIMD
-	m_data = _mm_add_ps(m_data, other.m_data);
-#else
-	m_comps[0] += other.m_comps[0], m_comps[1] += other.m_comps[1],
-		m_comps[2] += other.m_comps[2], m_comps[3] += other.m_comps[3];
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Quaternion AR_VEC_CALL Quaternion::operator-(const Quaternion &other) const
-{
-#ifdef AR_SIMD
-	return Quaternion(_mm_sub_ps(m_data, other.m_data));
-#else
-	return Quaternion(m_comps[0] - other.m_comps[0], m_comps[1] - other.m_comps[1],
-		m_comps[2] - other.m_comps[2], m_comps[3] - other.m_comps[3]);
-#endif // ifdef AR_SIMD
-}
-
-Quaternion& AR_VEC_CALL Quaternion::operator-=(const Quaternion &other)
-{
-#ifdef AR_SIMD
-	m_data = _mm_sub_ps(m_data, other.m_data);
-#else
-	m_comps[0] -= other.m_comps[0], m_comps[1] -= other.m_comps[1],
-		m_comps[2] -= other.m_comps[2], m_comps[3] -= other.m_comps[3];
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Quaternion AR_VEC_CALL Quaternion::operator*(float32 scalar) const
-{
-#ifdef AR_SIMD
-	__m128 s = _mm_load_ss(&scalar);
-	s = _mm_shuffle_ps(s, s, 0x0);
-
-	return Quaternion(_mm_mul_ps(m_data, s));
-#else
-	return Quaternion(m_comps[0] * scalar, m_comps[1] * scalar, m_comps[2] * scalar,
-		m_comps[3] * scalar);
-#endif // ifdef AR_SIMD
-}
-
-Quaternion& AR_VEC_CALL Quaternion::operator*=(float32 scalar)
-{
-#ifdef AR_SIMD
-	const __m128 s = _mm_load_ss(&scalar);
-	m_data = _mm_mul_ps(m_data, _mm_shuffle_ps(s, s, 0x0));
-#else
-	m_comps[0] *= scalar, m_comps[1] *= scalar, m_comps[2] *= scalar, m_comps[3] *= scalar;
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Quaternion AR_VEC_CALL Quaternion::operator/(float32 scalar) const
-{
-#ifdef AR_SIMD
-	__m128 s = _mm_load_ss(&scalar);
-	s = _mm_shuffle_ps(s, s, 0x0);
-
-	return Quaternion(_mm_div_ps(m_data, s));
-#else
-	return Quaternion(m_comps[0] / scalar, m_comps[1] / scalar,
-		m_comps[2] / scalar, m_comps[3] / scalar);
-#endif // ifdef AR_SIMD
-}
-
-Quaternion& AR_VEC_CALL Quaternion::operator/=(float32 scalar)
-{
-#ifdef AR_SIMD
-	const __m128 s = _mm_load_ss(&scalar);
-	m_data = _mm_mul_ps(m_data, _mm_shuffle_ps(s, s, 0x0));
-#else
-	m_comps[0] /= scalar, m_comps[1] /= scalar, m_comps[2] /= scalar,
-		m_comps[3] /= scalar;
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Quaternion AR_VEC_CALL Quaternion::operator*(const Quaternion &other) const
-{
-#ifdef AR_SIMD
-	__m128 l = _mm_shuffle_ps(m_data, m_data, 0x1); //_MM_SHUFFLE(0, 0, 0, 1)
-	__m128 r = _mm_shuffle_ps(other.m_data, other.m_data, 0xE5); //_MM_SHUFFLE(3, 2, 1, 1)
-
-	__m128 res = _mm_mul_ps(l, r);
-
-	l = _mm_shuffle_ps(m_data, m_data, 0x66); //_MM_SHUFFLE(1, 2, 1, 2)
-	r = _mm_shuffle_ps(other.m_data, other.m_data, 0x82); //_MM_SHUFFLE(2, 0, 0, 2)
-
-	res = _mm_add_ps(res, _mm_mul_ps(l, r));
-
-	l = _mm_shuffle_ps(m_data, m_data, 0xFB); //_MM_SHUFFLE(3, 3, 2, 3)
-	r = _mm_shuffle_ps(other.m_data, other.m_data, 0x1F); //_MM_SHUFFLE(0, 1, 3, 3)
-
-	res = _mm_add_ps(res, _mm_mul_ps(l, r));
-
-	l = _mm_shuffle_ps(m_data, m_data, 0x9C); //_MM_SHUFFLE(2, 1, 3, 0)
-	r = _mm_shuffle_ps(other.m_data, other.m_data, 0x78); //_MM_SHUFFLE(1, 3, 2, 0)
-
-	res = _mm_xor_ps(res, _mm_set_ps(+0.0f, +0.0f, +0.0f, -0.0f));
-	l = _mm_mul_ps(l, r);
-	l = _mm_xor_ps(l, _mm_set_ps(-0.0f, -0.0f, -0.0f, +0.0f));
-
-	return Quaternion(_mm_add_ps(res, l));
-#else
-	return Quaternion(
-		m_comps[0] * other.m_comps[0] - m_comps[1] * other.m_comps[1]
-	 -m_comps[2] * other.m_comps[2] - m_comps[3] * other.m_comps[3],
-
-		m_comps[0] * other.m_comps[1] + m_comps[1] * other.m_comps[0] +
-		m_comps[2] * other.m_comps[3] - m_comps[3] * other.m_comps[2],
-
-		m_comps[0] * other.m_comps[2] - m_comps[1] * other.m_comps[3] +
-		m_comps[2] * other.m_comps[0] + m_comps[3] * other.m_comps[1],
-
-		m_comps[0] * other.m_comps[3] + m_comps[1] * other.m_comps[2] -
-		m_comps[2] * other.m_comps[1] + m_comps[3] * other.m_comps[0]);
-#endif // ifdef AR_SIMD
-}
-
-Quaternion& AR_VEC_CALL Quaternion::operator*=(const Quaternion &other)
-{
-#ifdef AR_SIMD
-	__m128 l = _mm_shuffle_ps(m_data, m_data, 0x1); //_MM_SHUFFLE(0, 0, 0, 1)
-	__m128 r = _mm_shuffle_ps(other.m_data, other.m_data, 0xE5); //_MM_SHUFFLE(3, 2, 1, 1)
-
-	__m128 res = _mm_mul_ps(l, r);
-
-	l = _mm_shuffle_ps(m_data, m_data, 0x66); //_MM_SHUFFLE(1, 2, 1, 2)
-	r = _mm_shuffle_ps(other.m_data, other.m_data, 0x82); //_MM_SHUFFLE(2, 0, 0, 2)
-
-	res = _mm_add_ps(res, _mm_mul_ps(l, r));
-
-	l = _mm_shuffle_ps(m_data, m_data, 0xFB); //_MM_SHUFFLE(3, 3, 2, 3)
-	r = _mm_shuffle_ps(other.m_data, other.m_data, 0x1F); //_MM_SHUFFLE(0, 1, 3, 3)
-
-	res = _mm_add_ps(res, _mm_mul_ps(l, r));
-
-	l = _mm_shuffle_ps(m_data, m_data, 0x9C); //_MM_SHUFFLE(2, 1, 3, 0)
-	r = _mm_shuffle_ps(other.m_data, other.m_data, 0x78); //_MM_SHUFFLE(1, 3, 2, 0)
-
-	res = _mm_xor_ps(res, _mm_set_ps(+0.0f, +0.0f, +0.0f, -0.0f));
-	l = _mm_mul_ps(l, r);
-	l = _mm_xor_ps(l, _mm_set_ps(-0.0f, -0.0f, -0.0f, +0.0f));
-
-	m_data = _mm_add_ps(res, l);
-#else
-	set(
-		m_comps[0] * other.m_comps[0] - m_comps[1] * other.m_comps[1]
-		- m_comps[2] * other.m_comps[2] - m_comps[3] * other.m_comps[3],
-		m_comps[0] * other.m_comps[1] + m_comps[1] * other.m_comps[0] +
-		m_comps[2] * other.m_comps[3] - m_comps[3] * other.m_comps[2],
-		m_comps[0] * other.m_comps[2] - m_comps[1] * other.m_comps[3] +
-		m_comps[2] * other.m_comps[0] + m_comps[3] * other.m_comps[1],
-		m_comps[0] * other.m_comps[3] + m_comps[1] * other.m_comps[2] -
-		m_comps[2] * other.m_comps[1] + m_comps[3] * other.m_comps[0]);
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Quaternion AR_VEC_CALL Quaternion::operator*(const Vector3 &v) const
-{
-#ifdef AR_SIMD
-	__m128 q = _mm_shuffle_ps(m_data, m_data, 0x1); //_MM_SHUFFLE(0, 0, 0, 1)
-	__m128 mv = _mm_shuffle_ps(v.get128(), v.get128(), 0x90); //_MM_SHUFFLE(2, 1, 0, 0)
-
-	__m128 result = _mm_mul_ps(q, mv);
-
-	q = _mm_shuffle_ps(m_data, m_data, 0x7A); //_MM_SHUFFLE(1, 3, 2, 2)
-	mv = _mm_shuffle_ps(v.get128(), v.get128(), 0x49); //_MM_SHUFFLE(1, 0, 2, 1)
-
-	result = _mm_add_ps(result, _mm_mul_ps(q, mv));
-
-	q = _mm_shuffle_ps(m_data, m_data, 0x9F); //_MM_SHUFFLE(2, 1, 3, 3)
-	mv = _mm_shuffle_ps(v.get128(), v.get128(), 0x26); //_MM_SHUFFLE(0, 2, 1, 2)
-
-	q = _mm_mul_ps(q, mv);
-
-
-	result = _mm_xor_ps(result, _mm_castsi128_ps(utils::c_SIMDNegMask));
-	q = _mm_xor_ps(q, utils::c_SIMDNegMask);
-
-	return Quaternion( _mm_add_ps(result, q));
-#else
-	return Quaternion(-m_comps[1] * v[0] - m_comps[2] * v[1] - m_comps[3] * v[2],
-										 m_comps[0] * v[0] + m_comps[2] * v[2] - m_comps[3] * v[1],
-										 m_comps[0] * v[1] + m_comps[3] * v[0] - m_comps[1] * v[2],
-										 m_comps[0] * v[2] + m_comps[1] * v[1] - m_comps[2] * v[0]);
-#endif // ifdef AR_SIMD
-}
-
 Quaternion AR_VEC_CALL Quaternion::slerp(const Quaternion &q, float32 t) const
 {
 	Quaternion slerped;
@@ -719,7 +413,7 @@ Quaternion AR_VEC_CALL Quaternion::slerp(const Quaternion &q, float32 t) const
 		return slerped;
 	}
 
-	const float32 halfTheta = std::cos(cosHalfTheta);
+	const float32 halfTheta = std::acos(cosHalfTheta);
 	const float32 sinHalfTheta = std::sqrt(1.f - cosHalfTheta * cosHalfTheta);
 
 	if (std::abs(sinHalfTheta) < 0.001f)
@@ -755,15 +449,4 @@ Vector3& AR_VEC_CALL Quaternion::rotate(Vector3 &v) const
 	return v;
 }
 
-float32& AR_VEC_CALL Quaternion::operator[](int32 i)
-{
-	AR_ASSERT_MSG(i >= 0 && i < 4, "Index is out of range");
-	return m_comps[i];
-}
-
-const float32& AR_VEC_CALL Quaternion::operator[](int32 i) const
-{
-	AR_ASSERT_MSG(i >= 0 && i < 4, "Index is out of range");
-	return m_comps[i];
-}
 } // namespace argon::math
@@ -0,0 +1,48 @@
+#include <fundamental/debug.hpp>
+
+#include "quaternion.hpp"
+#include "quaternion_x8.hpp"
+
+namespace argon::math
+{
+QuaternionX8::QuaternionX8()
+{
+
+}
+
+QuaternionX8::QuaternionX8(const Quaternion *q)
+{
+	load(q);
+}
+
+void QuaternionX8::load(const Quaternion *q)
+{
+	for (int32 i = 0; i < LANES; ++i)
+	{
+		setLane(i, q[i]);
+	}
+}
+
+void QuaternionX8::store(Quaternion *q) const
+{
+	for (int32 i = 0; i < LANES; ++i)
+	{
+		q[i] = getLane(i);
+	}
+}
+
+Quaternion QuaternionX8::getLane(int32 i) const
+{
+	AR_ASSERT_MSG(i >= 0 && i < LANES, "Index is out of range");
+	return Quaternion(m_q0[i], m_q1[i], m_q2[i], m_q3[i]);
+}
+
+void QuaternionX8::setLane(int32 i, const Quaternion &q)
+{
+	AR_ASSERT_MSG(i >= 0 && i < LANES, "Index is out of range");
+	m_q0[i] = q[0];
+	m_q1[i] = q[1];
+	m_q2[i] = q[2];
+	m_q3[i] = q[3];
+}
+} // namespace argon::math
@@ -14,89 +14,6 @@ const Vector2 AR_ATTR_ALIGN(16) Vector2::c_zero = Vector2(0.f, 0.f);
 const Vector2 AR_ATTR_ALIGN(16) Vector2::c_xAxis = Vector2(1.f, 0.f);
 const Vector2 AR_ATTR_ALIGN(16) Vector2::c_yAxis = Vector2(0.f, 1.f);
 
-Vector2::Vector2()
-{
-}
-
-AR_VEC_CALL Vector2::Vector2(const Vector2 &) = default;
-
-AR_VEC_CALL Vector2::Vector2(float32 x, float32 y)
-{
-#ifdef AR_SIMD
-	m_data = _mm_set_ps(0.0, 0.0, y, x);
-#else
-	m_comps[0] = x;
-	m_comps[1] = y;
-	m_comps[2] = m_comps[3] = 0.f;
-#endif // ifdef AR_SIMD
-}
-
-#ifdef AR_SIMD
-AR_VEC_CALL Vector2::Vector2(__m128 data)
-{
-	m_data = data;
-}
-#endif // ifdef AR_SIMD
-
-float32 AR_VEC_CALL Vector2::getX(void) const
-{
-	return m_comps[0];
-}
-
-float32 AR_VEC_CALL Vector2::getY(void) const
-{
-	return m_comps[1];
-}
-
-void AR_VEC_CALL Vector2::setX(float32 x)
-{
-	m_comps[0] = x;
-}
-
-void AR_VEC_CALL Vector2::setY(float32 y)
-{
-	m_comps[1] = y;
-}
-
-void AR_VEC_CALL Vector2::set(float32 x, float32 y)
-{
-	m_comps[0] = x;
-	m_comps[1] = y;
-}
-
-float32 AR_VEC_CALL Vector2::dot(const Vector2 &other) const
-{
-#ifdef AR_SIMD
-	const Vector2 mult(_mm_mul_ps(m_data, other.m_data));
-
-	return mult.m_comps[0] + mult.m_comps[1];
-#else
-	return m_comps[0] * other.m_comps[0] + m_comps[1] * other.m_comps[1];
-#endif // ifdef AR_SIMD
-}
-
-float32 AR_VEC_CALL Vector2::getLength(void) const
-{
-	return std::sqrt(this->dot(*this));
-}
-
-float32 AR_VEC_CALL Vector2::getLengthSq(void) const
-{
-	return this->dot(*this);
-}
-
-Vector2& AR_VEC_CALL Vector2::normalize(void)
-{
-	AR_ASSERT_MSG(!isZeroEpsilon(), "Trying to normalize vector of length 0");
-	return *this /= getLength();
-}
-
-Vector2 AR_VEC_CALL Vector2::getNormalized(void) const
-{
-	AR_ASSERT_MSG(!isZeroEpsilon(), "Trying to normalize vector of length 0");
-	return *this / getLength();
-}
-
 void Vector2::zeroOut(void)
 {
 #ifdef AR_SIMD
@@ -280,143 +197,4 @@ float32 AR_VEC_CALL Vector2::getAngle(const Vector2 &other) const
 	return std::acos(this->dot(other) / scalar);
 }
 
-Vector2& AR_VEC_CALL Vector2::operator=(const Vector2 &other)
-{
-#ifdef AR_SIMD
-	m_data = other.m_data;
-#else
-	m_comps[0] = other.m_comps[0];
-	m_comps[1] = other.m_comps[1];
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Vector2 AR_VEC_CALL Vector2::operator+(const Vector2 &other) const
-{
-#ifdef AR_SIMD
-	return Vector2(_mm_add_ps(m_data, other.m_data));
-#else
-	return Vector2(m_comps[0] + other.m_comps[0], m_comps[1] + other.m_comps[1]);
-#endif // ifdef AR_SIMD
-}
-
-Vector2& AR_VEC_CALL Vector2::operator+=(const Vector2 &other)
-{
-#ifdef AR_SIMD
-	m_data = _mm_add_ps(m_data, other.m_data);
-#else
-	m_comps[0] += other.m_comps[0];
-	m_comps[1] += other.m_comps[1];
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Vector2 AR_VEC_CALL Vector2::operator-(void) const
-{
-#ifdef AR_SIMD
-	return Vector2(_mm_xor_ps(m_data, utils::c_SIMDNegMask));
-#else
-	return Vector2(-m_comps[0], -m_comps[1]);
-#endif // ifdef AR_SIMD
-}
-
-Vector2 AR_VEC_CALL Vector2::operator-(const Vector2 &other) const
-{
-#ifdef AR_SIMD
-	return Vector2(_mm_sub_ps(m_data, other.m_data));
-#else
-	return Vector2(m_comps[0] - other.m_comps[0], m_comps[1] - other.m_comps[1]);
-#endif // ifdef AR_SIMD
-}
-
-Vector2& AR_VEC_CALL Vector2::operator-=(const Vector2 &other)
-{
-#ifdef AR_SIMD
-	m_data = _mm_sub_ps(m_data, other.m_data);
-#else
-	m_comps[0] -= other.m_comps[0];
-	m_comps[1] -= other.m_comps[1];
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Vector2 AR_VEC_CALL Vector2::operator*(float32 scalar) const
-{
-#ifdef AR_SIMD
-	return Vector2(_mm_mul_ps(m_data, _mm_set1_ps(scalar)));
-#else
-	return Vector2(m_comps[0] * scalar, m_comps[1] * scalar);
-#endif // ifdef AR_SIMD
-}
-
-Vector2& AR_VEC_CALL Vector2::operator*=(float32 scalar)
-{
-#ifdef AR_SIMD
-	m_data = _mm_mul_ps(m_data, _mm_set1_ps(scalar));
-#else
-	m_comps[0] *= scalar;
-	m_comps[1] *= scalar;
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-Vector2 AR_VEC_CALL Vector2::operator/(float32 scalar) const
-{
-	AR_ASSERT_MSG(scalar != 0.f, "Scaling by 1/0");
-
-#ifdef AR_SIMD
-	return Vector2(_mm_div_ps(m_data, _mm_set1_ps(scalar)));
-#else
-	return Vector2(m_comps[0] / scalar, m_comps[1] / scalar);
-#endif // ifdef AR_SIMD
-}
-
-Vector2& AR_VEC_CALL Vector2::operator/=(float32 scalar)
-{
-	AR_ASSERT_MSG(scalar != 0.f, "Scaling by 1/0");
-
-#ifdef AR_SIMD
-	m_data = _mm_div_ps(m_data, _mm_set1_ps(scalar));
-#else
-	m_comps[0] /= scalar;
-	m_comps[1] /= scalar;
-#endif // ifdef AR_SIMD
-
-	return *this;
-}
-
-float32& AR_VEC_CALL Vector2::operator[](int32 i)
-{
-	AR_ASSERT_MSG(i >= 0 && i < 2, "Index is out of range");
-	return m_comps[i];
-}
-
-const float32& AR_VEC_CALL Vector2::operator[](int32 i) const
-{
-	AR_ASSERT_MSG(i >= 0 && i < 2, "Index is out of range");
-	return m_comps[i];
-}
-
-bool AR_VEC_CALL Vector2::operator==(const Vector2 &other) const
-{
-#ifdef AR_SIMD
-	return 0xF == _mm_movemask_ps(_mm_cmp_ps(m_data, other.m_data, _CMP_EQ_OQ));
-#else
-	return (m_comps[0] == other.m_comps[0]) && (m_comps[1] == other.m_comps[1]);
-#endif // ifdef AR_SIMD
-}
-
-bool AR_VEC_CALL Vector2::operator!=(const Vector2 &other) const
-{
-	return !(*this == other);
-}
-
-Vector2 AR_VEC_CALL operator*(float32 s, const Vector2 &v)
-{
-	return v * s;
-}
 } // namespace argon::math
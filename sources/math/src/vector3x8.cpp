@@ -0,0 +1,47 @@
+#include <fundamental/debug.hpp>
+
+#include "vector3.hpp"
+#include "vector3x8.hpp"
+
+namespace argon::math
+{
+Vector3x8::Vector3x8()
+{
+
+}
+
+Vector3x8::Vector3x8(const Vector3 *v)
+{
+	load(v);
+}
+
+void Vector3x8::load(const Vector3 *v)
+{
+	for (int32 i = 0; i < LANES; ++i)
+	{
+		setLane(i, v[i]);
+	}
+}
+
+void Vector3x8::store(Vector3 *v) const
+{
+	for (int32 i = 0; i < LANES; ++i)
+	{
+		v[i] = getLane(i);
+	}
+}
+
+Vector3 Vector3x8::getLane(int32 i) const
+{
+	AR_ASSERT_MSG(i >= 0 && i < LANES, "Index is out of range");
+	return Vector3(m_x[i], m_y[i], m_z[i]);
+}
+
+void Vector3x8::setLane(int32 i, const Vector3 &v)
+{
+	AR_ASSERT_MSG(i >= 0 && i < LANES, "Index is out of range");
+	m_x[i] = v.getX();
+	m_y[i] = v.getY();
+	m_z[i] = v.getZ();
+}
+} // namespace argon::math
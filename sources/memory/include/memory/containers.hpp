@@ -0,0 +1,66 @@
+#pragma once
+
+#include <functional>
+#include <memory_resource>
+#include <utility>
+
+#include <data_structures/standard_containers.hpp>
+
+#include "linear_arena.hpp"
+#include "pool_allocator.hpp"
+#include "tagged_allocator.hpp"
+
+namespace argon
+{
+// Transient containers of a frame, they must be destroyed before the end of the frame
+template <typename T>
+using frame_vector = vector<T, memory::FrameAllocator<T>>;
+
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+	typename KeyEqual = std::equal_to<Key>>
+using frame_unordered_map = unordered_map<Key, T, Hash, KeyEqual,
+	memory::FrameAllocator<std::pair<const Key, T>>>;
+
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using frame_unordered_set = unordered_set<Key, Hash, KeyEqual, memory::FrameAllocator<Key>>;
+
+// Node based containers with the nodes from the thread pools
+template <typename T>
+using pool_list = list<T, memory::PoolAllocator<T>>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using pool_map = map<Key, T, Compare, memory::PoolAllocator<std::pair<const Key, T>>>;
+
+template <typename Key, typename Compare = std::less<Key>>
+using pool_set = set<Key, Compare, memory::PoolAllocator<Key>>;
+
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+	typename KeyEqual = std::equal_to<Key>>
+using pool_unordered_map = unordered_map<Key, T, Hash, KeyEqual,
+	memory::PoolAllocator<std::pair<const Key, T>>>;
+
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using pool_unordered_set = unordered_set<Key, Hash, KeyEqual, memory::PoolAllocator<Key>>;
+
+template <typename T, memory::MemoryTag TTag>
+using tagged_vector = vector<T, memory::TaggedAllocator<T, TTag>>;
+
+// The memory resource is passed to the constructor, see memory::getFrameResource,
+// memory::getPoolResource and memory::getTaggedResource
+namespace pmr
+{
+template <typename T>
+using vector = argon::vector<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+	typename KeyEqual = std::equal_to<Key>>
+using unordered_map = argon::unordered_map<Key, T, Hash, KeyEqual,
+	std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+using unordered_set = argon::unordered_set<Key, Hash, KeyEqual, std::pmr::polymorphic_allocator<Key>>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using map = argon::map<Key, T, Compare, std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+} // namespace pmr
+} // namespace argon
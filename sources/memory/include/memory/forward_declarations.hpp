@@ -0,0 +1,14 @@
+#pragma once
+
+#include <fundamental/types.hpp>
+
+namespace argon::memory
+{
+enum class MemoryTag : uint32;
+
+template <typename> class FrameAllocator;
+class FixedPool;
+class LinearArena;
+template <typename> class PoolAllocator;
+template <typename, MemoryTag> class TaggedAllocator;
+} // namespace argon::memory
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
+#include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
+
+#include "forward_declarations.hpp"
+
+namespace argon::memory
+{
+// Bump allocator, the memory is released all at once by reset. Not thread safe.
+class AR_SYM_EXPORT LinearArena final
+	: NonCopyable
+{
+public:
+	inline static constexpr sizet DEFAULT_CHUNK_SIZE = 1u << 20;
+
+	explicit LinearArena(sizet chunkSize = DEFAULT_CHUNK_SIZE);
+	~LinearArena();
+
+	void* allocate(sizet size, sizet alignment = alignof(std::max_align_t));
+
+	// Invalidates all allocations. The chunks are merged into one, so an arena with a steady
+	// usage stops allocating after a few resets.
+	void reset();
+
+	// Bytes since the last reset, including the unused ends of the filled chunks
+	sizet getUsed() const;
+	sizet getPeak() const;
+	sizet getCapacity() const;
+
+private:
+	struct Chunk
+	{
+		std::unique_ptr<byte[]> m_data;
+		sizet m_size;
+	};
+
+	void* _allocateSlow(sizet size, sizet alignment);
+	void _addChunk(sizet size);
+
+	vector<Chunk> m_chunks;
+	byte *m_begin;
+	byte *m_current;
+	byte *m_end;
+	// Bytes of the filled chunks
+	sizet m_filled;
+	sizet m_peak;
+	sizet m_chunkSize;
+};
+
+// Allocations, which live until the end of the frame, on the arena of the calling thread
+AR_SYM_EXPORT LinearArena& getFrameArena();
+// Called by the engine after every frame, nothing may use the frame memory at that point
+AR_SYM_EXPORT void resetFrameArenas();
+// Frame memory for the std::pmr containers
+AR_SYM_EXPORT std::pmr::memory_resource* getFrameResource();
+
+// The memory is freed by resetFrameArenas, the container must not outlive the frame
+template <typename T>
+class FrameAllocator
+{
+public:
+	using value_type = T;
+
+	FrameAllocator() = default;
+	template <typename U>
+	FrameAllocator(const FrameAllocator<U> &) {}
+
+	T* allocate(sizet n);
+	void deallocate(T *, sizet) {}
+};
+
+template <typename T, typename U>
+bool operator==(const FrameAllocator<T> &, const FrameAllocator<U> &)
+{
+	return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const FrameAllocator<T> &, const FrameAllocator<U> &)
+{
+	return false;
+}
+
+AR_FORCE_INLINE void* LinearArena::allocate(sizet size, sizet alignment)
+{
+	AR_ASSERT_MSG(alignment && !(alignment & (alignment - 1)), "Alignment must be a power of two");
+
+	const uintptr address = (reinterpret_cast<uintptr>(m_current) + alignment - 1) & ~(alignment - 1);
+	if (m_current && address + size <= reinterpret_cast<uintptr>(m_end))
+	{
+		m_current = reinterpret_cast<byte*>(address + size);
+		return reinterpret_cast<void*>(address);
+	}
+
+	return _allocateSlow(size, alignment);
+}
+
+template <typename T>
+T* FrameAllocator<T>::allocate(sizet n)
+{
+	return static_cast<T*>(getFrameArena().allocate(n * sizeof(T), alignof(T)));
+}
+} // namespace argon::memory
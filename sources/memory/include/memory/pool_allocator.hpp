@@ -0,0 +1,133 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/debug.hpp>
+#include <fundamental/non_copyable.hpp>
+#include <fundamental/types.hpp>
+
+#include "forward_declarations.hpp"
+
+namespace argon::memory
+{
+// Blocks of a single size, the freed blocks are reused first. Not thread safe.
+class AR_SYM_EXPORT FixedPool final
+	: NonCopyable
+{
+public:
+	// Blocks are aligned to the smaller of the block size and this
+	inline static constexpr sizet ALIGNMENT = 16u;
+	inline static constexpr sizet CHUNK_SIZE = 1u << 16;
+
+	explicit FixedPool(sizet blockSize);
+	~FixedPool();
+
+	void* allocate();
+	void deallocate(void *block);
+
+	sizet getBlockSize() const { return m_blockSize; }
+
+private:
+	struct FreeBlock
+	{
+		FreeBlock *m_next;
+	};
+
+	void _grow();
+
+	vector<std::unique_ptr<byte[]>> m_chunks;
+	FreeBlock *m_free;
+	sizet m_blockSize;
+};
+
+// Size classes of the thread pools, the larger or overaligned allocations go to operator new
+inline constexpr sizet MIN_POOL_BLOCK_SIZE = 16u;
+inline constexpr sizet MAX_POOL_BLOCK_SIZE = 512u;
+
+// Pool of the calling thread for the size class of the size. A block may be freed on any thread,
+// it joins the pool of that thread. The pools of the exited threads are taken over by the new ones.
+AR_SYM_EXPORT FixedPool& getThreadPool(sizet size);
+// Thread pools for the std::pmr containers
+AR_SYM_EXPORT std::pmr::memory_resource* getPoolResource();
+
+// For the node based containers, the single objects come from the thread pools
+template <typename T>
+class PoolAllocator
+{
+public:
+	using value_type = T;
+
+	PoolAllocator() = default;
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U> &) {}
+
+	T* allocate(sizet n);
+	void deallocate(T *p, sizet n);
+
+private:
+	inline static constexpr bool IS_POOLED = sizeof(T) <= MAX_POOL_BLOCK_SIZE
+		&& alignof(T) <= FixedPool::ALIGNMENT;
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T> &, const PoolAllocator<U> &)
+{
+	return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &)
+{
+	return false;
+}
+
+AR_FORCE_INLINE void* FixedPool::allocate()
+{
+	if (!m_free)
+	{
+		_grow();
+	}
+
+	FreeBlock *block = m_free;
+	m_free = block->m_next;
+
+	return block;
+}
+
+AR_FORCE_INLINE void FixedPool::deallocate(void *block)
+{
+	AR_ASSERT_MSG(block, "Block is null");
+
+	FreeBlock *freeBlock = static_cast<FreeBlock*>(block);
+	freeBlock->m_next = m_free;
+	m_free = freeBlock;
+}
+
+template <typename T>
+T* PoolAllocator<T>::allocate(sizet n)
+{
+	if (IS_POOLED && n == 1)
+	{
+		return static_cast<T*>(getThreadPool(sizeof(T)).allocate());
+	}
+
+	return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+template <typename T>
+void PoolAllocator<T>::deallocate(T *p, sizet n)
+{
+	if (IS_POOLED && n == 1)
+	{
+		getThreadPool(sizeof(T)).deallocate(p);
+		return;
+	}
+
+	::operator delete(p, std::align_val_t(alignof(T)));
+}
+} // namespace argon::memory
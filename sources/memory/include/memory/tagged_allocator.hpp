@@ -0,0 +1,80 @@
+#pragma once
+
+#include <memory_resource>
+
+#include <fundamental/compiler_macros.hpp>
+#include <fundamental/types.hpp>
+
+#include "forward_declarations.hpp"
+
+namespace argon::memory
+{
+// Owner of the memory in the statistics
+enum class MemoryTag : uint32
+{
+	General = 0,
+	Ecs,
+	Jobs,
+	Render,
+	Debug
+};
+
+inline constexpr uint32 NUM_MEMORY_TAGS = 5u;
+
+struct MemoryStats
+{
+	sizet m_currentBytes;
+	sizet m_peakBytes;
+	uint64 m_numAllocations;
+	uint64 m_numDeallocations;
+};
+
+// operator new and operator delete with the statistics of the tag
+AR_SYM_EXPORT void* allocateTagged(sizet size, sizet alignment, MemoryTag tag);
+AR_SYM_EXPORT void deallocateTagged(void *memory, sizet size, sizet alignment, MemoryTag tag);
+
+AR_SYM_EXPORT MemoryStats getMemoryStats(MemoryTag tag);
+AR_SYM_EXPORT const char* getMemoryTagName(MemoryTag tag);
+
+// Tagged memory for the std::pmr containers
+AR_SYM_EXPORT std::pmr::memory_resource* getTaggedResource(MemoryTag tag);
+
+template <typename T, MemoryTag TTag = MemoryTag::General>
+class TaggedAllocator
+{
+public:
+	using value_type = T;
+
+	template <typename U>
+	struct rebind
+	{
+		using other = TaggedAllocator<U, TTag>;
+	};
+
+	TaggedAllocator() = default;
+	template <typename U>
+	TaggedAllocator(const TaggedAllocator<U, TTag> &) {}
+
+	T* allocate(sizet n)
+	{
+		return static_cast<T*>(allocateTagged(n * sizeof(T), alignof(T), TTag));
+	}
+
+	void deallocate(T *p, sizet n)
+	{
+		deallocateTagged(p, n * sizeof(T), alignof(T), TTag);
+	}
+};
+
+template <typename T, typename U, MemoryTag TTag>
+bool operator==(const TaggedAllocator<T, TTag> &, const TaggedAllocator<U, TTag> &)
+{
+	return true;
+}
+
+template <typename T, typename U, MemoryTag TTag>
+bool operator!=(const TaggedAllocator<T, TTag> &, const TaggedAllocator<U, TTag> &)
+{
+	return false;
+}
+} // namespace argon::memory
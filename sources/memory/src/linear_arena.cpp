@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <mutex>
+
+#include "linear_arena.hpp"
+
+namespace argon::memory
+{
+namespace
+{
+class FrameArenas final
+	: NonCopyable
+{
+public:
+	void add(LinearArena &arena)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_arenas.push_back(&arena);
+	}
+
+	void remove(LinearArena &arena)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_arenas.erase(std::find(m_arenas.begin(), m_arenas.end(), &arena));
+	}
+
+	void reset()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (LinearArena *arena : m_arenas)
+		{
+			arena->reset();
+		}
+	}
+
+private:
+	std::mutex m_mutex;
+	vector<LinearArena*> m_arenas;
+};
+
+FrameArenas& getFrameArenas()
+{
+	static FrameArenas s_arenas;
+	return s_arenas;
+}
+
+// Registers the arena of the thread for the resets
+struct ThreadFrameArena
+{
+	ThreadFrameArena()
+	{
+		getFrameArenas().add(m_arena);
+	}
+
+	~ThreadFrameArena()
+	{
+		getFrameArenas().remove(m_arena);
+	}
+
+	LinearArena m_arena;
+};
+
+class FrameResource final
+	: public std::pmr::memory_resource
+{
+private:
+	void* do_allocate(sizet bytes, sizet alignment) override
+	{
+		return getFrameArena().allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *, sizet, sizet) override
+	{
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+} // namespace
+
+LinearArena::LinearArena(sizet chunkSize)
+	: m_begin(nullptr)
+	, m_current(nullptr)
+	, m_end(nullptr)
+	, m_filled(0)
+	, m_peak(0)
+	, m_chunkSize(chunkSize)
+{
+	AR_ASSERT_MSG(chunkSize, "Chunk size is zero");
+}
+
+LinearArena::~LinearArena() = default;
+
+void LinearArena::reset()
+{
+	m_peak = std::max(m_peak, getUsed());
+
+	if (m_chunks.size() > 1)
+	{
+		const sizet capacity = getCapacity();
+		m_chunks.clear();
+		_addChunk(capacity);
+	}
+
+	m_current = m_begin;
+	m_filled = 0;
+}
+
+sizet LinearArena::getUsed() const
+{
+	return m_filled + static_cast<sizet>(m_current - m_begin);
+}
+
+sizet LinearArena::getPeak() const
+{
+	return std::max(m_peak, getUsed());
+}
+
+sizet LinearArena::getCapacity() const
+{
+	sizet capacity = 0;
+	for (const auto &chunk : m_chunks)
+	{
+		capacity += chunk.m_size;
+	}
+
+	return capacity;
+}
+
+void* LinearArena::_allocateSlow(sizet size, sizet alignment)
+{
+	m_filled += static_cast<sizet>(m_end - m_begin);
+	_addChunk(std::max(m_chunkSize, size + alignment));
+
+	return allocate(size, alignment);
+}
+
+void LinearArena::_addChunk(sizet size)
+{
+	// Not value initialized
+	m_chunks.push_back({std::unique_ptr<byte[]>(new byte[size]), size});
+	m_begin = m_chunks.back().m_data.get();
+	m_current = m_begin;
+	m_end = m_begin + size;
+}
+
+LinearArena& getFrameArena()
+{
+	thread_local ThreadFrameArena s_arena;
+	return s_arena.m_arena;
+}
+
+void resetFrameArenas()
+{
+	getFrameArenas().reset();
+}
+
+std::pmr::memory_resource* getFrameResource()
+{
+	static FrameResource s_resource;
+	return &s_resource;
+}
+} // namespace argon::memory
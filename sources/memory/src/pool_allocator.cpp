@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <mutex>
+
+#include "pool_allocator.hpp"
+
+namespace argon::memory
+{
+namespace
+{
+inline constexpr sizet NUM_SIZE_CLASSES = 6u;
+
+static_assert(MIN_POOL_BLOCK_SIZE << (NUM_SIZE_CLASSES - 1) == MAX_POOL_BLOCK_SIZE,
+	"Size classes must cover the pooled sizes");
+
+sizet getSizeClass(sizet size)
+{
+	AR_ASSERT_MSG(size <= MAX_POOL_BLOCK_SIZE, "Size is not pooled");
+
+	sizet sizeClass = 0;
+	for (sizet blockSize = MIN_POOL_BLOCK_SIZE; blockSize < size; blockSize <<= 1)
+	{
+		++sizeClass;
+	}
+
+	return sizeClass;
+}
+
+class ThreadPools final
+	: NonCopyable
+{
+public:
+	ThreadPools()
+		: m_pools{FixedPool(MIN_POOL_BLOCK_SIZE), FixedPool(MIN_POOL_BLOCK_SIZE << 1),
+			FixedPool(MIN_POOL_BLOCK_SIZE << 2), FixedPool(MIN_POOL_BLOCK_SIZE << 3),
+			FixedPool(MIN_POOL_BLOCK_SIZE << 4), FixedPool(MIN_POOL_BLOCK_SIZE << 5)}
+	{
+	}
+
+	FixedPool& get(sizet size)
+	{
+		return m_pools[getSizeClass(size)];
+	}
+
+private:
+	FixedPool m_pools[NUM_SIZE_CLASSES];
+};
+
+// The pools are never freed, their blocks may still be used by the other threads
+class ThreadPoolsRegistry final
+	: NonCopyable
+{
+public:
+	ThreadPools* acquire()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_released.empty())
+		{
+			return new ThreadPools();
+		}
+
+		ThreadPools *pools = m_released.back();
+		m_released.pop_back();
+
+		return pools;
+	}
+
+	void release(ThreadPools *pools)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_released.push_back(pools);
+	}
+
+private:
+	std::mutex m_mutex;
+	vector<ThreadPools*> m_released;
+};
+
+ThreadPoolsRegistry& getRegistry()
+{
+	// Not destroyed, the threads may exit after the static destructors
+	static ThreadPoolsRegistry *s_registry = new ThreadPoolsRegistry();
+	return *s_registry;
+}
+
+struct ThreadPoolsOwner
+{
+	ThreadPoolsOwner()
+		: m_pools(getRegistry().acquire())
+	{
+	}
+
+	~ThreadPoolsOwner()
+	{
+		getRegistry().release(m_pools);
+	}
+
+	ThreadPools *m_pools;
+};
+
+class PoolResource final
+	: public std::pmr::memory_resource
+{
+private:
+	void* do_allocate(sizet bytes, sizet alignment) override
+	{
+		if (bytes <= MAX_POOL_BLOCK_SIZE && alignment <= FixedPool::ALIGNMENT)
+		{
+			return getThreadPool(bytes).allocate();
+		}
+
+		return ::operator new(bytes, std::align_val_t(alignment));
+	}
+
+	void do_deallocate(void *p, sizet bytes, sizet alignment) override
+	{
+		if (bytes <= MAX_POOL_BLOCK_SIZE && alignment <= FixedPool::ALIGNMENT)
+		{
+			getThreadPool(bytes).deallocate(p);
+			return;
+		}
+
+		::operator delete(p, std::align_val_t(alignment));
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+} // namespace
+
+FixedPool::FixedPool(sizet blockSize)
+	: m_free(nullptr)
+	, m_blockSize(std::max(blockSize, sizeof(FreeBlock)))
+{
+	AR_ASSERT_MSG(m_blockSize <= CHUNK_SIZE, "Block is larger than a chunk");
+	// Blocks stay aligned inside of the chunks
+	m_blockSize = (m_blockSize + std::min(m_blockSize, ALIGNMENT) - 1)
+		& ~(std::min(m_blockSize, ALIGNMENT) - 1);
+}
+
+FixedPool::~FixedPool() = default;
+
+void FixedPool::_grow()
+{
+	m_chunks.push_back(std::unique_ptr<byte[]>(new byte[CHUNK_SIZE]));
+	byte *chunk = m_chunks.back().get();
+
+	// Linked in the address order, the first allocations are adjacent
+	const sizet numBlocks = CHUNK_SIZE / m_blockSize;
+	for (sizet i = numBlocks; i-- > 0;)
+	{
+		deallocate(chunk + i * m_blockSize);
+	}
+}
+
+FixedPool& getThreadPool(sizet size)
+{
+	thread_local ThreadPoolsOwner s_owner;
+	return s_owner.m_pools->get(size);
+}
+
+std::pmr::memory_resource* getPoolResource()
+{
+	static PoolResource s_resource;
+	return &s_resource;
+}
+} // namespace argon::memory
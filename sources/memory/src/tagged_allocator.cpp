@@ -0,0 +1,126 @@
+#include <atomic>
+#include <new>
+
+#include <fundamental/debug.hpp>
+#include <fundamental/helper_macros.hpp>
+
+#include "tagged_allocator.hpp"
+
+namespace argon::memory
+{
+namespace
+{
+// A cache line per tag, the threads allocating with different tags do not share them
+struct alignas(64) TagCounters
+{
+	std::atomic<sizet> m_currentBytes;
+	std::atomic<sizet> m_peakBytes;
+	std::atomic<uint64> m_numAllocations;
+	std::atomic<uint64> m_numDeallocations;
+	AR_PAD(32);
+};
+
+TagCounters s_counters[NUM_MEMORY_TAGS];
+
+TagCounters& getCounters(MemoryTag tag)
+{
+	AR_ASSERT_MSG(static_cast<uint32>(tag) < NUM_MEMORY_TAGS, "Tag is not valid");
+	return s_counters[static_cast<uint32>(tag)];
+}
+
+class TaggedResource final
+	: public std::pmr::memory_resource
+{
+public:
+	explicit TaggedResource(MemoryTag tag)
+		: m_tag(tag)
+	{
+	}
+
+private:
+	void* do_allocate(sizet bytes, sizet alignment) override
+	{
+		return allocateTagged(bytes, alignment, m_tag);
+	}
+
+	void do_deallocate(void *p, sizet bytes, sizet alignment) override
+	{
+		deallocateTagged(p, bytes, alignment, m_tag);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+
+	MemoryTag m_tag;
+	AR_PAD(4);
+};
+} // namespace
+
+void* allocateTagged(sizet size, sizet alignment, MemoryTag tag)
+{
+	TagCounters &counters = getCounters(tag);
+
+	const sizet current = counters.m_currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+	sizet peak = counters.m_peakBytes.load(std::memory_order_relaxed);
+	while (peak < current
+		&& !counters.m_peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+	{
+	}
+
+	counters.m_numAllocations.fetch_add(1u, std::memory_order_relaxed);
+
+	return ::operator new(size, std::align_val_t(alignment));
+}
+
+void deallocateTagged(void *memory, sizet size, sizet alignment, MemoryTag tag)
+{
+	TagCounters &counters = getCounters(tag);
+
+	counters.m_currentBytes.fetch_sub(size, std::memory_order_relaxed);
+	counters.m_numDeallocations.fetch_add(1u, std::memory_order_relaxed);
+
+	::operator delete(memory, std::align_val_t(alignment));
+}
+
+MemoryStats getMemoryStats(MemoryTag tag)
+{
+	const TagCounters &counters = getCounters(tag);
+
+	return {counters.m_currentBytes.load(std::memory_order_relaxed),
+		counters.m_peakBytes.load(std::memory_order_relaxed),
+		counters.m_numAllocations.load(std::memory_order_relaxed),
+		counters.m_numDeallocations.load(std::memory_order_relaxed)};
+}
+
+const char* getMemoryTagName(MemoryTag tag)
+{
+	switch (tag)
+	{
+	case MemoryTag::General:
+		return "General";
+	case MemoryTag::Ecs:
+		return "Ecs";
+	case MemoryTag::Jobs:
+		return "Jobs";
+	case MemoryTag::Render:
+		return "Render";
+	case MemoryTag::Debug:
+		return "Debug";
+	}
+
+	return "";
+}
+
+std::pmr::memory_resource* getTaggedResource(MemoryTag tag)
+{
+	static TaggedResource s_resources[NUM_MEMORY_TAGS] = {
+		TaggedResource(MemoryTag::General), TaggedResource(MemoryTag::Ecs),
+		TaggedResource(MemoryTag::Jobs), TaggedResource(MemoryTag::Render),
+		TaggedResource(MemoryTag::Debug)};
+
+	AR_ASSERT_MSG(static_cast<uint32>(tag) < NUM_MEMORY_TAGS, "Tag is not valid");
+	return &s_resources[static_cast<uint32>(tag)];
+}
+} // namespace argon::memory
@@ -16,7 +16,7 @@ RTTR_PLUGIN_REGISTRATION
 
 void SimpleAppSystem::initialize()
 {
-	argon::debug::statusMsg("SimpleAppIni");
+	AR_LOG_STATUS("SimpleAppIni");
 	app.prepare(
 		get<argon::Filesystem>().resolveToAbsolute("/shaders/gouraud/gouraud.vert").c_str(),
 		get<argon::Filesystem>().resolveToAbsolute("/shaders/gouraud/gouraud.frag").c_str());
@@ -25,7 +25,7 @@ void SimpleAppSystem::initialize()
 void SimpleAppSystem::finalize()
 {
 	app.close();
-	argon::debug::statusMsg("SimpleAppFini");
+	AR_LOG_STATUS("SimpleAppFini");
 }
 
 void SimpleAppSystem::tick()
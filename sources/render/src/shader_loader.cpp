@@ -15,7 +15,7 @@ const GLchar* ReadShader(const char *filename)
 
 	if (!shaderFile.is_open())
 	{
-		debug::errorMsg("Shader file ", filename, " cannot be opened");
+		AR_LOG_ERROR("Shader file ", filename, " cannot be opened");
 		return nullptr;
 	}
 
@@ -73,7 +73,7 @@ GLuint LoadShaders(ShaderInfo *info)
 
 			GLchar *log = new GLchar[static_cast<size_t>(len + 1)];
 			glGetShaderInfoLog(shader, len, &len, log);
-			debug::errorMsg("Shader compilation failed: ", log);
+			AR_LOG_ERROR("Shader compilation failed: ", log);
 
 			delete []log;
 			return 0;
@@ -95,7 +95,7 @@ GLuint LoadShaders(ShaderInfo *info)
 
 		GLchar *log = new GLchar[static_cast<size_t>(len + 1)];
 		glGetProgramInfoLog(program, len, &len, log);
-		debug::errorMsg("Shader linking failed: ", log);
+		AR_LOG_ERROR("Shader linking failed: ", log);
 		delete []log;
 
 		for (entry = info; entry->m_type != GL_NONE; ++entry)
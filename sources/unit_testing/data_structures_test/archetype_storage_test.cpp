@@ -0,0 +1,196 @@
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <data_structures/archetype_storage.hpp>
+#include <data_structures/sparse_storage.hpp>
+#include <data_structures/standard_containers.hpp>
+
+namespace
+{
+constexpr argon::ArchetypeStorage::TypeId POSITION_ID = 1u;
+constexpr argon::ArchetypeStorage::TypeId VELOCITY_ID = 2u;
+constexpr argon::ArchetypeStorage::TypeId NAME_ID = 3u;
+
+struct Position
+{
+	float x;
+	float y;
+};
+
+struct Velocity
+{
+	float x;
+	float y;
+};
+} // namespace
+
+TEST(ArchetypeStorage, AssignAndFind)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::ArchetypeStorage storage;
+
+	const auto slot = slotGenerator.acquire();
+	EXPECT_FALSE(storage.has(slot, POSITION_ID));
+
+	storage.assign<Position>(slot, POSITION_ID, Position{1.f, 2.f});
+	EXPECT_TRUE(storage.has(slot, POSITION_ID));
+	EXPECT_FALSE(storage.has(slot, VELOCITY_ID));
+
+	storage.assign<Velocity>(slot, VELOCITY_ID, Velocity{3.f, 4.f});
+	EXPECT_TRUE(storage.has(slot, POSITION_ID));
+	EXPECT_TRUE(storage.has(slot, VELOCITY_ID));
+
+	EXPECT_EQ(storage.find<Position>(slot, POSITION_ID)->x, 1.f)
+		<< "Component was not moved into the new archetype";
+	EXPECT_EQ(storage.find<Position>(slot, POSITION_ID)->y, 2.f);
+	EXPECT_EQ(storage.find<Velocity>(slot, VELOCITY_ID)->x, 3.f);
+	EXPECT_EQ(storage.find<Velocity>(slot, VELOCITY_ID)->y, 4.f);
+
+	storage.erase(slot, POSITION_ID);
+	EXPECT_FALSE(storage.has(slot, POSITION_ID));
+	EXPECT_EQ(storage.find<Velocity>(slot, VELOCITY_ID)->x, 3.f);
+
+	storage.erase(slot, VELOCITY_ID);
+	EXPECT_FALSE(storage.has(slot, VELOCITY_ID));
+}
+
+TEST(ArchetypeStorage, ChunkLayout)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::ArchetypeStorage storage;
+	argon::vector<argon::SlotGenerator::Slot> slots;
+
+	for (argon::uint32 i = 0; i < 5000; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+		storage.assign<Position>(slots.back(), POSITION_ID, Position{static_cast<float>(i), 0.f});
+		storage.assign<Velocity>(slots.back(), VELOCITY_ID, Velocity{0.f, static_cast<float>(i)});
+	}
+
+	const auto &archetypes = storage.getArchetypes();
+	const argon::ArchetypeStorage::Archetype *joint = nullptr;
+	for (const auto &archetype : archetypes)
+	{
+		if (archetype->getColumns().size() == 2)
+		{
+			joint = archetype.get();
+		}
+	}
+
+	ASSERT_NE(joint, nullptr);
+	EXPECT_EQ(joint->size(), 5000u);
+	EXPECT_GT(joint->getChunkCount(), 1u);
+	EXPECT_EQ(joint->getChunkSize(0), joint->getChunkCapacity());
+
+	const auto positionColumn = joint->getColumnIndex(POSITION_ID);
+	const auto velocityColumn = joint->getColumnIndex(VELOCITY_ID);
+
+	argon::sizet visited = 0;
+	for (argon::sizet chunk = 0; chunk < joint->getChunkCount(); ++chunk)
+	{
+		const auto *positions = static_cast<const Position*>(joint->getColumn(chunk, positionColumn));
+		const auto *velocities = static_cast<const Velocity*>(joint->getColumn(chunk, velocityColumn));
+		const auto *chunkSlots = joint->getSlots(chunk);
+
+		for (argon::sizet row = 0; row < joint->getChunkSize(chunk); ++row)
+		{
+			EXPECT_EQ(positions[row].x, velocities[row].y);
+			EXPECT_EQ(storage.find<Position>(chunkSlots[row], POSITION_ID), &positions[row]);
+			++visited;
+		}
+	}
+
+	EXPECT_EQ(visited, 5000u);
+}
+
+TEST(ArchetypeStorage, StructuralChanges)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::ArchetypeStorage storage;
+	argon::vector<argon::SlotGenerator::Slot> slots;
+
+	for (argon::uint32 i = 0; i < 2000; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+		storage.assign<Position>(slots.back(), POSITION_ID, Position{static_cast<float>(i), 0.f});
+		storage.assign<argon::vector<int>>(slots.back(), NAME_ID, argon::vector<int>(3, static_cast<int>(i)));
+	}
+
+	for (argon::uint32 i = 0; i < 2000; i += 3)
+	{
+		storage.assign<Velocity>(slots[i], VELOCITY_ID, Velocity{static_cast<float>(i), 0.f});
+	}
+
+	for (argon::uint32 i = 0; i < 2000; i += 4)
+	{
+		storage.remove(slots[i]);
+	}
+
+	for (argon::uint32 i = 0; i < 2000; ++i)
+	{
+		if (i % 4 == 0)
+		{
+			EXPECT_FALSE(storage.has(slots[i], POSITION_ID));
+			EXPECT_FALSE(storage.has(slots[i], NAME_ID));
+			continue;
+		}
+
+		ASSERT_TRUE(storage.has(slots[i], POSITION_ID));
+		EXPECT_EQ(storage.find<Position>(slots[i], POSITION_ID)->x, static_cast<float>(i));
+
+		const auto *name = storage.find<argon::vector<int>>(slots[i], NAME_ID);
+		ASSERT_NE(name, nullptr);
+		EXPECT_EQ(name->size(), 3u);
+		EXPECT_EQ(name->front(), static_cast<int>(i))
+			<< "Non trivial component was corrupted while moving between archetypes";
+
+		EXPECT_EQ(storage.has(slots[i], VELOCITY_ID), i % 3 == 0);
+	}
+}
+
+TEST(ArchetypeStorage, Versions)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::ArchetypeStorage storage;
+	argon::vector<argon::SlotGenerator::Slot> slots;
+
+	for (argon::sizet i = 0; i < 1500; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+		storage.assign<Position>(slots.back(), POSITION_ID, Position{static_cast<float>(i), 0.f});
+	}
+
+	auto &positions = *storage.getArchetypes()[0];
+	ASSERT_EQ(positions.getChunkCount(), 2u);
+
+	argon::uint64 since = storage.observe();
+	EXPECT_LE(positions.getColumnVersion(0, 0), since);
+	EXPECT_LE(positions.getColumnVersion(1, 0), since);
+
+	EXPECT_NE(std::as_const(storage).find<Position>(slots[10], POSITION_ID), nullptr);
+	EXPECT_LE(positions.getColumnVersion(0, 0), since) << "Read only lookup changed the version";
+
+	storage.find<Position>(slots[positions.getChunkCapacity() + 10], POSITION_ID)->y = 1.f;
+	EXPECT_LE(positions.getColumnVersion(0, 0), since);
+	EXPECT_GT(positions.getColumnVersion(1, 0), since);
+
+	since = storage.observe();
+	storage.assign<Velocity>(slots[0], VELOCITY_ID, Velocity{1.f, 1.f});
+
+	// The last row is moved into the hole left by the first one
+	EXPECT_GT(positions.getColumnVersion(0, 0), since);
+	EXPECT_LE(positions.getColumnVersion(1, 0), since);
+
+	const auto &moved = *storage.getArchetypes()[1];
+	EXPECT_GT(moved.getColumnVersion(0, moved.getColumnIndex(POSITION_ID)), since);
+	EXPECT_GT(moved.getColumnVersion(0, moved.getColumnIndex(VELOCITY_ID)), since);
+
+	since = storage.observe();
+	positions.markChanged(1, 0, since);
+	EXPECT_LE(positions.getColumnVersion(1, 0), since) << "Observed version is seen as a new write";
+
+	positions.markChanged(1, 0);
+	positions.markChanged(1, 0, since);
+	EXPECT_GT(positions.getColumnVersion(1, 0), since) << "Older version hides a newer write";
+}
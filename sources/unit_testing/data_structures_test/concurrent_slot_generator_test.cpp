@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <data_structures/concurrent_slot_generator.hpp>
+#include <data_structures/standard_containers.hpp>
+
+TEST(ConcurrentSlotGenerator, SingleThread)
+{
+	argon::ConcurrentSlotGenerator slotGenerator;
+	argon::vector<argon::ConcurrentSlotGenerator::Slot> slots;
+
+	for (argon::uint32 i = 0; i < argon::ConcurrentSlotGenerator::SLOTS_PER_PAGE * 3; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+		EXPECT_EQ(slots.back().getIndex(), i);
+		EXPECT_TRUE(slotGenerator.isValid(slots.back()));
+	}
+
+	argon::ConcurrentSlotGenerator::Slot slot;
+	EXPECT_FALSE(slotGenerator.isValid(slot))
+		<< "Default constructed slot should be invalid";
+
+	slotGenerator.release(slots[5]);
+	EXPECT_FALSE(slotGenerator.isValid(slots[5]));
+
+	const auto reused = slotGenerator.acquire();
+	EXPECT_EQ(reused.getIndex(), slots[5].getIndex());
+	EXPECT_EQ(reused.getGeneration(), slots[5].getGeneration() + 1);
+	EXPECT_TRUE(slotGenerator.isValid(reused));
+}
+
+TEST(ConcurrentSlotGenerator, LocalCache)
+{
+	argon::ConcurrentSlotGenerator slotGenerator;
+	argon::vector<argon::ConcurrentSlotGenerator::Slot> slots;
+
+	{
+		argon::ConcurrentSlotGenerator::LocalCache cache(slotGenerator);
+
+		for (argon::uint32 i = 0; i < 1000; ++i)
+		{
+			slots.push_back(slotGenerator.acquire(cache));
+			EXPECT_TRUE(slotGenerator.isValid(slots.back()));
+		}
+
+		for (argon::sizet i = 0; i < slots.size(); i += 2)
+		{
+			slotGenerator.release(cache, slots[i]);
+			EXPECT_FALSE(slotGenerator.isValid(slots[i]));
+		}
+	}
+
+	// The cache returned the released slots and the rest of its last batch on destruction
+	constexpr argon::uint32 batch = argon::ConcurrentSlotGenerator::LocalCache::CAPACITY / 2;
+	constexpr argon::uint32 numFetched = (1000 + batch - 1) / batch * batch;
+
+	for (argon::uint32 i = 0; i < 500 + numFetched - 1000; ++i)
+	{
+		EXPECT_LT(slotGenerator.acquire().getIndex(), numFetched);
+	}
+
+	EXPECT_EQ(slotGenerator.acquire().getIndex(), numFetched);
+}
+
+TEST(ConcurrentSlotGenerator, MultipleThreads)
+{
+	constexpr argon::sizet numThreads = 4;
+	constexpr argon::sizet numSlots = 20000;
+
+	argon::ConcurrentSlotGenerator slotGenerator;
+	argon::vector<argon::vector<argon::ConcurrentSlotGenerator::Slot>> results(numThreads);
+	argon::vector<std::thread> threads;
+
+	for (argon::sizet t = 0; t < numThreads; ++t)
+	{
+		threads.emplace_back([&slotGenerator, &result = results[t], t]()
+		{
+			argon::ConcurrentSlotGenerator::LocalCache cache(slotGenerator);
+			argon::vector<argon::ConcurrentSlotGenerator::Slot> released;
+
+			for (argon::sizet i = 0; i < numSlots; ++i)
+			{
+				// Mix the cached and the shared paths
+				const auto slot = t % 2 ? slotGenerator.acquire(cache) : slotGenerator.acquire();
+
+				if (i % 3 == 0)
+				{
+					t % 2 ? slotGenerator.release(cache, slot) : slotGenerator.release(slot);
+					released.push_back(slot);
+				}
+				else
+				{
+					result.push_back(slot);
+				}
+			}
+
+			for (const auto &slot : released)
+			{
+				EXPECT_FALSE(slotGenerator.isValid(slot));
+			}
+		});
+	}
+
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+
+	argon::vector<argon::uint32> indices;
+	for (const auto &result : results)
+	{
+		for (const auto &slot : result)
+		{
+			EXPECT_TRUE(slotGenerator.isValid(slot));
+			indices.push_back(slot.getIndex());
+		}
+	}
+
+	std::sort(indices.begin(), indices.end());
+	EXPECT_EQ(std::adjacent_find(indices.begin(), indices.end()), indices.end())
+		<< "Slot was handed out to several threads";
+}
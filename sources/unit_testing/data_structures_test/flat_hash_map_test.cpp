@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <data_structures/flat_hash_map.hpp>
+#include <data_structures/standard_containers.hpp>
+
+namespace
+{
+struct StringHash
+{
+	using is_transparent = void;
+
+	argon::sizet operator()(std::string_view value) const
+	{
+		return std::hash<std::string_view>()(value);
+	}
+};
+
+struct StringEqual
+{
+	using is_transparent = void;
+
+	bool operator()(std::string_view lhs, std::string_view rhs) const
+	{
+		return lhs == rhs;
+	}
+};
+} // namespace
+
+TEST(FlatHashMap, Empty)
+{
+	argon::flat_hash_map<int, int> map;
+
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(0u, map.size());
+	EXPECT_EQ(0u, map.capacity());
+	EXPECT_TRUE(map.begin() == map.end())
+		<< "Empty map has no values to iterate";
+	EXPECT_TRUE(map.find(10) == map.end());
+	EXPECT_EQ(0u, map.erase(10));
+}
+
+TEST(FlatHashMap, InsertFindErase)
+{
+	argon::flat_hash_map<argon::sizet, argon::sizet> map;
+
+	for (argon::sizet i = 0; i < 100000; ++i)
+	{
+		const auto [it, inserted] = map.emplace(i, i * 3);
+		EXPECT_TRUE(inserted);
+		EXPECT_EQ(i * 3, it->second);
+	}
+
+	EXPECT_EQ(100000u, map.size());
+	EXPECT_FALSE(map.emplace(10u, 0u).second)
+		<< "Key is already in the map, the value must stay";
+	EXPECT_EQ(30u, map.at(10u));
+
+	for (argon::sizet i = 0; i < 100000; i += 2)
+	{
+		EXPECT_EQ(1u, map.erase(i));
+	}
+
+	EXPECT_EQ(50000u, map.size());
+
+	for (argon::sizet i = 0; i < 100000; ++i)
+	{
+		const auto it = map.find(i);
+		if (i % 2)
+		{
+			ASSERT_TRUE(it != map.end());
+			EXPECT_EQ(i * 3, it->second);
+		}
+		else
+		{
+			EXPECT_TRUE(it == map.end())
+				<< "Erased key is still found";
+		}
+	}
+}
+
+TEST(FlatHashMap, Iteration)
+{
+	argon::flat_hash_map<int, int> map;
+	int expectedSum = 0;
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		map[i] = i;
+		expectedSum += i;
+	}
+
+	int sum = 0;
+	argon::sizet count = 0;
+	for (const auto &[key, value] : map)
+	{
+		EXPECT_EQ(key, value);
+		sum += value;
+		++count;
+	}
+
+	EXPECT_EQ(1000u, count);
+	EXPECT_EQ(expectedSum, sum);
+
+	// Erasing does not move the other values
+	for (auto it = map.begin(); it != map.end();)
+	{
+		it = it->first % 3 ? map.erase(it) : std::next(it);
+	}
+
+	EXPECT_EQ(334u, map.size());
+	for (const auto &[key, value] : map)
+	{
+		EXPECT_EQ(0, key % 3);
+	}
+}
+
+TEST(FlatHashMap, TombstonesAreReused)
+{
+	argon::flat_hash_map<int, int> map;
+	map.reserve(1000);
+
+	const argon::sizet capacity = map.capacity();
+	for (int round = 0; round < 100; ++round)
+	{
+		for (int i = 0; i < 1000; ++i)
+		{
+			map[round * 1000 + i] = i;
+		}
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			EXPECT_EQ(1u, map.erase(round * 1000 + i));
+		}
+	}
+
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(capacity, map.capacity())
+		<< "Table with a steady size must not grow";
+}
+
+TEST(FlatHashMap, MoveOnlyValues)
+{
+	argon::flat_hash_map<std::string, std::unique_ptr<int>> map;
+
+	for (int i = 0; i < 100; ++i)
+	{
+		map.try_emplace(std::to_string(i), std::make_unique<int>(i));
+	}
+
+	for (int i = 0; i < 100; ++i)
+	{
+		ASSERT_TRUE(map.contains(std::to_string(i)));
+		EXPECT_EQ(i, *map.at(std::to_string(i)));
+	}
+
+	argon::flat_hash_map<std::string, std::unique_ptr<int>> moved(std::move(map));
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(100u, moved.size());
+
+	moved.clear();
+	EXPECT_TRUE(moved.empty());
+	EXPECT_TRUE(moved.begin() == moved.end());
+}
+
+TEST(FlatHashMap, Copy)
+{
+	argon::flat_hash_map<std::string, int> map{{"a", 1}, {"b", 2}, {"c", 3}};
+	argon::flat_hash_map<std::string, int> copy(map);
+
+	copy["a"] = 10;
+	copy.insert_or_assign("d", 4);
+
+	EXPECT_EQ(1, map.at("a"));
+	EXPECT_EQ(3u, map.size());
+	EXPECT_EQ(10, copy.at("a"));
+	EXPECT_EQ(4u, copy.size());
+
+	map = copy;
+	EXPECT_EQ(4u, map.size());
+	EXPECT_EQ(4, map.at("d"));
+}
+
+TEST(FlatHashMap, HeterogeneousLookup)
+{
+	argon::flat_hash_map<std::string, int, StringHash, StringEqual> map;
+	map["entity"] = 1;
+	map["transform"] = 2;
+
+	const std::string_view key = "transform";
+	EXPECT_EQ(2, map.find(key)->second)
+		<< "Transparent lookup must not need a std::string";
+	EXPECT_TRUE(map.contains("entity"));
+	EXPECT_FALSE(map.contains(std::string_view("system")));
+	EXPECT_EQ(1u, map.erase(key));
+	EXPECT_EQ(1u, map.size());
+}
+
+TEST(FlatHashMap, MissingKeyIsFatal)
+{
+	argon::flat_hash_map<int, int> map;
+
+	ASSERT_DEATH(map.at(5), "Assertion")
+		<< "Missing key in at should be fatal";
+}
+
+TEST(FlatHashSet, InsertFindErase)
+{
+	argon::flat_hash_set<argon::uint64> set;
+
+	for (argon::uint64 i = 0; i < 10000; ++i)
+	{
+		EXPECT_TRUE(set.insert(i << 32).second);
+		EXPECT_FALSE(set.insert(i << 32).second);
+	}
+
+	EXPECT_EQ(10000u, set.size());
+	EXPECT_EQ(1u, set.count(5ull << 32));
+	EXPECT_EQ(0u, set.count(5u));
+
+	argon::sizet count = 0;
+	for (auto it = set.begin(); it != set.end();)
+	{
+		it = (*it >> 32) % 2 ? set.erase(it) : std::next(it);
+		++count;
+	}
+
+	EXPECT_EQ(10000u, count);
+	EXPECT_EQ(5000u, set.size());
+	EXPECT_TRUE(set.contains(2ull << 32));
+	EXPECT_FALSE(set.contains(3ull << 32));
+}
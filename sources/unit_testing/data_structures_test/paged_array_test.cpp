@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <data_structures/paged_array.hpp>
+#include <data_structures/standard_containers.hpp>
+
+TEST(PagedArray, Grow)
+{
+	argon::PagedArray<argon::uint32, 64> array;
+	EXPECT_EQ(array.size(), 0u);
+
+	array.grow(1);
+	EXPECT_EQ(array.size(), 64u);
+	EXPECT_EQ(array[63], 0u)
+		<< "New elements should be value initialized";
+
+	array.grow(64);
+	EXPECT_EQ(array.size(), 64u)
+		<< "Array fits already, it should not grow";
+
+	array.grow(1000);
+	EXPECT_EQ(array.size(), 1024u);
+}
+
+TEST(PagedArray, StableAddresses)
+{
+	argon::PagedArray<argon::sizet, 16> array;
+	array.grow(16);
+
+	argon::vector<argon::sizet*> addresses;
+	for (argon::sizet i = 0; i < 16; ++i)
+	{
+		array[i] = i;
+		addresses.push_back(&array[i]);
+	}
+
+	for (argon::sizet size = 32; size <= 16 * 1024; size += 16)
+	{
+		array.grow(size);
+	}
+
+	for (argon::sizet i = 0; i < 16; ++i)
+	{
+		EXPECT_EQ(addresses[i], &array[i])
+			<< "Growth should never move the elements";
+		EXPECT_EQ(array[i], i);
+	}
+}
@@ -215,3 +215,214 @@ TEST(SlotMap, Iterators)
 		}
 	}
 }
+
+TEST(SlotMap, ContiguousRemap)
+{
+	using Map = argon::SlotMap<argon::sizet, 16, argon::ContiguousSlotMapStorage>;
+
+	Map slotMap;
+	argon::vector<Map::Slot> slots;
+	argon::vector<argon::sizet> vals;
+
+	EXPECT_EQ(slotMap.capacity(), 16u);
+
+	for (argon::sizet i = 0; i < 1000; ++i)
+	{
+		slots.emplace_back(slotMap.allocate(i));
+		vals.emplace_back(i);
+	}
+
+	EXPECT_GE(slotMap.capacity(), 1000u);
+
+	for (int i = 999; i >= 0; --i)
+	{
+		if (i % 3 == 0)
+		{
+			slotMap.erase(slots[static_cast<argon::sizet>(i)]);
+			slots.erase(slots.begin() + i);
+			vals.erase(vals.begin() + i);
+		}
+	}
+
+	for (argon::sizet i = 0; i < 500; ++i)
+	{
+		slots.emplace_back(slotMap.allocate(10000u + i));
+		vals.emplace_back(10000u + i);
+	}
+
+	ASSERT_EQ(slotMap.size(), slots.size());
+	for (argon::sizet i = 0; i < slots.size(); ++i)
+	{
+		EXPECT_TRUE(slotMap.isSlotValid(slots[i]));
+		EXPECT_EQ(slotMap.at(slots[i]), vals[i]);
+	}
+}
+
+TEST(SlotMap, ContiguousReserve)
+{
+	argon::SlotMap<argon::sizet, 64, argon::ContiguousSlotMapStorage> slotMap;
+	const auto slot = slotMap.allocate(7u);
+
+	slotMap.reserve(10000);
+	EXPECT_GE(slotMap.capacity(), 10000u);
+
+	const argon::sizet *data = &slotMap.at(slot);
+	for (argon::sizet i = 0; i < 9000; ++i)
+	{
+		slotMap.allocate(i);
+	}
+
+	EXPECT_EQ(data, &slotMap.at(slot))
+		<< "Memory was reserved, objects should not move";
+	EXPECT_EQ(slotMap.at(slot), 7u);
+}
+
+TEST(SlotMap, IteratorsAcrossPages)
+{
+	argon::SlotMap<argon::sizet, 16> paged;
+	argon::SlotMap<argon::sizet, 16, argon::ContiguousSlotMapStorage> contiguous;
+
+	for (argon::sizet i = 0; i < 16 * 10 + 5; ++i)
+	{
+		paged.allocate(i);
+		contiguous.allocate(i);
+	}
+
+	argon::sizet i = 0;
+	for (auto it = paged.begin(); it != paged.end(); ++it, ++i)
+	{
+		EXPECT_EQ(*it, i);
+	}
+	EXPECT_EQ(i, paged.size());
+
+	i = 0;
+	for (const auto &v : contiguous)
+	{
+		EXPECT_EQ(v, i++);
+	}
+	EXPECT_EQ(i, contiguous.size());
+
+	auto it = paged.begin() + 40;
+	EXPECT_EQ(*it, 40u);
+	EXPECT_EQ(*(it - 25), 15u);
+	EXPECT_EQ(it[-24], 16u);
+	--it;
+	EXPECT_EQ(*it, 39u);
+	EXPECT_EQ(paged.end() - paged.begin(), static_cast<argon::ptrdiff>(paged.size()));
+
+	argon::sizet numBlocks = 0;
+	argon::sizet sum = 0;
+	paged.forEachBlock([&](const argon::sizet *begin, const argon::sizet *end)
+	{
+		++numBlocks;
+		for (; begin != end; ++begin)
+		{
+			sum += *begin;
+		}
+	});
+
+	EXPECT_EQ(numBlocks, 11u);
+	EXPECT_EQ(sum, paged.size() * (paged.size() - 1) / 2);
+
+	numBlocks = 0;
+	contiguous.forEachBlock([&](const argon::sizet *begin, const argon::sizet *end)
+	{
+		++numBlocks;
+		EXPECT_EQ(static_cast<argon::sizet>(end - begin), contiguous.size());
+	});
+
+	EXPECT_EQ(numBlocks, 1u);
+}
+
+TEST(SlotMap, Reserve)
+{
+	argon::SlotMap<argon::sizet, 16> slotMap;
+	argon::vector<argon::SlotMap<argon::sizet, 16>::Slot> slots;
+
+	slotMap.reserve(5000);
+	EXPECT_GE(slotMap.capacity(), 5000u);
+
+	for (argon::sizet i = 0; i < 5000; ++i)
+	{
+		slots.push_back(slotMap.allocate(i));
+	}
+
+	EXPECT_GE(slotMap.capacity(), 5000u);
+	EXPECT_LT(slotMap.capacity(), 5016u)
+		<< "Reserved memory was enough, slot map should not grow";
+
+	for (argon::sizet i = 0; i < 5000; i += 2)
+	{
+		slotMap.erase(slots[i]);
+	}
+
+	for (argon::sizet i = 1; i < 5000; i += 2)
+	{
+		EXPECT_TRUE(slotMap.isSlotValid(slots[i]));
+		EXPECT_EQ(slotMap.at(slots[i]), i);
+	}
+}
+
+template <typename TMap>
+void checkBulk()
+{
+	TMap slotMap;
+	argon::vector<typename TMap::Slot> slots(1000);
+	argon::vector<argon::sizet> vals;
+
+	slotMap.allocateN(slots.size(), slots.data(), [](argon::sizet i) { return i; });
+	for (argon::sizet i = 0; i < slots.size(); ++i)
+	{
+		vals.push_back(i);
+		EXPECT_TRUE(slotMap.isSlotValid(slots[i]));
+		EXPECT_EQ(slotMap.at(slots[i]), i);
+	}
+
+	argon::vector<typename TMap::Slot> erased;
+	for (int i = static_cast<int>(slots.size()) - 1; i >= 0; --i)
+	{
+		// Holes at the front and erased objects at the back
+		if (i % 3 == 0 || i > 900)
+		{
+			erased.push_back(slots[static_cast<argon::sizet>(i)]);
+			slots.erase(slots.begin() + i);
+			vals.erase(vals.begin() + i);
+		}
+	}
+
+	slotMap.eraseN(erased.data(), erased.size());
+	ASSERT_EQ(slotMap.size(), slots.size());
+
+	for (const auto &slot : erased)
+	{
+		EXPECT_FALSE(slotMap.isSlotValid(slot));
+	}
+
+	for (argon::sizet i = 0; i < slots.size(); ++i)
+	{
+		EXPECT_TRUE(slotMap.isSlotValid(slots[i]));
+		EXPECT_EQ(slotMap.at(slots[i]), vals[i]);
+	}
+
+	argon::vector<typename TMap::Slot> reused(700);
+	slotMap.allocateN(reused.size(), reused.data());
+
+	for (const auto &slot : reused)
+	{
+		EXPECT_TRUE(slotMap.isSlotValid(slot));
+		EXPECT_EQ(slotMap.at(slot), 0u);
+	}
+
+	for (argon::sizet i = 0; i < slots.size(); ++i)
+	{
+		EXPECT_EQ(slotMap.at(slots[i]), vals[i]);
+	}
+
+	EXPECT_EQ(slotMap.size(), slots.size() + reused.size());
+}
+
+TEST(SlotMap, Bulk)
+{
+	checkBulk<argon::SlotMap<argon::sizet, 16>>();
+	checkBulk<argon::SlotMap<argon::sizet, 16, argon::ContiguousSlotMapStorage>>();
+}
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -87,6 +88,69 @@ TEST(SlotGenerator, Large)
 	}
 }
 
+TEST(SlotGenerator, ReleaseReuse)
+{
+	argon::SlotGenerator slotGenerator;
+
+	const auto slot0 = slotGenerator.acquire();
+	const auto slot1 = slotGenerator.acquire();
+	const auto slot2 = slotGenerator.acquire();
+
+	slotGenerator.release(slot1);
+	const auto reused = slotGenerator.acquire();
+	const auto next = slotGenerator.acquire();
+
+	EXPECT_EQ(reused.getIndex(), slot1.getIndex());
+	EXPECT_EQ(reused.getGeneration(), slot1.getGeneration() + 1);
+	EXPECT_NE(next.getIndex(), slot0.getIndex());
+	EXPECT_NE(next.getIndex(), slot2.getIndex())
+		<< "Released slot should not link to the slots in use";
+	EXPECT_TRUE(slotGenerator.isValid(slot2));
+	EXPECT_EQ(slotGenerator.size(), 4u);
+}
+
+TEST(SlotGenerator, Bulk)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::vector<argon::SlotGenerator::Slot> slots(argon::SlotGenerator::SLOTS_PER_PAGES * 10 + 3);
+
+	slotGenerator.acquireN(slots.size(), slots.data());
+	EXPECT_EQ(slotGenerator.size(), slots.size());
+
+	for (argon::sizet i = 0; i < slots.size(); ++i)
+	{
+		EXPECT_TRUE(slotGenerator.isValid(slots[i]));
+		EXPECT_EQ(slots[i].getIndex(), i);
+	}
+
+	slotGenerator.releaseN(slots.data(), slots.size() / 2);
+	EXPECT_EQ(slotGenerator.size(), slots.size() - slots.size() / 2);
+
+	for (argon::sizet i = 0; i < slots.size(); ++i)
+	{
+		EXPECT_EQ(slotGenerator.isValid(slots[i]), i >= slots.size() / 2);
+	}
+
+	argon::vector<argon::SlotGenerator::Slot> reused(slots.size());
+	slotGenerator.acquireN(reused.size(), reused.data());
+
+	std::sort(reused.begin(), reused.end(), [](auto lhs, auto rhs)
+	{
+		return lhs.getIndex() < rhs.getIndex();
+	});
+
+	for (argon::sizet i = 1; i < reused.size(); ++i)
+	{
+		EXPECT_NE(reused[i - 1].getIndex(), reused[i].getIndex())
+			<< "Slot was handed out twice";
+	}
+
+	for (argon::sizet i = slots.size() / 2; i < slots.size(); ++i)
+	{
+		EXPECT_TRUE(slotGenerator.isValid(slots[i]));
+	}
+}
+
 TEST(SparseStorage, SlotCheck)
 {
 	argon::SlotGenerator slotGenerator;
@@ -261,3 +325,275 @@ TEST(SparseStorage, StorageAccess)
 		}
 	}
 }
+
+TEST(SparseStorage, EraseRemap)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::vector<argon::SlotGenerator::Slot> slots;
+	argon::SparseStorage<argon::sizet> storage;
+
+	for (argon::sizet i = 0; i < argon::SlotGenerator::SLOTS_PER_PAGES * 4; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+		storage.assign(slots.back(), i);
+	}
+
+	storage.erase(slots[0]);
+	storage.erase(slots[1]);
+	storage.erase(slots[2]);
+
+	for (argon::sizet i = 3; i < slots.size(); ++i)
+	{
+		EXPECT_EQ(storage.at(slots[i]), i)
+			<< "Data moved into the erased location is not reachable through its slot";
+	}
+
+	for (argon::sizet i = 0; i < storage.size(); ++i)
+	{
+		EXPECT_EQ(storage.getData()[i], storage.at(storage.getSlots()[i]))
+			<< "Backwards mapping does not match the dense storage";
+	}
+}
+
+TEST(SparseStorage, SparseAssign)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::vector<argon::SlotGenerator::Slot> slots;
+	argon::SparseStorage<argon::sizet> storage;
+
+	for (argon::uint32 i = 0; i < argon::SlotGenerator::SLOTS_PER_PAGES * 8; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+	}
+
+	storage.assign(slots[argon::SlotGenerator::SLOTS_PER_PAGES * 5], 5u);
+	storage.assign(slots[argon::SlotGenerator::SLOTS_PER_PAGES * 2], 2u);
+	storage.assign(slots[argon::SlotGenerator::SLOTS_PER_PAGES * 7], 7u);
+
+	EXPECT_EQ(storage.at(slots[argon::SlotGenerator::SLOTS_PER_PAGES * 5]), 5u);
+	EXPECT_EQ(storage.at(slots[argon::SlotGenerator::SLOTS_PER_PAGES * 2]), 2u);
+	EXPECT_EQ(storage.at(slots[argon::SlotGenerator::SLOTS_PER_PAGES * 7]), 7u);
+
+	EXPECT_EQ(storage.find(slots[0]), nullptr);
+	EXPECT_EQ(storage.find(slots[argon::SlotGenerator::SLOTS_PER_PAGES * 3]), nullptr);
+	ASSERT_NE(storage.find(slots[argon::SlotGenerator::SLOTS_PER_PAGES * 2]), nullptr);
+	EXPECT_EQ(*storage.find(slots[argon::SlotGenerator::SLOTS_PER_PAGES * 2]), 2u);
+}
+
+TEST(SparseStorage, Compact)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::vector<argon::SlotGenerator::Slot> slots;
+	argon::SparseStorage<argon::sizet> storage;
+
+	for (argon::sizet i = 0; i < argon::SlotGenerator::SLOTS_PER_PAGES * 4; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+	}
+
+	// Assigned backwards, so the dense order is reversed
+	for (argon::sizet i = slots.size(); i-- > 0;)
+	{
+		if (i % 3)
+		{
+			storage.assign(slots[i], i);
+		}
+	}
+
+	EXPECT_FALSE(storage.isSorted());
+
+	argon::sizet numSteps = 0;
+	while (!storage.compact(16u))
+	{
+		++numSteps;
+		ASSERT_LT(numSteps, slots.size());
+	}
+
+	EXPECT_GT(numSteps, 1u) << "Compaction should be spread over several calls";
+	EXPECT_TRUE(storage.isSorted());
+
+	for (argon::sizet i = 1; i < storage.size(); ++i)
+	{
+		EXPECT_LT(storage.getSlots()[i - 1].getIndex(), storage.getSlots()[i].getIndex());
+	}
+
+	for (argon::sizet i = 0; i < slots.size(); ++i)
+	{
+		if (i % 3)
+		{
+			EXPECT_EQ(storage.at(slots[i]), i);
+		}
+	}
+
+	for (argon::sizet i = 0; i < storage.size(); ++i)
+	{
+		EXPECT_EQ(storage.getData()[i], storage.at(storage.getSlots()[i]));
+	}
+}
+
+TEST(SparseStorage, CompactWithChanges)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::vector<argon::SlotGenerator::Slot> slots;
+	argon::SparseStorage<argon::sizet> storage;
+
+	for (argon::sizet i = 0; i < argon::SlotGenerator::SLOTS_PER_PAGES * 4; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+		storage.assign(slots.back(), i);
+	}
+
+	EXPECT_TRUE(storage.isSorted());
+
+	for (argon::sizet i = 0; i < slots.size(); i += 5)
+	{
+		storage.erase(slots[i]);
+	}
+
+	EXPECT_FALSE(storage.isSorted());
+
+	// Interleave the steps with erasures in the sorted part and assignments behind the cursor
+	for (argon::sizet step = 0; step < 10; ++step)
+	{
+		storage.compact(32u);
+
+		const argon::sizet erased = step * 5 + 1;
+		storage.erase(slots[erased]);
+		slots[erased] = argon::SlotGenerator::Slot();
+
+		const argon::sizet reassigned = step * 5;
+		storage.assign(slots[reassigned], reassigned);
+	}
+
+	for (argon::sizet step = 0; !storage.compact(32u); ++step)
+	{
+		ASSERT_LT(step, slots.size());
+	}
+
+	for (argon::sizet i = 1; i < storage.size(); ++i)
+	{
+		EXPECT_LT(storage.getSlots()[i - 1].getIndex(), storage.getSlots()[i].getIndex());
+	}
+
+	for (argon::sizet i = 0; i < storage.size(); ++i)
+	{
+		EXPECT_EQ(storage.getData()[i], storage.at(storage.getSlots()[i]));
+	}
+
+	for (argon::sizet i = 0; i < 50; ++i)
+	{
+		EXPECT_EQ(storage.has(slots[i]), i % 5 != 1);
+	}
+}
+
+TEST(SparseStorage, SharesOrdering)
+{
+	argon::SlotGenerator slotGenerator;
+	argon::vector<argon::SlotGenerator::Slot> slots;
+	argon::SparseStorage<argon::sizet> lhs;
+	argon::SparseStorage<float> rhs;
+
+	EXPECT_TRUE(lhs.sharesOrdering(rhs));
+
+	for (argon::sizet i = 0; i < argon::SlotGenerator::SLOTS_PER_PAGES * 2; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+		lhs.assign(slots.back(), i);
+	}
+
+	for (argon::sizet i = slots.size(); i-- > 0;)
+	{
+		rhs.assign(slots[i], static_cast<float>(i));
+	}
+
+	EXPECT_FALSE(lhs.sharesOrdering(rhs));
+
+	while (!rhs.compact(64u))
+	{
+	}
+
+	EXPECT_TRUE(lhs.sharesOrdering(rhs));
+	EXPECT_TRUE(rhs.sharesOrdering(lhs));
+
+	// Same size, but the back slot moved into the hole, the cached match is stale
+	rhs.erase(slots.front());
+	rhs.assign(slots.front(), 0.f);
+	EXPECT_FALSE(lhs.sharesOrdering(rhs));
+	EXPECT_FALSE(rhs.sharesOrdering(lhs));
+
+	while (!rhs.compact(64u))
+	{
+	}
+
+	EXPECT_TRUE(lhs.sharesOrdering(rhs));
+	EXPECT_TRUE(lhs.sharesOrdering(rhs)) << "Cached match of unchanged storages";
+
+	rhs.erase(slots.back());
+	EXPECT_FALSE(lhs.sharesOrdering(rhs));
+}
+
+TEST(SparseStorage, Versions)
+{
+	constexpr argon::sizet BLOCK_SIZE = argon::SparseStorage<argon::sizet>::VERSION_BLOCK_SIZE;
+
+	argon::SlotGenerator slotGenerator;
+	argon::vector<argon::SlotGenerator::Slot> slots;
+	argon::SparseStorage<argon::sizet> storage;
+
+	for (argon::sizet i = 0; i < BLOCK_SIZE * 3 + 10; ++i)
+	{
+		slots.push_back(slotGenerator.acquire());
+		storage.assign(slots.back(), i);
+	}
+
+	const auto changedBlocks = [&storage](argon::uint64 since)
+	{
+		argon::vector<argon::sizet> blocks;
+		for (argon::sizet block = 0; block * BLOCK_SIZE < storage.size(); ++block)
+		{
+			if (storage.getBlockVersions()[block] > since)
+			{
+				blocks.push_back(block);
+			}
+		}
+
+		return blocks;
+	};
+
+	argon::uint64 since = storage.observe();
+	EXPECT_TRUE(changedBlocks(since).empty());
+
+	EXPECT_EQ(std::as_const(storage).at(slots[0]), 0u);
+	EXPECT_NE(std::as_const(storage).find(slots[1]), nullptr);
+	EXPECT_TRUE(changedBlocks(since).empty()) << "Read only access changed the version";
+
+	storage.at(slots[BLOCK_SIZE * 2 + 1]) = 7u;
+	EXPECT_EQ(changedBlocks(since), argon::vector<argon::sizet>({2u}));
+
+	// The back element moves into the first block
+	since = storage.observe();
+	storage.erase(slots[1]);
+	EXPECT_EQ(changedBlocks(since), argon::vector<argon::sizet>({0u}));
+
+	since = storage.observe();
+	storage.assign(slots[1], 1u);
+	EXPECT_EQ(changedBlocks(since), argon::vector<argon::sizet>({3u}));
+
+	since = storage.observe();
+	for (auto &value : storage)
+	{
+		++value;
+	}
+
+	EXPECT_EQ(changedBlocks(since), argon::vector<argon::sizet>({0u, 1u, 2u, 3u}));
+
+	// A write marked with the observed version is not seen by the same observer
+	since = storage.observe();
+	storage.markBlockChanged(1u, since);
+	EXPECT_TRUE(changedBlocks(since).empty());
+
+	// but an older version never hides a newer write
+	storage.markBlockChanged(2u);
+	storage.markBlockChanged(2u, since);
+	EXPECT_EQ(changedBlocks(since), argon::vector<argon::sizet>({2u}));
+}
@@ -0,0 +1,252 @@
+#include <array>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rttr/registration.h>
+
+#include <engine_core/entity_manager.hpp>
+#include <engine_core/reflection.hpp>
+#include <engine_core/system.hpp>
+
+#include "engine_test.hpp"
+
+namespace
+{
+using argon::test::Scenario;
+
+constexpr argon::uint32 NUM_FRAMES = 6;
+constexpr argon::uint32 NUM_ENTITIES = 200;
+constexpr argon::uint32 BLOCK_SIZE = argon::SparseStorage<argon::uint32>::VERSION_BLOCK_SIZE;
+// Written through EntityManager::get by the writer in WRITE_FRAME, it is in the second block
+constexpr argon::uint32 WRITTEN_ENTITY = BLOCK_SIZE + 6;
+constexpr argon::uint32 WRITE_FRAME = 2;
+// Entities with JoinB and JoinC, but without JoinA
+constexpr argon::uint32 NUM_JOIN_EXTRA = 300;
+
+struct ChangedValue
+{
+	argon::uint32 m_value = 0;
+};
+
+struct JoinA
+{
+	argon::uint32 m_value = 0;
+};
+
+struct JoinB
+{
+	argon::uint32 m_value = 0;
+};
+
+struct JoinC
+{
+	argon::uint32 m_value = 0;
+};
+
+constexpr argon::uint32 WRITER = 0;
+constexpr argon::uint32 READER = 1;
+constexpr argon::uint32 JOIN_WRITER = 2;
+constexpr argon::uint32 JOIN_READER = 3;
+constexpr argon::uint32 NUM_CHANGED_SYSTEMS = 4;
+
+struct ChangedLog
+{
+	std::atomic<argon::uint32> m_sequence{0};
+	// Sequence number of the start of every tick
+	std::array<std::array<argon::uint32, NUM_FRAMES>, NUM_CHANGED_SYSTEMS> m_starts{};
+	// Number of entities visited by the filtered queries
+	std::array<std::array<argon::uint32, NUM_FRAMES>, NUM_CHANGED_SYSTEMS> m_counts{};
+	// Number of entities visited by the joins
+	std::array<argon::uint32, NUM_FRAMES> m_joined{};
+};
+
+ChangedLog s_log;
+
+template <argon::uint32 SYSTEM>
+class ChangedSystem final
+	: public argon::SystemBase
+{
+public:
+	ChangedSystem(ConstructionData &&data)
+		: argon::SystemBase(std::move(data))
+		, m_frame(0)
+	{
+	}
+
+	void initialize()
+	{
+		if (argon::test::getScenario() != Scenario::ChangedFilter)
+		{
+			return;
+		}
+
+		argon::EntityManager &entityManager = getEntityManager();
+		if constexpr (SYSTEM == WRITER)
+		{
+			for (argon::uint32 i = 0; i < NUM_ENTITIES; ++i)
+			{
+				m_entities.push_back(entityManager.createEntity());
+				entityManager.assign<ChangedValue>(m_entities.back());
+			}
+		}
+		else if constexpr (SYSTEM == JOIN_WRITER)
+		{
+			// Only the first entity has all three components. JoinB has more elements than JoinA,
+			// so it never shares the ordering with the driver and is resolved entity by entity.
+			for (argon::uint32 i = 0; i < NUM_ENTITIES; ++i)
+			{
+				const argon::Entity e = entityManager.createEntity();
+				entityManager.assign<JoinA>(e);
+				entityManager.assign<JoinB>(e);
+				if (i == 0)
+				{
+					entityManager.assign<JoinC>(e);
+				}
+			}
+
+			for (argon::uint32 i = 0; i < NUM_JOIN_EXTRA; ++i)
+			{
+				const argon::Entity e = entityManager.createEntity();
+				entityManager.assign<JoinB>(e);
+				entityManager.assign<JoinC>(e);
+			}
+		}
+	}
+
+	void finalize() {}
+
+	void tick()
+	{
+		if (argon::test::getScenario() != Scenario::ChangedFilter)
+		{
+			return;
+		}
+
+		s_log.m_starts[SYSTEM][m_frame] = s_log.m_sequence.fetch_add(1u);
+
+		argon::EntityManager &entityManager = getEntityManager();
+		argon::uint32 &count = s_log.m_counts[SYSTEM][m_frame];
+		count = 0;
+		if constexpr (SYSTEM == WRITER)
+		{
+			// Writes everything it visits
+			entityManager.query<ChangedValue>(m_changed).each([&count](ChangedValue &value)
+			{
+				++value.m_value;
+				++count;
+			});
+
+			if (m_frame == WRITE_FRAME)
+			{
+				++entityManager.get<ChangedValue>(m_entities[WRITTEN_ENTITY]).m_value;
+			}
+		}
+		else if constexpr (SYSTEM == READER)
+		{
+			entityManager.query<const ChangedValue>(m_changed).each([&count](const ChangedValue&) { ++count; });
+		}
+		else if constexpr (SYSTEM == JOIN_WRITER)
+		{
+			argon::uint32 &joined = s_log.m_joined[m_frame];
+			joined = 0;
+			auto join = entityManager.query<JoinA, JoinB, JoinC>();
+
+			// Both ways of the iteration have to mark only the entities which matched
+			if (m_frame % 2 == 0)
+			{
+				join.each([&joined](JoinA&, JoinB &b, JoinC&) { ++b.m_value; ++joined; });
+			}
+			else
+			{
+				for (auto [a, b, c] : join)
+				{
+					++b.m_value;
+					++joined;
+				}
+			}
+		}
+		else if constexpr (SYSTEM == JOIN_READER)
+		{
+			entityManager.query<const JoinB>(m_changedB).each([&count](const JoinB&) { ++count; });
+		}
+
+		++m_frame;
+	}
+
+private:
+	std::vector<argon::Entity> m_entities;
+	argon::Changed<ChangedValue> m_changed;
+	argon::Changed<const JoinB> m_changedB;
+	argon::uint32 m_frame;
+	AR_PAD(4);
+};
+
+using ChangedWriter = ChangedSystem<WRITER>;
+using ChangedReader = ChangedSystem<READER>;
+using JoinWriter = ChangedSystem<JOIN_WRITER>;
+using JoinReader = ChangedSystem<JOIN_READER>;
+} // namespace
+
+RTTR_REGISTRATION
+{
+	argon::reflection::Component<ChangedValue>("test::ChangedValue");
+	argon::reflection::Component<JoinA>("test::JoinA");
+	argon::reflection::Component<JoinB>("test::JoinB");
+	argon::reflection::Component<JoinC>("test::JoinC");
+	argon::reflection::System<ChangedWriter>("test::ChangedWriter")
+		.writes<ChangedValue>();
+	argon::reflection::System<ChangedReader>("test::ChangedReader")
+		.reads<ChangedValue>();
+	argon::reflection::System<JoinWriter>("test::JoinWriter")
+		.writes<JoinA, JoinB, JoinC>();
+	argon::reflection::System<JoinReader>("test::JoinReader")
+		.reads<JoinB>();
+}
+
+TEST(ChangedFilter, WritingQuerySettles)
+{
+	argon::test::runEngine(Scenario::ChangedFilter, NUM_FRAMES);
+
+	// Every block is new in the first frame, afterwards only the block written through get
+	// is visited once
+	const argon::uint32 expected[NUM_FRAMES] = {NUM_ENTITIES, 0u, 0u, BLOCK_SIZE, 0u, 0u};
+	for (argon::uint32 frame = 0; frame < NUM_FRAMES; ++frame)
+	{
+		EXPECT_EQ(expected[frame], s_log.m_counts[WRITER][frame])
+			<< "Query reports its own writes in frame " << frame;
+	}
+
+	// The reader sees every write of the writer, a frame later if it runs first
+	const bool writerFirst = s_log.m_starts[WRITER][0] < s_log.m_starts[READER][0];
+	const argon::uint32 expectedReader[2][NUM_FRAMES] = {
+		{NUM_ENTITIES, NUM_ENTITIES, 0u, BLOCK_SIZE, BLOCK_SIZE, 0u},
+		{NUM_ENTITIES, 0u, BLOCK_SIZE, BLOCK_SIZE, 0u, 0u}};
+	for (argon::uint32 frame = 0; frame < NUM_FRAMES; ++frame)
+	{
+		EXPECT_EQ(writerFirst, s_log.m_starts[WRITER][frame] < s_log.m_starts[READER][frame]);
+		EXPECT_EQ(expectedReader[writerFirst][frame], s_log.m_counts[READER][frame])
+			<< "Reader misses a write or sees a stale one in frame " << frame;
+	}
+}
+
+TEST(ChangedFilter, JoinMarksOnlyMatches)
+{
+	argon::test::runEngine(Scenario::ChangedFilter, NUM_FRAMES);
+
+	for (argon::uint32 frame = 0; frame < NUM_FRAMES; ++frame)
+	{
+		EXPECT_EQ(1u, s_log.m_joined[frame]);
+	}
+
+	EXPECT_EQ(NUM_ENTITIES + NUM_JOIN_EXTRA, s_log.m_counts[JOIN_READER][0]);
+
+	// Only the block of the entity which has all three components is written
+	for (argon::uint32 frame = 1; frame < NUM_FRAMES; ++frame)
+	{
+		EXPECT_EQ(BLOCK_SIZE, s_log.m_counts[JOIN_READER][frame])
+			<< "Entities without JoinC are marked as changed in frame " << frame;
+	}
+}
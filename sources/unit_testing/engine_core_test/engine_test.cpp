@@ -0,0 +1,88 @@
+#include <filesystem>
+#include <string>
+#include <utility>
+
+#include <rttr/registration.h>
+
+#include <engine_core/engine.hpp>
+#include <engine_core/engine_state.hpp>
+#include <engine_core/reflection.hpp>
+
+#include "engine_test.hpp"
+
+namespace argon::test
+{
+namespace
+{
+struct EngineRun
+{
+	Scenario m_scenario;
+	uint32 m_numFrames;
+	uint32 m_frame;
+	AR_PAD(4);
+	const FrameFunction *m_onFrame;
+};
+
+EngineRun *s_run = nullptr;
+
+// Exclusive, runs alone on the main thread
+class FrameSystem final
+	: public SystemBase
+{
+public:
+	FrameSystem(ConstructionData &&data)
+		: SystemBase(std::move(data))
+	{
+	}
+
+	void initialize() {}
+	void finalize() {}
+
+	void tick()
+	{
+		if (*s_run->m_onFrame)
+		{
+			(*s_run->m_onFrame)(*this, s_run->m_frame);
+		}
+
+		if (++s_run->m_frame == s_run->m_numFrames)
+		{
+			get<EngineState>().requestShutdown();
+		}
+	}
+};
+
+// The engine looks for <dir>/../../resources and <dir>/plugins next to the executable
+std::string getExecutablePath()
+{
+	const std::filesystem::path root = std::filesystem::temp_directory_path() / "argon_engine_test";
+	std::filesystem::create_directories(root / "resources");
+	std::filesystem::create_directories(root / "binaries" / "bin" / "plugins");
+
+	return (root / "binaries" / "bin" / "engine_test").string();
+}
+} // namespace
+
+void runEngine(Scenario scenario, uint32 numFrames, const FrameFunction &onFrame)
+{
+	EngineRun run{scenario, numFrames, 0u, {}, &onFrame};
+	s_run = &run;
+
+	{
+		Engine engine(getExecutablePath());
+		engine.exec();
+	}
+
+	s_run = nullptr;
+}
+
+Scenario getScenario()
+{
+	return s_run ? s_run->m_scenario : Scenario::None;
+}
+} // namespace argon::test
+
+RTTR_REGISTRATION
+{
+	argon::reflection::System<argon::test::FrameSystem>("test::FrameSystem");
+}
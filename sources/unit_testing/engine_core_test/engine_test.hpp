@@ -0,0 +1,32 @@
+#pragma once
+
+#include <functional>
+
+#include <engine_core/system.hpp>
+
+#include <fundamental/types.hpp>
+
+namespace argon::test
+{
+// Systems are registered for the whole process, so every engine creates the systems of all tests.
+// They do their work only while the engine of their scenario runs.
+enum class Scenario : uint32
+{
+	None = 0,
+	AccessCheck,
+	AccessCheckAssign,
+	AccessCheckGet,
+	ChangedFilter,
+	CommandBuffer,
+	Schedule,
+	Transform
+};
+
+using FrameFunction = std::function<void(SystemBase &system, uint32 frame)>;
+
+// Runs an engine for numFrames frames. onFrame is invoked once per frame on the calling thread by
+// an exclusive system, its order among the other systems is not defined.
+void runEngine(Scenario scenario, uint32 numFrames, const FrameFunction &onFrame = FrameFunction());
+
+Scenario getScenario();
+} // namespace argon::test
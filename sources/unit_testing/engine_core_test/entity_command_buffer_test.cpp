@@ -0,0 +1,215 @@
+#include <array>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <rttr/registration.h>
+
+#include <engine_core/entity_command_buffer.hpp>
+#include <engine_core/entity_manager.hpp>
+#include <engine_core/job_system.hpp>
+#include <engine_core/reflection.hpp>
+#include <engine_core/system.hpp>
+
+#include "engine_test.hpp"
+
+namespace
+{
+using argon::test::Scenario;
+
+constexpr argon::uint32 NUM_ENTITIES = 256;
+// Small batches, so the jobs of several threads record into their own buffers
+constexpr argon::sizet GRAIN_SIZE = 16;
+// Added by the assignments which replace the value
+constexpr argon::uint32 REPLACED = 1000;
+
+constexpr argon::uint32 FIRST_RECORDER = 0;
+constexpr argon::uint32 SECOND_RECORDER = 1;
+constexpr argon::uint32 NUM_RECORDERS = 2;
+
+template <argon::uint32 SYSTEM>
+struct RecordedValue
+{
+	argon::uint32 m_value = 0;
+};
+
+// Every entry is written by a single job of its recorder
+struct RecordLog
+{
+	std::array<std::array<argon::Entity, NUM_ENTITIES>, NUM_RECORDERS> m_entities;
+	// Destroyed in the frame of its creation, after its component was assigned
+	std::array<argon::Entity, NUM_RECORDERS> m_transient;
+};
+
+RecordLog s_log;
+
+// Both recorders declare their own component, so they run alongside each other.
+// Frame 0 creates the entities, frame 1 erases, replaces and destroys.
+template <argon::uint32 SYSTEM>
+class RecorderSystem final
+	: public argon::SystemBase
+{
+public:
+	RecorderSystem(ConstructionData &&data)
+		: argon::SystemBase(std::move(data))
+		, m_frame(0)
+	{
+	}
+
+	void initialize() {}
+	void finalize() {}
+
+	void tick()
+	{
+		if (argon::test::getScenario() != Scenario::CommandBuffer)
+		{
+			return;
+		}
+
+		argon::EntityManager &entityManager = getEntityManager();
+		argon::JobSystem &jobSystem = get<argon::JobSystem>();
+
+		if (m_frame == 0)
+		{
+			jobSystem.parallelFor(0u, NUM_ENTITIES, GRAIN_SIZE, [&entityManager](argon::sizet i)
+			{
+				argon::EntityCommandBuffer &buffer = entityManager.getCommandBuffer();
+				const argon::Entity e = buffer.createEntity();
+
+				s_log.m_entities[SYSTEM][i] = e;
+				buffer.assign<Value>(e, Value{static_cast<argon::uint32>(i)});
+			});
+
+			argon::EntityCommandBuffer &buffer = entityManager.getCommandBuffer();
+			s_log.m_transient[SYSTEM] = buffer.createEntity();
+			buffer.assign<Value>(s_log.m_transient[SYSTEM]);
+			buffer.destroyEntity(s_log.m_transient[SYSTEM]);
+		}
+		else if (m_frame == 1)
+		{
+			jobSystem.parallelFor(0u, NUM_ENTITIES, GRAIN_SIZE, [&entityManager](argon::sizet i)
+			{
+				argon::EntityCommandBuffer &buffer = entityManager.getCommandBuffer();
+				const argon::Entity &e = s_log.m_entities[SYSTEM][i];
+
+				if (i % 2 == 0)
+				{
+					// The second erase finds nothing
+					buffer.erase<Value>(e);
+					buffer.erase<Value>(e);
+					return;
+				}
+
+				buffer.assign<Value>(e, Value{static_cast<argon::uint32>(i) + REPLACED});
+				if (i % 4 == 1)
+				{
+					buffer.destroyEntity(e);
+				}
+			});
+		}
+
+		++m_frame;
+	}
+
+private:
+	using Value = RecordedValue<SYSTEM>;
+
+	argon::uint32 m_frame;
+	AR_PAD(4);
+};
+
+using FirstRecorder = RecorderSystem<FIRST_RECORDER>;
+using SecondRecorder = RecorderSystem<SECOND_RECORDER>;
+
+template <argon::uint32 SYSTEM>
+argon::uint32 countValues(argon::EntityManager &entityManager)
+{
+	argon::uint32 count = 0;
+	entityManager.query<const RecordedValue<SYSTEM>>().each([&count](const RecordedValue<SYSTEM>&) { ++count; });
+	return count;
+}
+
+// State after the playback of frame 0
+template <argon::uint32 SYSTEM>
+void expectCreated(argon::EntityManager &entityManager)
+{
+	EXPECT_FALSE(entityManager.isValid(s_log.m_transient[SYSTEM]))
+		<< "Entity destroyed after the assignment is still valid";
+	EXPECT_EQ(NUM_ENTITIES, countValues<SYSTEM>(entityManager))
+		<< "Component of the destroyed entity was not removed";
+
+	for (argon::uint32 i = 0; i < NUM_ENTITIES; ++i)
+	{
+		const argon::Entity &e = s_log.m_entities[SYSTEM][i];
+
+		ASSERT_TRUE(entityManager.isValid(e)) << "Recorder " << SYSTEM << ", entity " << i;
+		ASSERT_TRUE(entityManager.has<RecordedValue<SYSTEM>>(e)) << "Recorder " << SYSTEM << ", entity " << i;
+		EXPECT_EQ(i, entityManager.get<RecordedValue<SYSTEM>>(e).m_value);
+	}
+}
+
+// State after the playback of frame 1
+template <argon::uint32 SYSTEM>
+void expectChanged(argon::EntityManager &entityManager)
+{
+	EXPECT_EQ(NUM_ENTITIES / 4, countValues<SYSTEM>(entityManager));
+
+	for (argon::uint32 i = 0; i < NUM_ENTITIES; ++i)
+	{
+		const argon::Entity &e = s_log.m_entities[SYSTEM][i];
+
+		if (i % 2 == 0)
+		{
+			ASSERT_TRUE(entityManager.isValid(e)) << "Recorder " << SYSTEM << ", entity " << i;
+			EXPECT_FALSE(entityManager.has<RecordedValue<SYSTEM>>(e)) << "Recorder " << SYSTEM << ", entity " << i;
+		}
+		else if (i % 4 == 1)
+		{
+			EXPECT_FALSE(entityManager.isValid(e))
+				<< "Destruction should be played back after the assignment, entity " << i;
+		}
+		else
+		{
+			ASSERT_TRUE(entityManager.isValid(e)) << "Recorder " << SYSTEM << ", entity " << i;
+			EXPECT_EQ(i + REPLACED, entityManager.get<RecordedValue<SYSTEM>>(e).m_value)
+				<< "Assignment should replace the present component";
+		}
+	}
+}
+} // namespace
+
+RTTR_REGISTRATION
+{
+	argon::reflection::Component<RecordedValue<FIRST_RECORDER>>("test::FirstRecordedValue");
+	argon::reflection::Component<RecordedValue<SECOND_RECORDER>>("test::SecondRecordedValue");
+	argon::reflection::System<FirstRecorder>("test::FirstRecorder")
+		.writes<RecordedValue<FIRST_RECORDER>>();
+	argon::reflection::System<SecondRecorder>("test::SecondRecorder")
+		.writes<RecordedValue<SECOND_RECORDER>>();
+}
+
+TEST(EntityCommandBuffer, PlaybackAfterTick)
+{
+	argon::uint32 checks = 0;
+
+	// Commands recorded in a frame are played back before the next one
+	argon::test::runEngine(Scenario::CommandBuffer, 3u, [&checks](argon::SystemBase &system, argon::uint32 frame)
+	{
+		argon::EntityManager &entityManager = system.getEntityManager();
+
+		if (frame == 1)
+		{
+			expectCreated<FIRST_RECORDER>(entityManager);
+			expectCreated<SECOND_RECORDER>(entityManager);
+			++checks;
+		}
+		else if (frame == 2)
+		{
+			expectChanged<FIRST_RECORDER>(entityManager);
+			expectChanged<SECOND_RECORDER>(entityManager);
+			++checks;
+		}
+	});
+
+	EXPECT_EQ(2u, checks);
+}
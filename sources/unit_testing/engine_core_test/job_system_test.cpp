@@ -0,0 +1,240 @@
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <engine_core/job_system.hpp>
+
+#include "engine_test.hpp"
+
+namespace
+{
+using Counters = std::unique_ptr<std::atomic<argon::uint32>[]>;
+
+// Runs func with the job system of an engine on the main thread, which is a worker
+template <typename TFunc>
+void runWithJobs(TFunc &&func)
+{
+	argon::test::runEngine(argon::test::Scenario::None, 1u,
+		[&func](argon::SystemBase &system, argon::uint32)
+		{
+			func(system.get<argon::JobSystem>());
+		});
+}
+
+Counters makeCounters(argon::sizet size)
+{
+	Counters counters(new std::atomic<argon::uint32>[size]);
+	for (argon::sizet i = 0; i < size; ++i)
+	{
+		counters[i].store(0u);
+	}
+
+	return counters;
+}
+
+argon::sizet countMismatches(const Counters &counters, argon::sizet size, argon::uint32 expected)
+{
+	argon::sizet mismatches = 0;
+	for (argon::sizet i = 0; i < size; ++i)
+	{
+		mismatches += counters[i].load() != expected;
+	}
+
+	return mismatches;
+}
+} // namespace
+
+TEST(JobSystem, ParallelForVisitsEveryIndexOnce)
+{
+	constexpr argon::sizet SIZE = 100000;
+	const argon::sizet grainSizes[] = {1u, 7u, 512u, SIZE * 2};
+	const Counters counters = makeCounters(SIZE);
+
+	runWithJobs([&counters, &grainSizes](argon::JobSystem &jobs)
+	{
+		for (const argon::sizet grainSize : grainSizes)
+		{
+			jobs.parallelFor(0u, SIZE, grainSize, [&counters](argon::sizet i) { counters[i].fetch_add(1u); });
+		}
+	});
+
+	EXPECT_EQ(0u, countMismatches(counters, SIZE, static_cast<argon::uint32>(std::size(grainSizes))))
+		<< "Every grain size should visit every index exactly once";
+}
+
+TEST(JobSystem, NestedParallelFor)
+{
+	constexpr argon::sizet OUTER = 64;
+	constexpr argon::sizet INNER = 2000;
+	constexpr argon::uint32 REPEATS = 10;
+	const Counters counters = makeCounters(OUTER * INNER);
+
+	runWithJobs([&counters](argon::JobSystem &jobs)
+	{
+		for (argon::uint32 repeat = 0; repeat < REPEATS; ++repeat)
+		{
+			// Inner loops wait on the workers, which keep executing and stealing the other jobs
+			jobs.parallelFor(0u, OUTER, 1u, [&jobs, &counters](argon::sizet outer)
+			{
+				jobs.parallelFor(0u, INNER, 16u, [&counters, outer](argon::sizet inner)
+				{
+					counters[outer * INNER + inner].fetch_add(1u);
+				});
+			});
+		}
+	});
+
+	EXPECT_EQ(0u, countMismatches(counters, OUTER * INNER, REPEATS));
+}
+
+TEST(JobSystem, FullDequeExecutesInPlace)
+{
+	// More jobs than a deque holds, none of them is waited for before the last one is pushed
+	constexpr argon::sizet SIZE = 20000;
+	const Counters counters = makeCounters(SIZE);
+
+	runWithJobs([&counters](argon::JobSystem &jobs)
+	{
+		argon::JobCounter counter;
+		for (argon::sizet i = 0; i < SIZE; ++i)
+		{
+			jobs.run(argon::Job{[](void *data, argon::sizet begin, argon::sizet)
+				{
+					static_cast<std::atomic<argon::uint32>*>(data)[begin].fetch_add(1u);
+				}, counters.get(), i, i + 1, &counter});
+		}
+
+		jobs.wait(counter);
+		EXPECT_TRUE(counter.isDone());
+	});
+
+	EXPECT_EQ(0u, countMismatches(counters, SIZE, 1u));
+}
+
+TEST(JobSystem, Dependencies)
+{
+	runWithJobs([](argon::JobSystem &jobs)
+	{
+		for (argon::uint32 repeat = 0; repeat < 100; ++repeat)
+		{
+			std::atomic<argon::uint32> stage(0u);
+			bool ordered = true;
+
+			auto first = [&stage]()
+			{
+				std::this_thread::yield();
+				stage.store(1u);
+			};
+			auto second = [&stage, &ordered]()
+			{
+				ordered = stage.load() == 1u;
+				stage.store(2u);
+			};
+			auto third = [&stage, &ordered]()
+			{
+				ordered = ordered && stage.load() == 2u;
+			};
+
+			argon::JobCounter firstDone;
+			argon::JobCounter secondDone;
+			argon::JobCounter thirdDone;
+
+			// The dependents are deferred while the first job may be already running
+			jobs.run(first, firstDone);
+			jobs.run(second, secondDone, &firstDone);
+			jobs.run(third, thirdDone, &secondDone);
+			jobs.wait(thirdDone);
+
+			EXPECT_TRUE(ordered);
+			EXPECT_TRUE(firstDone.isDone() && secondDone.isDone());
+		}
+	});
+}
+
+TEST(JobSystem, DependentsOfReusedCounter)
+{
+	struct State
+	{
+		std::atomic<argon::uint32> m_finished{0u};
+		std::atomic<argon::uint32> m_deferred{0u};
+		std::atomic<bool> m_ordered{true};
+		AR_PAD(3);
+	};
+
+	runWithJobs([](argon::JobSystem &jobs)
+	{
+		constexpr argon::uint32 REPEATS = 200;
+		constexpr argon::uint32 NUM_JOBS = 64;
+
+		for (argon::uint32 repeat = 0; repeat < REPEATS; ++repeat)
+		{
+			State state;
+			argon::JobCounter counter;
+			argon::JobCounter deferredDone;
+
+			// Jobs are added to the counter while the earlier ones finish and hand off their dependents.
+			// A dependent has to run after the jobs added before it, its begin is their number.
+			for (argon::sizet i = 0; i < NUM_JOBS; ++i)
+			{
+				jobs.run(argon::Job{[](void *data, argon::sizet, argon::sizet)
+					{
+						static_cast<State*>(data)->m_finished.fetch_add(1u);
+					}, &state, 0u, 0u, &counter});
+
+				jobs.run(argon::Job{[](void *data, argon::sizet begin, argon::sizet)
+					{
+						State &s = *static_cast<State*>(data);
+						if (s.m_finished.load() < begin)
+						{
+							s.m_ordered.store(false);
+						}
+						s.m_deferred.fetch_add(1u);
+					}, &state, i + 1, 0u, &deferredDone}, &counter);
+			}
+
+			// Both counters are destroyed right after they are done
+			jobs.wait(deferredDone);
+			jobs.wait(counter);
+
+			EXPECT_TRUE(state.m_ordered.load()) << "Dependent ran before the jobs it was deferred on";
+			EXPECT_EQ(NUM_JOBS, state.m_deferred.load());
+			EXPECT_EQ(NUM_JOBS, state.m_finished.load());
+		}
+	});
+}
+
+TEST(JobSystem, JobsFromForeignThreads)
+{
+	constexpr argon::sizet NUM_THREADS = 4;
+	constexpr argon::sizet SIZE = 10000;
+	const Counters counters = makeCounters(SIZE * NUM_THREADS);
+
+	runWithJobs([&counters](argon::JobSystem &jobs)
+	{
+		argon::vector<std::thread> threads;
+
+		// The threads are not workers, their jobs go through the injected queue
+		for (argon::sizet t = 0; t < NUM_THREADS; ++t)
+		{
+			threads.emplace_back([&jobs, &counters, t]()
+			{
+				jobs.parallelFor(t * SIZE, (t + 1) * SIZE, 64u, [&counters](argon::sizet i)
+				{
+					counters[i].fetch_add(1u);
+				});
+			});
+		}
+
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+	});
+
+	EXPECT_EQ(0u, countMismatches(counters, SIZE * NUM_THREADS, 1u));
+}
@@ -0,0 +1,441 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <fundamental/log.hpp>
+
+#include <engine_core/profiler.hpp>
+
+#include "engine_test.hpp"
+
+namespace
+{
+// Runs func with the profiler of an engine, the zones of the engine recorded so far are drained
+template <typename TFunc>
+void runWithProfiler(TFunc &&func)
+{
+	argon::test::runEngine(argon::test::Scenario::None, 1u,
+		[&func](argon::SystemBase &system, argon::uint32)
+		{
+			argon::Profiler &profiler = system.get<argon::Profiler>();
+			profiler.endFrame();
+
+			func(profiler);
+		});
+}
+
+const argon::ProfileZoneStats* findStats(const argon::vector<argon::ProfileZoneStats> &stats, const char *name)
+{
+	const auto it = std::find_if(stats.begin(), stats.end(),
+		[name](const argon::ProfileZoneStats &zone) { return zone.m_name == name; });
+
+	return it != stats.end() ? &*it : nullptr;
+}
+
+std::string getTempPath(const char *filename)
+{
+	return (std::filesystem::temp_directory_path() / filename).string();
+}
+
+std::string readFile(const std::string &path)
+{
+	std::ifstream file(path);
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Checks the syntax of a JSON document and collects the values of the "name" members
+class JsonReader final
+{
+public:
+	explicit JsonReader(const std::string &text)
+		: m_text(text)
+		, m_position(0)
+	{
+	}
+
+	bool read(argon::vector<std::string> &names)
+	{
+		m_names = &names;
+
+		if (!_parseValue())
+		{
+			return false;
+		}
+
+		_skipSpace();
+		return m_position == m_text.size();
+	}
+
+private:
+	bool _parseValue()
+	{
+		_skipSpace();
+		if (m_position == m_text.size())
+		{
+			return false;
+		}
+
+		const char c = m_text[m_position];
+		if (c == '{')
+		{
+			return _parseObject();
+		}
+		if (c == '[')
+		{
+			return _parseArray();
+		}
+		if (c == '"')
+		{
+			std::string str;
+			return _parseString(str);
+		}
+		if (c == '-' || std::isdigit(static_cast<unsigned char>(c)))
+		{
+			return _parseNumber();
+		}
+
+		return _parseLiteral("true") || _parseLiteral("false") || _parseLiteral("null");
+	}
+
+	bool _parseObject()
+	{
+		++m_position;
+		if (_consume('}'))
+		{
+			return true;
+		}
+
+		do
+		{
+			_skipSpace();
+
+			std::string key;
+			if (!_parseString(key) || !_consume(':'))
+			{
+				return false;
+			}
+
+			if (key == "name")
+			{
+				_skipSpace();
+
+				std::string value;
+				if (!_parseString(value))
+				{
+					return false;
+				}
+
+				m_names->push_back(value);
+			}
+			else if (!_parseValue())
+			{
+				return false;
+			}
+		}
+		while (_consume(','));
+
+		return _consume('}');
+	}
+
+	bool _parseArray()
+	{
+		++m_position;
+		if (_consume(']'))
+		{
+			return true;
+		}
+
+		do
+		{
+			if (!_parseValue())
+			{
+				return false;
+			}
+		}
+		while (_consume(','));
+
+		return _consume(']');
+	}
+
+	bool _parseString(std::string &out)
+	{
+		if (!_consume('"'))
+		{
+			return false;
+		}
+
+		while (m_position < m_text.size())
+		{
+			const char c = m_text[m_position++];
+
+			if (c == '"')
+			{
+				return true;
+			}
+			if (static_cast<unsigned char>(c) < 0x20u)
+			{
+				return false;
+			}
+			if (c != '\\')
+			{
+				out += c;
+				continue;
+			}
+			if (m_position == m_text.size())
+			{
+				return false;
+			}
+
+			const char escaped = m_text[m_position++];
+			const argon::sizet simple = std::string("\"\\/bfnrt").find(escaped);
+			if (simple != std::string::npos)
+			{
+				out += "\"\\/\b\f\n\r\t"[simple];
+			}
+			else if (escaped == 'u' && m_position + 4 <= m_text.size())
+			{
+				const std::string digits = m_text.substr(m_position, 4);
+				if (!std::all_of(digits.begin(), digits.end(), [](char d) { return std::isxdigit(static_cast<unsigned char>(d)); }))
+				{
+					return false;
+				}
+
+				// Only the codes of single bytes are expected
+				out += static_cast<char>(std::stoul(digits, nullptr, 16));
+				m_position += 4;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return false;
+	}
+
+	bool _parseNumber()
+	{
+		_consume('-');
+		if (!_parseDigits())
+		{
+			return false;
+		}
+
+		if (_consume('.') && !_parseDigits())
+		{
+			return false;
+		}
+
+		if (_consume('e') || _consume('E'))
+		{
+			if (!_consume('+'))
+			{
+				_consume('-');
+			}
+
+			return _parseDigits();
+		}
+
+		return true;
+	}
+
+	bool _parseDigits()
+	{
+		const argon::sizet start = m_position;
+		while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position])))
+		{
+			++m_position;
+		}
+
+		return m_position != start;
+	}
+
+	bool _parseLiteral(const std::string &literal)
+	{
+		if (m_text.compare(m_position, literal.size(), literal) != 0)
+		{
+			return false;
+		}
+
+		m_position += literal.size();
+		return true;
+	}
+
+	bool _consume(char c)
+	{
+		_skipSpace();
+		if (m_position < m_text.size() && m_text[m_position] == c)
+		{
+			++m_position;
+			return true;
+		}
+
+		return false;
+	}
+
+	void _skipSpace()
+	{
+		while (m_position < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_position])))
+		{
+			++m_position;
+		}
+	}
+
+	const std::string &m_text;
+	argon::sizet m_position;
+	argon::vector<std::string> *m_names = nullptr;
+};
+} // namespace
+
+TEST(Profiler, StatsWindow)
+{
+	constexpr argon::uint32 NUM_FRAMES = 200;
+	constexpr argon::uint32 CALLS_PER_FRAME = 2;
+	constexpr argon::uint32 FIRST_WINDOW_FRAME = NUM_FRAMES - argon::Profiler::NUM_WINDOW_FRAMES;
+
+	// Ticks of a call, the frames grow longer
+	const auto getTicks = [](argon::uint32 frame) { return 1000u + static_cast<argon::uint64>(frame); };
+	// Every eighth frame has no calls
+	const auto isCalled = [](argon::uint32 frame) { return frame % 8 != 7; };
+
+	runWithProfiler([&getTicks, &isCalled](argon::Profiler &profiler)
+	{
+		const char *name = profiler.registerName("test::window");
+		const char *old = profiler.registerName("test::old");
+		EXPECT_EQ(name, profiler.registerName("test::window")) << "Equal names should share the pointer";
+
+		profiler._record(old, 0u, 1u);
+		for (argon::uint32 frame = 0; frame < NUM_FRAMES; ++frame)
+		{
+			for (argon::uint32 i = 0; isCalled(frame) && i < CALLS_PER_FRAME; ++i)
+			{
+				profiler._record(name, 0u, getTicks(frame));
+			}
+
+			profiler.endFrame();
+		}
+
+		argon::uint64 sum = 0;
+		argon::uint64 numSamples = 0;
+		for (argon::uint32 frame = FIRST_WINDOW_FRAME; frame < NUM_FRAMES; ++frame)
+		{
+			if (isCalled(frame))
+			{
+				sum += getTicks(frame) * CALLS_PER_FRAME;
+				++numSamples;
+			}
+		}
+
+		// The samples grow with the frame, the nearest rank of the 99th percentile is the second largest
+		ASSERT_EQ(112u, numSamples);
+		const auto minTicks = static_cast<argon::float64>(getTicks(FIRST_WINDOW_FRAME) * CALLS_PER_FRAME);
+		const auto p99Ticks = static_cast<argon::float64>(getTicks(NUM_FRAMES - 3) * CALLS_PER_FRAME);
+		const argon::float64 averageTicks = static_cast<argon::float64>(sum) / static_cast<argon::float64>(numSamples);
+
+		const argon::vector<argon::ProfileZoneStats> stats = profiler.getStats();
+		EXPECT_EQ(nullptr, findStats(stats, old)) << "Zones without calls in the window should be skipped";
+
+		const argon::ProfileZoneStats *zone = findStats(stats, name);
+		ASSERT_NE(nullptr, zone);
+
+		// The ticks are converted by the same calibration, so their ratios are kept
+		EXPECT_GT(zone->m_minMs, 0.0) << "Frames without calls should be skipped";
+		EXPECT_NEAR(averageTicks / minTicks, zone->m_averageMs / zone->m_minMs, 1e-9);
+		EXPECT_NEAR(p99Ticks / minTicks, zone->m_p99Ms / zone->m_minMs, 1e-9);
+		EXPECT_DOUBLE_EQ(static_cast<argon::float64>(CALLS_PER_FRAME), zone->m_callsPerFrame);
+	});
+}
+
+TEST(Profiler, DroppedZones)
+{
+	constexpr argon::uint32 NUM_DROPPED = 100;
+
+	runWithProfiler([](argon::Profiler &profiler)
+	{
+		const char *name = profiler.registerName("test::dropped");
+		const std::string path = getTempPath("argon_profiler_test.txt");
+		ASSERT_TRUE(argon::debug::setLogFile(path));
+
+		for (argon::uint64 i = 0; i < argon::Profiler::MAX_THREAD_ZONES + NUM_DROPPED; ++i)
+		{
+			profiler._record(name, 0u, 1u);
+		}
+
+		profiler.endFrame();
+
+		argon::vector<argon::ProfileZoneStats> stats = profiler.getStats();
+		const argon::ProfileZoneStats *zone = findStats(stats, name);
+		ASSERT_NE(nullptr, zone);
+		EXPECT_DOUBLE_EQ(static_cast<argon::float64>(argon::Profiler::MAX_THREAD_ZONES), zone->m_callsPerFrame)
+			<< "Zones above the capacity should be dropped";
+
+		// The ring is usable after the drop and the count is reported once
+		profiler._record(name, 0u, 1u);
+		profiler.endFrame();
+
+		argon::debug::flushLog();
+		const std::string log = readFile(path);
+		argon::debug::setLogFile("");
+		std::remove(path.c_str());
+
+		const std::string message = "Profiler dropped " + std::to_string(NUM_DROPPED) + " zones";
+		const argon::sizet position = log.find(message);
+		EXPECT_NE(std::string::npos, position) << log;
+		EXPECT_EQ(std::string::npos, log.find("Profiler dropped", position + 1)) << log;
+
+		stats = profiler.getStats();
+		zone = findStats(stats, name);
+		ASSERT_NE(nullptr, zone);
+		EXPECT_DOUBLE_EQ(static_cast<argon::float64>(argon::Profiler::MAX_THREAD_ZONES + 1) / 2.0, zone->m_callsPerFrame);
+	});
+}
+
+TEST(Profiler, ChromeTrace)
+{
+	const std::string quotedName = "test::\"quoted\" \\zone";
+	const std::string controlName = "test::line\nbreak\t";
+
+	runWithProfiler([&quotedName, &controlName](argon::Profiler &profiler)
+	{
+		const char *quoted = profiler.registerName(quotedName);
+		const char *control = profiler.registerName(controlName);
+
+		profiler.startCapture();
+		EXPECT_TRUE(profiler.isCapturing());
+		{
+			const argon::ProfileZone zone(profiler, quoted);
+			const argon::ProfileZone inner(profiler, control);
+		}
+		{
+			const argon::ProfileZone zone(profiler, quoted);
+		}
+		profiler.endFrame();
+		profiler.stopCapture();
+
+		// Not kept after the capture
+		{
+			const argon::ProfileZone zone(profiler, quoted);
+		}
+		profiler.endFrame();
+
+		const std::string path = getTempPath("argon_profiler_test.json");
+		ASSERT_TRUE(profiler.exportChromeTrace(path));
+		const std::string text = readFile(path);
+		std::remove(path.c_str());
+
+		argon::vector<std::string> names;
+		ASSERT_TRUE(JsonReader(text).read(names)) << text;
+		EXPECT_EQ(2, std::count(names.begin(), names.end(), quotedName)) << text;
+		EXPECT_EQ(1, std::count(names.begin(), names.end(), controlName)) << text;
+
+		EXPECT_FALSE(profiler.exportChromeTrace(getTempPath("argon_missing_directory/trace.json")));
+	});
+}
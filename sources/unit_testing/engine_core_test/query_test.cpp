@@ -0,0 +1,109 @@
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rttr/registration.h>
+
+#include <engine_core/entity_manager.hpp>
+#include <engine_core/reflection.hpp>
+
+#include "engine_test.hpp"
+
+namespace
+{
+constexpr argon::uint32 NUM_ENTITIES = 300;
+// Every such entity loses QueryB, so QueryB no longer shares the ordering with QueryA
+constexpr argon::uint32 ERASE_STEP = 5;
+
+struct QueryA
+{
+	argon::uint32 m_value = 0;
+};
+
+struct QueryB
+{
+	argon::uint32 m_value = 0;
+};
+
+// Assigned to every third entity, so it drives the queries it is part of
+struct QueryC
+{
+	argon::uint32 m_value = 0;
+};
+
+// Expects the iterator to visit the same entities with the same components as each
+template <typename ...TComponents>
+void expectIteration(argon::EntityManager &entityManager, argon::uint32 expectedCount,
+	const std::vector<argon::Entity> &entities)
+{
+	auto query = entityManager.query<TComponents...>();
+
+	std::vector<argon::Entity> visited;
+	query.each([&visited](argon::Entity e, TComponents&...) { visited.push_back(e); });
+	ASSERT_EQ(expectedCount, visited.size());
+
+	argon::sizet index = 0;
+	for (auto it = query.begin(); it != query.end(); ++it, ++index)
+	{
+		ASSERT_LT(index, visited.size());
+		EXPECT_EQ(visited[index], it.getEntity());
+
+		// Every component holds the index of its entity
+		std::apply([&](const auto &...components)
+		{
+			EXPECT_TRUE(((entities[components.m_value] == it.getEntity()) && ...))
+				<< "Iterator resolved a component of another entity at " << index;
+		}, *it);
+	}
+
+	EXPECT_EQ(visited.size(), index);
+}
+} // namespace
+
+RTTR_REGISTRATION
+{
+	argon::reflection::Component<QueryA>("test::QueryA");
+	argon::reflection::Component<QueryB>("test::QueryB");
+	argon::reflection::Component<QueryC>("test::QueryC");
+}
+
+TEST(Query, IteratorMatchesEach)
+{
+	argon::test::runEngine(argon::test::Scenario::None, 1u, [](argon::SystemBase &system, argon::uint32)
+	{
+		argon::EntityManager &entityManager = system.getEntityManager();
+
+		std::vector<argon::Entity> entities;
+		for (argon::uint32 i = 0; i < NUM_ENTITIES; ++i)
+		{
+			entities.push_back(entityManager.createEntity());
+			entityManager.assign<QueryA>(entities.back(), QueryA{i});
+			entityManager.assign<QueryB>(entities.back(), QueryB{i});
+			if (i % 3 == 0)
+			{
+				entityManager.assign<QueryC>(entities.back(), QueryC{i});
+			}
+		}
+
+		// QueryB is indexed like the driver
+		expectIteration<QueryA, const QueryB>(entityManager, NUM_ENTITIES, entities);
+		// Both are resolved through the slots of QueryC
+		expectIteration<QueryA, QueryB, const QueryC>(entityManager, NUM_ENTITIES / 3, entities);
+
+		argon::uint32 numErased = 0;
+		for (argon::uint32 i = 0; i < NUM_ENTITIES; i += ERASE_STEP)
+		{
+			entityManager.erase<QueryB>(entities[i]);
+			++numErased;
+		}
+
+		// The erasures reorder QueryB, which drives now
+		expectIteration<const QueryA, QueryB>(entityManager, NUM_ENTITIES - numErased, entities);
+
+		for (argon::Entity e : entities)
+		{
+			entityManager.destroyEntity(e);
+		}
+	});
+}
@@ -0,0 +1,331 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <rttr/registration.h>
+
+#include <engine_core/entity_manager.hpp>
+#include <engine_core/reflection.hpp>
+#include <engine_core/system.hpp>
+
+#include "engine_test.hpp"
+
+namespace
+{
+using argon::test::Scenario;
+
+constexpr argon::uint32 NUM_FRAMES = 8;
+
+struct ScheduledValue
+{
+	argon::uint32 m_value = 0;
+};
+
+struct OtherValue
+{
+	argon::uint32 m_value = 0;
+};
+
+constexpr argon::uint32 WRITER = 0;
+constexpr argon::uint32 FIRST_READER = 1;
+constexpr argon::uint32 SECOND_READER = 2;
+constexpr argon::uint32 OTHER_WRITER = 3;
+constexpr argon::uint32 EXCLUSIVE = 4;
+constexpr argon::uint32 NUM_SCHEDULED_SYSTEMS = 5;
+
+struct ScheduleLog
+{
+	std::atomic<argon::uint32> m_sequence{0};
+	std::atomic<argon::uint32> m_running{0};
+	std::atomic<argon::uint32> m_writers{0};
+	std::atomic<argon::uint32> m_readers{0};
+	std::atomic<argon::uint32> m_exclusive{0};
+	std::atomic<argon::uint32> m_violations{0};
+	// Sequence number of the start of every tick
+	std::array<std::array<argon::uint32, NUM_FRAMES>, NUM_SCHEDULED_SYSTEMS> m_starts{};
+	// ScheduledValue seen by the readers
+	std::array<std::array<argon::uint32, NUM_FRAMES>, NUM_SCHEDULED_SYSTEMS> m_values{};
+};
+
+ScheduleLog s_log;
+
+template <argon::uint32 SYSTEM>
+class ScheduleSystem final
+	: public argon::SystemBase
+{
+public:
+	ScheduleSystem(ConstructionData &&data)
+		: argon::SystemBase(std::move(data))
+		, m_frame(0)
+	{
+	}
+
+	void initialize()
+	{
+		if (SYSTEM == WRITER && argon::test::getScenario() == Scenario::Schedule)
+		{
+			argon::EntityManager &entityManager = getEntityManager();
+			const argon::Entity e = entityManager.createEntity();
+			entityManager.assign<ScheduledValue>(e);
+			entityManager.assign<OtherValue>(e);
+		}
+	}
+
+	void finalize() {}
+
+	void tick()
+	{
+		if (argon::test::getScenario() != Scenario::Schedule)
+		{
+			return;
+		}
+
+		_enter();
+
+		// Widens the window for the overlaps
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+		argon::EntityManager &entityManager = getEntityManager();
+		if constexpr (SYSTEM == WRITER)
+		{
+			entityManager.query<ScheduledValue>().each([](ScheduledValue &value) { ++value.m_value; });
+		}
+		else if constexpr (SYSTEM == FIRST_READER || SYSTEM == SECOND_READER)
+		{
+			entityManager.query<const ScheduledValue>().each([this](const ScheduledValue &value)
+			{
+				s_log.m_values[SYSTEM][m_frame] = value.m_value;
+			});
+		}
+		else if constexpr (SYSTEM == OTHER_WRITER)
+		{
+			entityManager.query<OtherValue>().each([](OtherValue &value) { ++value.m_value; });
+		}
+
+		_leave();
+		++m_frame;
+	}
+
+private:
+	void _enter()
+	{
+		s_log.m_starts[SYSTEM][m_frame] = s_log.m_sequence.fetch_add(1u);
+
+		// Every system registers itself first, so one of two overlapping systems sees the other
+		const bool overlaps = s_log.m_running.fetch_add(1u) != 0;
+		if (SYSTEM == EXCLUSIVE)
+		{
+			s_log.m_exclusive.fetch_add(1u);
+		}
+		else if (SYSTEM == WRITER)
+		{
+			s_log.m_writers.fetch_add(1u);
+		}
+		else if (SYSTEM != OTHER_WRITER)
+		{
+			s_log.m_readers.fetch_add(1u);
+		}
+
+		_check(SYSTEM == EXCLUSIVE && overlaps);
+	}
+
+	void _leave()
+	{
+		_check(false);
+
+		s_log.m_running.fetch_sub(1u);
+		if (SYSTEM == EXCLUSIVE)
+		{
+			s_log.m_exclusive.fetch_sub(1u);
+		}
+		else if (SYSTEM == WRITER)
+		{
+			s_log.m_writers.fetch_sub(1u);
+		}
+		else if (SYSTEM != OTHER_WRITER)
+		{
+			s_log.m_readers.fetch_sub(1u);
+		}
+	}
+
+	static void _check(bool overlaps)
+	{
+		const argon::uint32 writers = s_log.m_writers.load();
+		const argon::uint32 readers = s_log.m_readers.load();
+
+		if (overlaps
+			|| (SYSTEM != EXCLUSIVE && s_log.m_exclusive.load() != 0)
+			|| (SYSTEM == EXCLUSIVE && s_log.m_running.load() != 1)
+			|| (SYSTEM == WRITER && (writers != 1 || readers != 0))
+			|| ((SYSTEM == FIRST_READER || SYSTEM == SECOND_READER) && writers != 0))
+		{
+			s_log.m_violations.fetch_add(1u);
+		}
+	}
+
+	argon::uint32 m_frame;
+	AR_PAD(4);
+};
+
+using ScheduleWriter = ScheduleSystem<WRITER>;
+using ScheduleFirstReader = ScheduleSystem<FIRST_READER>;
+using ScheduleSecondReader = ScheduleSystem<SECOND_READER>;
+using ScheduleOtherWriter = ScheduleSystem<OTHER_WRITER>;
+using ScheduleExclusive = ScheduleSystem<EXCLUSIVE>;
+
+// Declares ScheduledValue as read only, but writes it, reads OtherValue or assigns a component
+class AccessViolationSystem final
+	: public argon::SystemBase
+{
+public:
+	AccessViolationSystem(ConstructionData &&data)
+		: argon::SystemBase(std::move(data))
+	{
+	}
+
+	void initialize()
+	{
+		if (argon::test::getScenario() == Scenario::AccessCheckGet)
+		{
+			m_entity = getEntityManager().createEntity();
+			getEntityManager().assign<OtherValue>(m_entity);
+		}
+	}
+
+	void finalize() {}
+
+	void tick()
+	{
+		argon::EntityManager &entityManager = getEntityManager();
+		const Scenario scenario = argon::test::getScenario();
+
+		if (scenario == Scenario::AccessCheck)
+		{
+			entityManager.query<ScheduledValue>().each([](ScheduledValue &value) { ++value.m_value; });
+		}
+		else if (scenario == Scenario::AccessCheckAssign)
+		{
+			entityManager.assign<ScheduledValue>(entityManager.createEntity());
+		}
+		else if (scenario == Scenario::AccessCheckGet)
+		{
+			++entityManager.get<OtherValue>(m_entity).m_value;
+		}
+	}
+
+private:
+	argon::Entity m_entity;
+};
+
+// Systems are scheduled in the order of rttr::type::get_types, see SystemManager::_createSystems
+argon::sizet getDiscoveryIndex(argon::uint32 system)
+{
+	const rttr::type types[] = {
+		rttr::type::get<ScheduleWriter>(),
+		rttr::type::get<ScheduleFirstReader>(),
+		rttr::type::get<ScheduleSecondReader>(),
+		rttr::type::get<ScheduleOtherWriter>(),
+		rttr::type::get<ScheduleExclusive>()};
+
+	argon::sizet index = 0;
+	for (const auto &type : rttr::type::get_types())
+	{
+		if (type == types[system])
+		{
+			break;
+		}
+
+		++index;
+	}
+
+	return index;
+}
+} // namespace
+
+RTTR_REGISTRATION
+{
+	argon::reflection::Component<ScheduledValue>("test::ScheduledValue");
+	argon::reflection::Component<OtherValue>("test::OtherValue");
+	argon::reflection::System<ScheduleWriter>("test::ScheduleWriter")
+		.writes<ScheduledValue>();
+	argon::reflection::System<ScheduleFirstReader>("test::ScheduleFirstReader")
+		.reads<ScheduledValue>();
+	argon::reflection::System<ScheduleSecondReader>("test::ScheduleSecondReader")
+		.reads<ScheduledValue>()
+		.writes<OtherValue>();
+	argon::reflection::System<ScheduleOtherWriter>("test::ScheduleOtherWriter")
+		.writes<OtherValue>();
+	argon::reflection::System<ScheduleExclusive>("test::ScheduleExclusive");
+	argon::reflection::System<AccessViolationSystem>("test::AccessViolationSystem")
+		.reads<ScheduledValue>();
+}
+
+TEST(SystemManager, ConflictingSystemsAreOrdered)
+{
+	argon::test::runEngine(Scenario::Schedule, NUM_FRAMES);
+
+	EXPECT_EQ(0u, s_log.m_violations.load())
+		<< "Conflicting systems or an exclusive one ran at the same time";
+
+	for (const argon::uint32 reader : {FIRST_READER, SECOND_READER})
+	{
+		// The earlier discovered system of a conflicting pair runs first
+		const bool writerFirst = getDiscoveryIndex(WRITER) < getDiscoveryIndex(reader);
+
+		for (argon::uint32 frame = 0; frame < NUM_FRAMES; ++frame)
+		{
+			EXPECT_EQ(writerFirst, s_log.m_starts[WRITER][frame] < s_log.m_starts[reader][frame])
+				<< "Order of the writer and the reader changes between the frames";
+			EXPECT_EQ(frame + (writerFirst ? 1u : 0u), s_log.m_values[reader][frame])
+				<< "Reader sees the value of the wrong frame";
+		}
+	}
+}
+
+TEST(SystemManager, ExclusiveSystemSplitsPhases)
+{
+	argon::test::runEngine(Scenario::Schedule, NUM_FRAMES);
+
+	EXPECT_EQ(0u, s_log.m_violations.load());
+
+	// Systems discovered before the exclusive one are in the previous phase
+	for (const argon::uint32 system : {WRITER, FIRST_READER, SECOND_READER, OTHER_WRITER})
+	{
+		const bool before = getDiscoveryIndex(system) < getDiscoveryIndex(EXCLUSIVE);
+
+		for (argon::uint32 frame = 0; frame < NUM_FRAMES; ++frame)
+		{
+			EXPECT_EQ(before, s_log.m_starts[system][frame] < s_log.m_starts[EXCLUSIVE][frame])
+				<< "Declared system crosses the exclusive one";
+		}
+	}
+}
+
+TEST(SystemManager, UndeclaredWriteIsFatal)
+{
+	// The engine runs in a new process, a forked child would miss the log thread
+	::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+	ASSERT_DEATH(argon::test::runEngine(Scenario::AccessCheck, 1u), "Assertion")
+		<< "Writing a component declared as read only should be fatal";
+}
+
+TEST(SystemManager, UndeclaredGetIsFatal)
+{
+	::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+	ASSERT_DEATH(argon::test::runEngine(Scenario::AccessCheckGet, 1u), "Assertion")
+		<< "Getting a component the system did not declare should be fatal";
+}
+
+TEST(SystemManager, StructuralChangeOfDeclaredSystemIsFatal)
+{
+	::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+	ASSERT_DEATH(argon::test::runEngine(Scenario::AccessCheckAssign, 1u), "Assertion")
+		<< "Declared systems should assign the components through the command buffer";
+}
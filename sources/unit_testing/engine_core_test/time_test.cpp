@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <engine_core/time.hpp>
+
+#include "engine_test.hpp"
+
+namespace
+{
+constexpr argon::float64 FIXED_STEP_RATE = 1000.0;
+constexpr argon::uint64 FIXED_STEP_NS = 1000000u;
+
+// Runs func with the clock of an engine, the rate is not limited and the delta is not scaled
+template <typename TFunc>
+void runWithTime(TFunc &&func)
+{
+	argon::test::runEngine(argon::test::Scenario::None, 1u,
+		[&func](argon::SystemBase &system, argon::uint32)
+		{
+			argon::Time &time = system.get<argon::Time>();
+			time.setTargetFrameRate(0.0);
+			time.setDeltaScale(1.f);
+			time.setFixedStepRate(FIXED_STEP_RATE);
+			time.restart();
+
+			func(time);
+		});
+}
+
+void sleep(argon::int32 milliseconds)
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
+
+// Expects the steps and the remainder after the last frame, returns the remainder in nanoseconds
+argon::uint64 expectSteps(argon::Time &time, argon::float64 scale, argon::uint64 carried = 0)
+{
+	const auto scaled = static_cast<argon::uint64>(static_cast<argon::float64>(time.getUnscaledDeltaNs()) * scale);
+	const argon::uint64 accumulated = std::min(carried + scaled, FIXED_STEP_NS * argon::Time::MAX_FIXED_STEPS);
+	const argon::uint64 remainder = accumulated % FIXED_STEP_NS;
+	const argon::float32 alpha = static_cast<argon::float32>(remainder) / static_cast<argon::float32>(FIXED_STEP_NS);
+
+	EXPECT_EQ(accumulated / FIXED_STEP_NS, time.consumeFixedSteps())
+		<< "Delta " << time.getUnscaledDeltaNs() << " ns, scale " << scale << ", carried " << carried << " ns";
+	EXPECT_NEAR(alpha, time.getFixedStepAlpha(), 1e-5f);
+
+	EXPECT_EQ(0u, time.consumeFixedSteps()) << "Steps should be consumed once";
+	EXPECT_NEAR(alpha, time.getFixedStepAlpha(), 1e-5f) << "Remainder should be kept";
+
+	return remainder;
+}
+} // namespace
+
+TEST(Time, FixedSteps)
+{
+	runWithTime([](argon::Time &time)
+	{
+		EXPECT_EQ(0u, time.consumeFixedSteps());
+		EXPECT_NEAR(1e-3f, time.getFixedDelta(), 1e-9f);
+
+		sleep(3);
+		time.endFrame();
+		const argon::uint64 remainder = expectSteps(time, 1.0);
+
+		// The remainder of the previous frame is carried over
+		sleep(2);
+		time.endFrame();
+		expectSteps(time, 1.0, remainder);
+	});
+}
+
+TEST(Time, MaxFixedSteps)
+{
+	runWithTime([](argon::Time &time)
+	{
+		// Many times the steps of the limit
+		sleep(30);
+		time.endFrame();
+
+		EXPECT_GT(time.getUnscaledDeltaNs(), FIXED_STEP_NS * argon::Time::MAX_FIXED_STEPS);
+		EXPECT_EQ(argon::Time::MAX_FIXED_STEPS, time.consumeFixedSteps())
+			<< "Steps above the limit should be dropped";
+		EXPECT_FLOAT_EQ(0.f, time.getFixedStepAlpha()) << "Dropped time should not be carried over";
+	});
+}
+
+TEST(Time, UnlimitedFrameRate)
+{
+	constexpr argon::uint32 NUM_FRAMES = 100;
+
+	runWithTime([](argon::Time &time)
+	{
+		EXPECT_EQ(0.0, time.getTargetFrameRate());
+
+		// Limited to 500 frames per second, the frames would take 200 ms
+		const auto start = std::chrono::steady_clock::now();
+		for (argon::uint32 i = 0; i < NUM_FRAMES; ++i)
+		{
+			time.endFrame();
+		}
+
+		EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100))
+			<< "Frames should not wait without a target rate";
+
+		time.setTargetFrameRate(100.0);
+		EXPECT_NEAR(100.0, time.getTargetFrameRate(), 1e-6);
+
+		time.endFrame();
+		EXPECT_GE(time.getUnscaledDeltaNs(), 10000000u) << "Frame should wait for the period of the rate";
+	});
+}
+
+TEST(Time, DeltaScale)
+{
+	runWithTime([](argon::Time &time)
+	{
+		time.setDeltaScale(0.f);
+		sleep(3);
+		time.endFrame();
+
+		EXPECT_GT(time.getUnscaledDelta(), 0.f);
+		EXPECT_FLOAT_EQ(0.f, time.getDelta());
+		expectSteps(time, 0.0);
+
+		time.setDeltaScale(0.5f);
+		sleep(5);
+		time.endFrame();
+
+		EXPECT_NEAR(time.getUnscaledDelta() * 0.5f, time.getDelta(), 1e-6f);
+		expectSteps(time, 0.5);
+	});
+}
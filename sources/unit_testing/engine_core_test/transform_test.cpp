@@ -0,0 +1,272 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <engine_core/entity_manager.hpp>
+#include <engine_core/transform.hpp>
+
+#include <math/matrix4.hpp>
+#include <math/quaternion.hpp>
+#include <math/vector3.hpp>
+
+#include "engine_test.hpp"
+
+namespace
+{
+using argon::test::Scenario;
+
+// Every change is checked two frames later, TransformSystem runs at least once in between
+// and the new WorldTransforms are played back after it
+constexpr argon::uint32 STEP = 2;
+// Changes are tracked per block of transforms, see Changed
+constexpr argon::uint32 BLOCK_SIZE = argon::SparseStorage<argon::Transform>::VERSION_BLOCK_SIZE;
+
+argon::math::Matrix4 getLocal(const argon::Transform &transform)
+{
+	argon::math::Matrix4 local;
+	local.setTransformation(transform.m_rotation, transform.m_scaling, transform.m_translation);
+	return local;
+}
+
+argon::math::Matrix4 multiply(const argon::math::Matrix4 &lhs, const argon::math::Matrix4 &rhs)
+{
+	argon::math::Matrix4 result;
+	for (argon::int32 row = 0; row < 4; ++row)
+	{
+		for (argon::int32 column = 0; column < 4; ++column)
+		{
+			argon::float32 sum = 0.f;
+			for (argon::int32 i = 0; i < 4; ++i)
+			{
+				sum += lhs[row][i] * rhs[i][column];
+			}
+
+			result[row][column] = sum;
+		}
+	}
+
+	return result;
+}
+
+// Scalar composition of the local transforms up to the first entity without a Transform
+argon::math::Matrix4 getReference(argon::EntityManager &entityManager, const argon::Entity &e)
+{
+	const argon::Transform &transform = entityManager.get<argon::Transform>(e);
+	const argon::Entity &parent = transform.m_parent;
+
+	if (!entityManager.isValid(parent) || !entityManager.has<argon::Transform>(parent))
+	{
+		return getLocal(transform);
+	}
+
+	return multiply(getReference(entityManager, parent), getLocal(transform));
+}
+
+bool isNear(const argon::math::Matrix4 &lhs, const argon::math::Matrix4 &rhs)
+{
+	for (argon::int32 row = 0; row < 4; ++row)
+	{
+		for (argon::int32 column = 0; column < 4; ++column)
+		{
+			if (std::abs(lhs[row][column] - rhs[row][column]) > 1e-4f)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void expectNear(const argon::math::Matrix4 &expected, const argon::math::Matrix4 &actual)
+{
+	for (argon::int32 row = 0; row < 4; ++row)
+	{
+		for (argon::int32 column = 0; column < 4; ++column)
+		{
+			EXPECT_NEAR(expected[row][column], actual[row][column], 1e-4f)
+				<< "Element " << row << ", " << column;
+		}
+	}
+}
+
+void expectWorld(argon::EntityManager &entityManager, const argon::Entity &e)
+{
+	ASSERT_TRUE(entityManager.has<argon::WorldTransform>(e));
+	expectNear(getReference(entityManager, e), entityManager.get<argon::WorldTransform>(e).m_matrix);
+}
+
+void assignNode(argon::EntityManager &entityManager, const argon::Entity &e, argon::float32 seed,
+	const argon::Entity &parent = argon::Entity())
+{
+	argon::Transform &transform = entityManager.assign<argon::Transform>(e);
+
+	transform.m_rotation = argon::math::Quaternion(
+		argon::math::Vector3(0.f, 1.f, 0.f), 0.3f * seed);
+	transform.m_scaling = argon::math::Vector3(1.f + 0.1f * seed, 1.f, 1.f - 0.05f * seed);
+	transform.m_translation = argon::math::Vector3(seed, -2.f * seed, 0.5f);
+	transform.m_parent = parent;
+}
+
+argon::Entity createNode(argon::EntityManager &entityManager, argon::float32 seed,
+	const argon::Entity &parent = argon::Entity())
+{
+	const argon::Entity e = entityManager.createEntity();
+	assignNode(entityManager, e, seed, parent);
+	return e;
+}
+} // namespace
+
+TEST(TransformSystem, Hierarchy)
+{
+	const argon::math::Matrix4 sentinel(
+		7.f, 0.f, 0.f, 1.f,
+		0.f, 7.f, 0.f, 2.f,
+		0.f, 0.f, 7.f, 3.f,
+		0.f, 0.f, 0.f, 1.f);
+
+	argon::Entity root, first, second, third, other, otherChild, added;
+	argon::uint32 checks = 0;
+
+	argon::test::runEngine(Scenario::Transform, STEP * 4 + 1,
+		[&](argon::SystemBase &system, argon::uint32 frame)
+	{
+		argon::EntityManager &entityManager = system.getEntityManager();
+
+		switch (frame)
+		{
+		case 0:
+			// Children get their transforms before the parents, only the depth sort orders them
+			third = entityManager.createEntity();
+			second = entityManager.createEntity();
+			first = entityManager.createEntity();
+			root = entityManager.createEntity();
+			assignNode(entityManager, third, 4.f, second);
+			assignNode(entityManager, second, 3.f, first);
+			assignNode(entityManager, first, 2.f, root);
+			assignNode(entityManager, root, 1.f);
+
+			// The other subtree is in the next block of transforms
+			for (argon::uint32 i = 0; i < BLOCK_SIZE; ++i)
+			{
+				createNode(entityManager, 0.f);
+			}
+
+			other = createNode(entityManager, 5.f);
+			otherChild = createNode(entityManager, 6.f, other);
+			break;
+
+		case STEP:
+			// EntityManager::get marks the transforms as changed, the other block is not read here
+			for (const argon::Entity &e : {root, first, second, third})
+			{
+				expectWorld(entityManager, e);
+			}
+
+			// Only the subtree of the changed transform is recomputed
+			for (const argon::Entity &e : {other, otherChild})
+			{
+				entityManager.get<argon::WorldTransform>(e).m_matrix = sentinel;
+			}
+
+			entityManager.get<argon::Transform>(first).m_translation = argon::math::Vector3(-3.f, 4.f, 1.f);
+			++checks;
+			break;
+
+		case STEP * 2:
+			for (const argon::Entity &e : {first, second, third})
+			{
+				expectWorld(entityManager, e);
+			}
+
+			for (const argon::Entity &e : {other, otherChild})
+			{
+				EXPECT_TRUE(entityManager.get<argon::WorldTransform>(e).m_matrix == sentinel)
+					<< "Transform outside of the changed subtree was recomputed";
+			}
+
+			// Moves the subtree below the other root
+			entityManager.get<argon::Transform>(second).m_parent = other;
+			++checks;
+			break;
+
+		case STEP * 3:
+			for (const argon::Entity &e : {root, first, second, third, other, otherChild})
+			{
+				expectWorld(entityManager, e);
+			}
+
+			// The child of the entity without a Transform is placed in the world
+			entityManager.erase<argon::Transform>(second);
+			added = createNode(entityManager, 7.f, first);
+			++checks;
+			break;
+
+		case STEP * 4:
+			for (const argon::Entity &e : {root, first, third, other, otherChild, added})
+			{
+				expectWorld(entityManager, e);
+			}
+
+			expectNear(getLocal(entityManager.get<argon::Transform>(third)),
+				entityManager.get<argon::WorldTransform>(third).m_matrix);
+			++checks;
+			break;
+
+		default:
+			break;
+		}
+	});
+
+	EXPECT_EQ(4u, checks);
+}
+
+TEST(TransformSystem, CycleIsDetached)
+{
+	argon::Entity first, second, child;
+	argon::uint32 checks = 0;
+
+	argon::test::runEngine(Scenario::Transform, STEP + 1,
+		[&](argon::SystemBase &system, argon::uint32 frame)
+	{
+		argon::EntityManager &entityManager = system.getEntityManager();
+
+		if (frame == 0)
+		{
+			first = createNode(entityManager, 1.f);
+			second = createNode(entityManager, 2.f, first);
+			child = createNode(entityManager, 3.f, second);
+			entityManager.get<argon::Transform>(first).m_parent = second;
+		}
+		else if (frame == STEP)
+		{
+			for (const argon::Entity &e : {first, second, child})
+			{
+				ASSERT_TRUE(entityManager.has<argon::WorldTransform>(e));
+			}
+
+			// One entity of the cycle becomes a root, the rest is composed as usual
+			const argon::math::Matrix4 &firstWorld = entityManager.get<argon::WorldTransform>(first).m_matrix;
+			const argon::math::Matrix4 &secondWorld = entityManager.get<argon::WorldTransform>(second).m_matrix;
+			const argon::math::Matrix4 firstLocal = getLocal(entityManager.get<argon::Transform>(first));
+			const argon::math::Matrix4 secondLocal = getLocal(entityManager.get<argon::Transform>(second));
+
+			if (isNear(firstLocal, firstWorld))
+			{
+				expectNear(firstLocal, firstWorld);
+				expectNear(multiply(firstWorld, secondLocal), secondWorld);
+			}
+			else
+			{
+				expectNear(secondLocal, secondWorld);
+				expectNear(multiply(secondWorld, firstLocal), firstWorld);
+			}
+
+			expectNear(multiply(secondWorld, getLocal(entityManager.get<argon::Transform>(child))),
+				entityManager.get<argon::WorldTransform>(child).m_matrix);
+			++checks;
+		}
+	});
+
+	EXPECT_EQ(1u, checks);
+}
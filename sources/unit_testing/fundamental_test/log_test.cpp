@@ -0,0 +1,203 @@
+// The trace and status messages of this file are stripped at compile time
+#define AR_LOG_MIN_LEVEL 2
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fundamental/log.hpp>
+
+namespace
+{
+// Writes the log into a file while the capture exists
+class LogCapture final
+{
+public:
+	LogCapture()
+		: m_path((std::filesystem::temp_directory_path() / "argon_log_test.txt").string())
+	{
+		EXPECT_TRUE(argon::debug::setLogFile(m_path));
+	}
+
+	~LogCapture()
+	{
+		argon::debug::setLogFile("");
+		std::remove(m_path.c_str());
+	}
+
+	// Parts of the written lines which follow the tag
+	std::vector<std::string> getMessages(const std::string &tag) const
+	{
+		argon::debug::flushLog();
+
+		std::vector<std::string> messages;
+		std::ifstream file(m_path);
+		for (std::string line; std::getline(file, line);)
+		{
+			const argon::sizet position = line.find(tag);
+			if (position != std::string::npos)
+			{
+				messages.push_back(line.substr(position + tag.size()));
+			}
+		}
+
+		return messages;
+	}
+
+private:
+	std::string m_path;
+};
+
+// Logs from the destructor, which runs after the ring of the thread is handed back
+struct LateLogger
+{
+	~LateLogger()
+	{
+		AR_LOG_WARNING("log_test late ", m_value);
+	}
+
+	argon::int32 m_value = 0;
+};
+
+thread_local LateLogger s_lateLogger;
+} // namespace
+
+TEST(Log, Ordering)
+{
+	constexpr argon::uint32 NUM_THREADS = 4;
+	// The rings wrap around and fill up several times
+	constexpr argon::uint32 NUM_MESSAGES = 5000;
+
+	LogCapture capture;
+
+	std::vector<std::thread> threads;
+	for (argon::uint32 i = 0; i < NUM_THREADS; ++i)
+	{
+		threads.emplace_back([i]()
+		{
+			for (argon::uint32 j = 0; j < NUM_MESSAGES; ++j)
+			{
+				AR_LOG_WARNING("log_test order ", i, " ", j);
+			}
+		});
+	}
+
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+
+	std::vector<argon::uint32> next(NUM_THREADS, 0u);
+	for (const std::string &message : capture.getMessages("log_test order "))
+	{
+		argon::uint32 thread;
+		argon::uint32 index;
+		ASSERT_EQ(2, std::sscanf(message.c_str(), "%u %u", &thread, &index)) << message;
+		ASSERT_LT(thread, NUM_THREADS);
+		ASSERT_EQ(next[thread], index) << "Messages of thread " << thread << " are out of order";
+		++next[thread];
+	}
+
+	for (argon::uint32 i = 0; i < NUM_THREADS; ++i)
+	{
+		EXPECT_EQ(NUM_MESSAGES, next[i]) << "Messages of thread " << i << " are missing";
+	}
+}
+
+TEST(Log, ExitingThread)
+{
+	LogCapture capture;
+
+	std::thread([]()
+	{
+		// Constructed before the ring of the thread, so it is destroyed after the ring is handed back
+		s_lateLogger.m_value = 2;
+		AR_LOG_WARNING("log_test late ", 1);
+	}).join();
+
+	const std::vector<std::string> messages = capture.getMessages("log_test late ");
+	ASSERT_EQ(2u, messages.size());
+	EXPECT_EQ("1", messages[0]);
+	EXPECT_EQ("2", messages[1]) << "Message of the exiting thread should follow its earlier ones";
+}
+
+TEST(Log, Truncation)
+{
+	constexpr argon::sizet NUM_STRINGS = 6;
+	const char letters[NUM_STRINGS] = {'a', 'b', 'c', 'd', 'e', 'f'};
+
+	std::vector<std::string> strings;
+	for (const char letter : letters)
+	{
+		strings.emplace_back(argon::debug::MAX_LOG_STRING_LENGTH * 2, letter);
+	}
+
+	LogCapture capture;
+	AR_LOG_WARNING("log_test truncated ", strings[0], strings[1], strings[2], strings[3], strings[4],
+		strings[5], 42);
+	AR_LOG_WARNING("log_test after ", 7);
+
+	const std::vector<std::string> messages = capture.getMessages("log_test truncated ");
+	ASSERT_EQ(1u, messages.size());
+	const std::string &message = messages[0];
+
+	EXPECT_LE(message.size(), argon::debug::MAX_LOG_RECORD_SIZE);
+	EXPECT_GT(message.size(), argon::debug::MAX_LOG_RECORD_SIZE - argon::debug::MAX_LOG_STRING_LENGTH)
+		<< "Record should be filled up to the limit";
+	EXPECT_EQ(std::string::npos, message.find("42")) << "Arguments past the limit should be dropped";
+
+	// Full strings, then a cut one, the rest is dropped
+	bool cut = false;
+	for (argon::sizet i = 0; i < NUM_STRINGS; ++i)
+	{
+		const auto count = static_cast<argon::sizet>(std::count(message.begin(), message.end(), letters[i]));
+		if (cut)
+		{
+			EXPECT_EQ(0u, count) << "String " << i;
+		}
+		else
+		{
+			EXPECT_LE(count, argon::debug::MAX_LOG_STRING_LENGTH) << "String " << i;
+			cut = count < argon::debug::MAX_LOG_STRING_LENGTH;
+		}
+	}
+
+	EXPECT_TRUE(cut);
+
+	const std::vector<std::string> after = capture.getMessages("log_test after ");
+	ASSERT_EQ(1u, after.size());
+	EXPECT_EQ("7", after[0]) << "Message after the truncated one is damaged";
+}
+
+TEST(Log, LevelStripping)
+{
+	argon::int32 evaluated = 0;
+	const auto evaluate = [&evaluated]() { return ++evaluated; };
+
+	LogCapture capture;
+	AR_LOG_TRACE("log_test stripped ", evaluate());
+	AR_LOG_STATUS("log_test stripped ", evaluate());
+	EXPECT_EQ(0, evaluated) << "Arguments of the stripped messages should not be evaluated";
+
+	const argon::debug::LogLevel level = argon::debug::getLogLevel();
+	argon::debug::setLogLevel(argon::debug::LogLevel::Error);
+	AR_LOG_WARNING("log_test skipped ", evaluate());
+	AR_LOG_ERROR("log_test kept ", evaluate());
+	argon::debug::setLogLevel(level);
+	AR_LOG_WARNING("log_test kept ", evaluate());
+
+	EXPECT_TRUE(capture.getMessages("log_test stripped ").empty());
+	EXPECT_TRUE(capture.getMessages("log_test skipped ").empty())
+		<< "Messages below the runtime level should be skipped";
+
+	const std::vector<std::string> kept = capture.getMessages("log_test kept ");
+	ASSERT_EQ(2u, kept.size());
+	EXPECT_EQ("2", kept[0]);
+	EXPECT_EQ("3", kept[1]);
+}
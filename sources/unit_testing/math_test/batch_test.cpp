@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <math/batch.hpp>
+#include <math/matrix4.hpp>
+#include <math/quaternion.hpp>
+#include <math/quaternion_x8.hpp>
+#include <math/vector3.hpp>
+#include <math/vector3x8.hpp>
+
+#include "math_test_utils.hpp"
+
+using argon::math::BatchKernels;
+using argon::test::c_batchCounts;
+using argon::test::forEachKernels;
+
+TEST(Batch, SetKernels)
+{
+	const BatchKernels picked = argon::math::getBatchKernels();
+
+	EXPECT_TRUE(argon::math::setBatchKernels(BatchKernels::Fallback))
+		<< "Per-object kernels work everywhere";
+	EXPECT_EQ(BatchKernels::Fallback, argon::math::getBatchKernels());
+
+	EXPECT_TRUE(argon::math::setBatchKernels(picked)) << "Picked kernels are not supported";
+	EXPECT_EQ(picked, argon::math::getBatchKernels());
+}
+
+TEST(Batch, TransformPoints)
+{
+	argon::test::Random random;
+
+	forEachKernels([&random]()
+	{
+		for (const argon::sizet count : c_batchCounts)
+		{
+			const argon::math::Matrix4 m = random.getAffineMatrix4();
+			std::vector<argon::math::Vector3> src(count);
+			std::vector<argon::math::Vector3> dst(count);
+			for (auto &point : src)
+			{
+				point = random.getVector3();
+			}
+
+			argon::math::transformPoints(m, src.data(), dst.data(), count);
+			for (argon::sizet i = 0; i < count; ++i)
+			{
+				EXPECT_TRUE(argon::test::isNear(m * src[i], dst[i], 1e-5f))
+					<< "Point " << i << " of " << count;
+			}
+
+			// In place
+			argon::math::transformPoints(m, src.data(), src.data(), count);
+			for (argon::sizet i = 0; i < count; ++i)
+			{
+				EXPECT_TRUE(dst[i] == src[i]) << "Point " << i << " of " << count;
+			}
+		}
+	});
+}
+
+TEST(Batch, TransformPointsX8)
+{
+	argon::test::Random random;
+
+	forEachKernels([&random]()
+	{
+		for (const argon::sizet count : c_batchCounts)
+		{
+			const argon::math::Matrix4 m = random.getAffineMatrix4();
+			std::vector<argon::math::Vector3x8> src(count);
+			std::vector<argon::math::Vector3x8> dst(count);
+			for (auto &block : src)
+			{
+				for (argon::int32 lane = 0; lane < argon::math::Vector3x8::LANES; ++lane)
+				{
+					block.setLane(lane, random.getVector3());
+				}
+			}
+
+			argon::math::transformPoints(m, src.data(), dst.data(), count);
+			for (argon::sizet i = 0; i < count; ++i)
+			{
+				for (argon::int32 lane = 0; lane < argon::math::Vector3x8::LANES; ++lane)
+				{
+					EXPECT_TRUE(argon::test::isNear(m * src[i].getLane(lane), dst[i].getLane(lane), 1e-5f))
+						<< "Block " << i << ", lane " << lane;
+				}
+			}
+		}
+	});
+}
+
+TEST(Batch, MultiplyBatch)
+{
+	argon::test::Random random;
+
+	forEachKernels([&random]()
+	{
+		for (const argon::sizet count : c_batchCounts)
+		{
+			std::vector<argon::math::Matrix4> lhs(count);
+			std::vector<argon::math::Matrix4> rhs(count);
+			std::vector<argon::math::Matrix4> dst(count);
+			for (argon::sizet i = 0; i < count; ++i)
+			{
+				lhs[i] = random.getMatrix4();
+				rhs[i] = random.getMatrix4();
+			}
+
+			argon::math::multiplyBatch(lhs.data(), rhs.data(), dst.data(), count);
+			for (argon::sizet i = 0; i < count; ++i)
+			{
+				EXPECT_TRUE(argon::test::isNear(lhs[i] * rhs[i], dst[i], 1e-5f))
+					<< "Matrix " << i << " of " << count;
+			}
+
+			// In place
+			argon::math::multiplyBatch(lhs.data(), rhs.data(), lhs.data(), count);
+			for (argon::sizet i = 0; i < count; ++i)
+			{
+				EXPECT_TRUE(dst[i] == lhs[i]) << "Matrix " << i << " of " << count;
+			}
+		}
+	});
+}
+
+TEST(Batch, SlerpBatch)
+{
+	argon::test::Random random;
+
+	// The special cases of Quaternion::slerp. The dot products are exact, so every kernel
+	// takes the same branch as the reference.
+	const argon::math::Quaternion identity(1.f, 0.f, 0.f, 0.f);
+	const argon::math::Quaternion special[][2] = {
+		// cos of the half angle is 1
+		{identity, identity},
+		// -1, the same rotation on the other side of the hypersphere
+		{identity, argon::math::Quaternion(-1.f, 0.f, 0.f, 0.f)},
+		// sin of the half angle is close to zero, the quaternions are averaged
+		{identity, argon::math::Quaternion(0.99999988f, 0.0004f, 0.f, 0.f)}};
+	constexpr argon::int32 NUM_SPECIAL = 3;
+
+	forEachKernels([&]()
+	{
+		for (const argon::sizet count : c_batchCounts)
+		{
+			std::vector<argon::math::QuaternionX8> from(count);
+			std::vector<argon::math::QuaternionX8> to(count);
+			std::vector<argon::math::QuaternionX8> dst(count);
+			for (argon::sizet i = 0; i < count; ++i)
+			{
+				for (argon::int32 lane = 0; lane < argon::math::QuaternionX8::LANES; ++lane)
+				{
+					const bool isSpecial = lane < NUM_SPECIAL;
+					from[i].setLane(lane, isSpecial ? special[lane][0] : random.getQuaternion());
+					to[i].setLane(lane, isSpecial ? special[lane][1] : random.getQuaternion());
+				}
+			}
+
+			for (const argon::float32 t : {0.f, 0.3f, 0.5f, 1.f})
+			{
+				argon::math::slerpBatch(from.data(), to.data(), t, dst.data(), count);
+
+				for (argon::sizet i = 0; i < count; ++i)
+				{
+					for (argon::int32 lane = 0; lane < argon::math::QuaternionX8::LANES; ++lane)
+					{
+						const argon::math::Quaternion expected =
+							from[i].getLane(lane).slerp(to[i].getLane(lane), t);
+
+						EXPECT_TRUE(argon::test::isNear(expected, dst[i].getLane(lane), 2e-5f))
+							<< "Block " << i << ", lane " << lane << ", t " << t;
+					}
+				}
+			}
+		}
+	});
+}
@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <math/batch.hpp>
+#include <math/bounds.hpp>
+#include <math/bounds_x8.hpp>
+#include <math/matrix4.hpp>
+#include <math/vector3.hpp>
+
+#include "math_test_utils.hpp"
+
+namespace
+{
+using argon::math::Frustum;
+
+constexpr argon::float32 WIDTH = 16.f;
+constexpr argon::float32 HEIGHT = 9.f;
+constexpr argon::float32 FOV = 1.f;
+constexpr argon::float32 NEAR_PLANE = 0.5f;
+constexpr argon::float32 FAR_PLANE = 50.f;
+constexpr argon::uint32 GUARD = 0xDEADBEEFu;
+
+argon::math::Matrix4 getProjection()
+{
+	argon::math::Matrix4 projection;
+	projection.setPerspectiveFovLH(WIDTH, HEIGHT, FOV, NEAR_PLANE, FAR_PLANE);
+	return projection;
+}
+
+argon::float32 getHalfHeight(argon::float32 depth)
+{
+	return depth * std::tan(FOV / 2.f);
+}
+
+argon::float32 getHalfWidth(argon::float32 depth)
+{
+	return getHalfHeight(depth) * WIDTH / HEIGHT;
+}
+
+void expectPlane(const Frustum &frustum, Frustum::Side side, const argon::math::Vector3 &normal,
+	argon::float32 d)
+{
+	const argon::math::Plane &plane = frustum.getPlane(side);
+	const argon::float32 length = normal.getLength();
+
+	EXPECT_TRUE(argon::test::isNear(normal * (1.f / length), plane.getNormal(), 1e-5f))
+		<< "Side " << static_cast<argon::int32>(side);
+	EXPECT_TRUE(argon::test::isNear(d / length, plane.getD(), 1e-5f))
+		<< "Side " << static_cast<argon::int32>(side) << ", d is " << plane.getD();
+}
+
+// Bounds of the frustum of getProjection with a known visibility
+class Generator final
+{
+public:
+	enum class Placement : argon::uint32
+	{
+		Inside = 0,
+		Outside,
+		// The center is on one of the planes
+		Straddling
+	};
+
+	Placement getPlacement()
+	{
+		return static_cast<Placement>(static_cast<argon::uint32>(m_random.getFloat(0.f, 2.999f)));
+	}
+
+	argon::math::Vector3 getCenter(Placement placement)
+	{
+		const argon::float32 depth = m_random.getFloat(5.f, 40.f);
+		const argon::float32 x = getHalfWidth(depth);
+		const argon::float32 y = getHalfHeight(depth);
+
+		switch (placement)
+		{
+		case Placement::Inside:
+			return argon::math::Vector3(m_random.getFloat(-0.5f, 0.5f) * x,
+				m_random.getFloat(-0.5f, 0.5f) * y, depth);
+
+		case Placement::Outside:
+		{
+			// Further from the planes than any extent or radius
+			const argon::math::Vector3 outside[] = {
+				argon::math::Vector3(0.f, 0.f, -depth),
+				argon::math::Vector3(0.f, 0.f, FAR_PLANE + depth),
+				argon::math::Vector3(-x - 100.f, 0.f, depth),
+				argon::math::Vector3(x + 100.f, 0.f, depth),
+				argon::math::Vector3(0.f, -y - 100.f, depth),
+				argon::math::Vector3(0.f, y + 100.f, depth)};
+			return outside[getSide()];
+		}
+
+		case Placement::Straddling:
+		{
+			const argon::float32 u = m_random.getFloat(-0.5f, 0.5f);
+			const argon::math::Vector3 straddling[] = {
+				argon::math::Vector3(u * getHalfWidth(NEAR_PLANE), 0.f, NEAR_PLANE),
+				argon::math::Vector3(u * getHalfWidth(FAR_PLANE), 0.f, FAR_PLANE),
+				argon::math::Vector3(-x, u * y, depth),
+				argon::math::Vector3(x, u * y, depth),
+				argon::math::Vector3(u * x, -y, depth),
+				argon::math::Vector3(u * x, y, depth)};
+			return straddling[getSide()];
+		}
+		}
+
+		return argon::math::Vector3();
+	}
+
+	argon::math::Sphere getSphere(Placement placement)
+	{
+		return argon::math::Sphere(getCenter(placement), m_random.getFloat(0.5f, 2.f));
+	}
+
+	argon::math::Aabb getAabb(Placement placement)
+	{
+		const argon::math::Vector3 center = getCenter(placement);
+		const argon::math::Vector3 extents(m_random.getFloat(0.5f, 2.f),
+			m_random.getFloat(0.5f, 2.f), m_random.getFloat(0.5f, 2.f));
+
+		return argon::math::Aabb(center - extents, center + extents);
+	}
+
+private:
+	argon::int32 getSide()
+	{
+		return static_cast<argon::int32>(m_random.getFloat(0.f, Frustum::NUM_SIDES - 0.001f));
+	}
+
+	argon::test::Random m_random;
+};
+
+// Culls count bounds with every set of kernels and compares the indices with the placements.
+// The lanes past count hold visible bounds, the kernels have to mask them out.
+template <typename TBoundsX8, typename TMake, typename TCull>
+void checkCull(TMake &&make, TCull &&cull)
+{
+	const Frustum frustum(getProjection());
+	Generator generator;
+
+	for (const argon::sizet count : argon::test::c_batchCounts)
+	{
+		std::vector<TBoundsX8> blocks((count + TBoundsX8::LANES - 1) / TBoundsX8::LANES);
+		std::vector<argon::uint32> expected;
+
+		for (argon::sizet i = 0; i < blocks.size() * TBoundsX8::LANES; ++i)
+		{
+			const Generator::Placement placement = i < count
+				? generator.getPlacement()
+				: Generator::Placement::Inside;
+			const auto bounds = make(generator, placement);
+			const bool isVisible = placement != Generator::Placement::Outside;
+
+			ASSERT_EQ(isVisible, frustum.isVisible(bounds)) << "Bounds " << i;
+			if (isVisible && i < count)
+			{
+				expected.push_back(static_cast<argon::uint32>(i));
+			}
+
+			blocks[i / TBoundsX8::LANES].setLane(static_cast<argon::int32>(i % TBoundsX8::LANES), bounds);
+		}
+
+		argon::test::forEachKernels([&]()
+		{
+			std::vector<argon::uint32> visible(count + 1, GUARD);
+			const argon::sizet numVisible = cull(frustum, blocks.data(), count, visible.data());
+
+			ASSERT_EQ(expected.size(), numVisible) << "Count " << count;
+			for (argon::sizet i = 0; i < numVisible; ++i)
+			{
+				EXPECT_EQ(expected[i], visible[i]) << "Count " << count << ", visible " << i;
+			}
+
+			EXPECT_EQ(GUARD, visible[count]) << "Written past the indices of the bounds";
+		});
+	}
+}
+} // namespace
+
+TEST(Frustum, Planes)
+{
+	const argon::float32 yScale = 1.f / std::tan(FOV / 2.f);
+	const argon::float32 xScale = yScale * HEIGHT / WIDTH;
+	const Frustum frustum(getProjection());
+
+	// The normals point inside, the side planes pass through the eye
+	expectPlane(frustum, Frustum::Side::Left, argon::math::Vector3(xScale, 0.f, 1.f), 0.f);
+	expectPlane(frustum, Frustum::Side::Right, argon::math::Vector3(-xScale, 0.f, 1.f), 0.f);
+	expectPlane(frustum, Frustum::Side::Bottom, argon::math::Vector3(0.f, yScale, 1.f), 0.f);
+	expectPlane(frustum, Frustum::Side::Top, argon::math::Vector3(0.f, -yScale, 1.f), 0.f);
+	expectPlane(frustum, Frustum::Side::Near, argon::math::Vector3(0.f, 0.f, 1.f), -NEAR_PLANE);
+	expectPlane(frustum, Frustum::Side::Far, argon::math::Vector3(0.f, 0.f, -1.f), FAR_PLANE);
+}
+
+TEST(Frustum, PlanesOfViewProjection)
+{
+	argon::math::Matrix4 view;
+	view.setLookAtLH(argon::math::Vector3(1.f, 2.f, -10.f), argon::math::Vector3(0.f, 0.f, 0.f),
+		argon::math::Vector3(0.f, 1.f, 0.f));
+	const argon::math::Matrix4 viewToWorld = view.getInvertedOrthonormal();
+	const Frustum frustum(getProjection() * view);
+
+	for (argon::int32 i = 0; i < Frustum::NUM_SIDES; ++i)
+	{
+		EXPECT_NEAR(1.f, frustum.getPlane(static_cast<Frustum::Side>(i)).getNormal().getLength(), 1e-5f)
+			<< "Side " << i;
+	}
+
+	// Every corner is on its three planes and inside the others
+	for (const bool isFar : {false, true})
+	{
+		const argon::float32 depth = isFar ? FAR_PLANE : NEAR_PLANE;
+
+		for (const argon::float32 x : {-1.f, 1.f})
+		{
+			for (const argon::float32 y : {-1.f, 1.f})
+			{
+				const argon::math::Vector3 corner = viewToWorld * argon::math::Vector3(
+					x * getHalfWidth(depth), y * getHalfHeight(depth), depth);
+				const Frustum::Side sides[] = {
+					x < 0.f ? Frustum::Side::Left : Frustum::Side::Right,
+					y < 0.f ? Frustum::Side::Bottom : Frustum::Side::Top,
+					isFar ? Frustum::Side::Far : Frustum::Side::Near};
+
+				for (argon::int32 i = 0; i < Frustum::NUM_SIDES; ++i)
+				{
+					const Frustum::Side side = static_cast<Frustum::Side>(i);
+					const argon::float32 distance = frustum.getPlane(side).getSignedDistance(corner);
+
+					if (side == sides[0] || side == sides[1] || side == sides[2])
+					{
+						EXPECT_NEAR(0.f, distance, 1e-3f) << "Side " << i << ", depth " << depth;
+					}
+					else
+					{
+						EXPECT_GT(distance, 0.f) << "Side " << i << ", depth " << depth;
+					}
+				}
+			}
+		}
+	}
+
+	EXPECT_TRUE(frustum.isVisible(argon::math::Vector3(0.f, 0.f, 0.f))) << "The target is not visible";
+	EXPECT_FALSE(frustum.isVisible(argon::math::Vector3(1.f, 2.f, -12.f))) << "Behind the eye";
+}
+
+TEST(Frustum, CullSpheres)
+{
+	checkCull<argon::math::SphereX8>(
+		[](Generator &generator, Generator::Placement placement)
+	{
+		return generator.getSphere(placement);
+	}, &argon::math::cullSpheres);
+}
+
+TEST(Frustum, CullAabbs)
+{
+	checkCull<argon::math::AabbX8>(
+		[](Generator &generator, Generator::Placement placement)
+	{
+		return generator.getAabb(placement);
+	}, &argon::math::cullAabbs);
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cmath>
+#include <initializer_list>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <fundamental/types.hpp>
+
+#include <math/batch.hpp>
+#include <math/matrix4.hpp>
+#include <math/quaternion.hpp>
+#include <math/vector3.hpp>
+
+namespace argon::test
+{
+// The SIMD and scalar paths are selected at compile time, see ARGON_MATH_SIMD
+inline const char* getPathLabel()
+{
+#ifdef AR_SIMD
+	return "simd";
+#else
+	return "scalar";
+#endif // ifdef AR_SIMD
+}
+
+// Counts around the 8 wide blocks of the batch kernels
+inline constexpr sizet c_batchCounts[] = {0u, 1u, 7u, 8u, 9u, 100u, 1001u};
+
+inline const char* getKernelsName(math::BatchKernels kernels)
+{
+	switch (kernels)
+	{
+	case math::BatchKernels::Fallback:
+		return "fallback";
+	case math::BatchKernels::Avx:
+		return "avx";
+	case math::BatchKernels::Fma:
+		return "fma";
+	}
+
+	return "unknown";
+}
+
+// Runs the check with every set of batch kernels the processor supports and restores the picked one
+template <typename TFunc>
+void forEachKernels(TFunc &&check)
+{
+	const math::BatchKernels picked = math::getBatchKernels();
+	uint32 numChecked = 0;
+
+	for (const math::BatchKernels kernels :
+		{math::BatchKernels::Fallback, math::BatchKernels::Avx, math::BatchKernels::Fma})
+	{
+		if (!math::setBatchKernels(kernels))
+		{
+			continue;
+		}
+
+		SCOPED_TRACE(getKernelsName(kernels));
+		check();
+		++numChecked;
+	}
+
+	EXPECT_TRUE(math::setBatchKernels(picked));
+	EXPECT_NE(0u, numChecked);
+}
+
+// Fixed seed, so a failure is reproduced by every run
+class Random final
+{
+public:
+	Random() : m_generator(42u) {}
+
+	float32 getFloat(float32 min = -10.f, float32 max = 10.f)
+	{
+		return std::uniform_real_distribution<float32>(min, max)(m_generator);
+	}
+
+	math::Vector3 getVector3() { return math::Vector3(getFloat(), getFloat(), getFloat()); }
+
+	math::Quaternion getQuaternion()
+	{
+		return math::Quaternion(getVector3().getNormalized(), getFloat(-3.f, 3.f));
+	}
+
+	math::Matrix4 getMatrix4()
+	{
+		return math::Matrix4(
+			getFloat(), getFloat(), getFloat(), getFloat(),
+			getFloat(), getFloat(), getFloat(), getFloat(),
+			getFloat(), getFloat(), getFloat(), getFloat(),
+			getFloat(), getFloat(), getFloat(), getFloat());
+	}
+
+	math::Matrix4 getAffineMatrix4()
+	{
+		math::Matrix4 m;
+		m.setTransformation(getQuaternion(),
+			math::Vector3(getFloat(0.5f, 2.f), getFloat(0.5f, 2.f), getFloat(0.5f, 2.f)),
+			getVector3());
+		return m;
+	}
+
+	// Rotation and translation only
+	math::Matrix4 getRigidMatrix4()
+	{
+		math::Matrix4 m;
+		m.setTransformation(getQuaternion(), math::Vector3(1.f, 1.f, 1.f), getVector3());
+		return m;
+	}
+
+private:
+	std::mt19937 m_generator;
+};
+
+// Relative to the magnitude of the expected value, the SIMD and FMA paths round differently
+inline bool isNear(float32 expected, float32 actual, float32 tolerance)
+{
+	return std::abs(expected - actual) <= tolerance * (1.f + std::abs(expected));
+}
+
+inline ::testing::AssertionResult isNear(const math::Vector3 &expected, const math::Vector3 &actual,
+	float32 tolerance)
+{
+	for (int32 i = 0; i < 3; ++i)
+	{
+		if (!isNear(expected[i], actual[i], tolerance))
+		{
+			return ::testing::AssertionFailure() << "Element " << i << " is " << actual[i]
+				<< ", expected " << expected[i];
+		}
+	}
+
+	return ::testing::AssertionSuccess();
+}
+
+inline ::testing::AssertionResult isNear(const math::Quaternion &expected,
+	const math::Quaternion &actual, float32 tolerance)
+{
+	for (int32 i = 0; i < 4; ++i)
+	{
+		if (!isNear(expected[i], actual[i], tolerance))
+		{
+			return ::testing::AssertionFailure() << "Element " << i << " is " << actual[i]
+				<< ", expected " << expected[i];
+		}
+	}
+
+	return ::testing::AssertionSuccess();
+}
+
+inline ::testing::AssertionResult isNear(const math::Matrix4 &expected, const math::Matrix4 &actual,
+	float32 tolerance)
+{
+	for (int32 row = 0; row < 4; ++row)
+	{
+		for (int32 column = 0; column < 4; ++column)
+		{
+			if (!isNear(expected[row][column], actual[row][column], tolerance))
+			{
+				return ::testing::AssertionFailure() << "Element " << row << ", " << column << " is "
+					<< actual[row][column] << ", expected " << expected[row][column];
+			}
+		}
+	}
+
+	return ::testing::AssertionSuccess();
+}
+} // namespace argon::test
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <math/affine_transform.hpp>
+#include <math/matrix4.hpp>
+#include <math/quaternion.hpp>
+#include <math/vector3.hpp>
+#include <math/vector4.hpp>
+
+#include "math_test_utils.hpp"
+
+namespace
+{
+constexpr argon::int32 NUM_MATRICES = 200;
+
+// Scalar product, independent of the SIMD path under test
+argon::math::Matrix4 multiply(const argon::math::Matrix4 &lhs, const argon::math::Matrix4 &rhs)
+{
+	argon::math::Matrix4 result;
+	for (argon::int32 row = 0; row < 4; ++row)
+	{
+		for (argon::int32 column = 0; column < 4; ++column)
+		{
+			argon::float32 sum = 0.f;
+			for (argon::int32 i = 0; i < 4; ++i)
+			{
+				sum += lhs[row][i] * rhs[i][column];
+			}
+
+			result[row][column] = sum;
+		}
+	}
+
+	return result;
+}
+
+// Not affine and well conditioned, every cofactor contributes to the inverse
+argon::math::Matrix4 getGeneralMatrix4(argon::test::Random &random)
+{
+	argon::math::Matrix4 m = random.getMatrix4();
+	for (argon::int32 i = 0; i < 4; ++i)
+	{
+		m[i][i] += 40.f;
+	}
+
+	return m;
+}
+
+// Two scalings around different rotations, the 3x3 part is sheared
+argon::math::Matrix4 getShearedMatrix4(argon::test::Random &random)
+{
+	return multiply(random.getAffineMatrix4(), random.getAffineMatrix4());
+}
+} // namespace
+
+TEST(Matrix4, Inverted)
+{
+	argon::test::Random random;
+
+	// The scalar cofactors used to read wrong elements, a general matrix needs all of them
+	for (argon::int32 i = 0; i < NUM_MATRICES; ++i)
+	{
+		const argon::math::Matrix4 m = getGeneralMatrix4(random);
+		const argon::math::Matrix4 inverse = m.getInverted();
+
+		EXPECT_TRUE(argon::test::isNear(argon::math::Matrix4::c_identity, multiply(m, inverse), 1e-5f))
+			<< argon::test::getPathLabel() << ", matrix " << i;
+		EXPECT_TRUE(argon::test::isNear(argon::math::Matrix4::c_identity, multiply(inverse, m), 1e-5f))
+			<< argon::test::getPathLabel() << ", matrix " << i;
+	}
+}
+
+TEST(Matrix4, InvertedAffine)
+{
+	argon::test::Random random;
+
+	for (argon::int32 i = 0; i < NUM_MATRICES; ++i)
+	{
+		for (const argon::math::Matrix4 &m : {random.getAffineMatrix4(), getShearedMatrix4(random)})
+		{
+			const argon::math::Matrix4 inverse = m.getInvertedAffine();
+
+			EXPECT_TRUE(argon::test::isNear(m.getInverted(), inverse, 1e-4f))
+				<< argon::test::getPathLabel() << ", matrix " << i;
+			EXPECT_TRUE(argon::test::isNear(argon::math::Matrix4::c_identity, m * inverse, 1e-4f))
+				<< argon::test::getPathLabel() << ", matrix " << i;
+			EXPECT_TRUE(inverse[3] == argon::math::Vector4::c_wAxis) << "The inverse is not affine";
+
+			argon::math::Matrix4 inverted = m;
+			EXPECT_TRUE(inverted.invertAffine() == inverse);
+		}
+	}
+}
+
+TEST(Matrix4, InvertedOrthonormal)
+{
+	argon::test::Random random;
+
+	for (argon::int32 i = 0; i < NUM_MATRICES; ++i)
+	{
+		const argon::math::Matrix4 m = random.getRigidMatrix4();
+		const argon::math::Matrix4 inverse = m.getInvertedOrthonormal();
+
+		EXPECT_TRUE(argon::test::isNear(m.getInverted(), inverse, 1e-4f))
+			<< argon::test::getPathLabel() << ", matrix " << i;
+		EXPECT_TRUE(argon::test::isNear(m.getInvertedAffine(), inverse, 1e-4f))
+			<< argon::test::getPathLabel() << ", matrix " << i;
+		EXPECT_TRUE(argon::test::isNear(argon::math::Matrix4::c_identity, m * inverse, 1e-4f))
+			<< argon::test::getPathLabel() << ", matrix " << i;
+
+		argon::math::Matrix4 inverted = m;
+		EXPECT_TRUE(inverted.invertOrthonormal() == inverse);
+	}
+}
+
+TEST(Matrix4, MultiplyAffine)
+{
+	argon::test::Random random;
+
+	for (argon::int32 i = 0; i < NUM_MATRICES; ++i)
+	{
+		const argon::math::Matrix4 lhs = getShearedMatrix4(random);
+		const argon::math::Matrix4 rhs = random.getAffineMatrix4();
+		const argon::math::Matrix4 product = lhs.multiplyAffine(rhs);
+
+		EXPECT_TRUE(argon::test::isNear(multiply(lhs, rhs), product, 1e-5f))
+			<< argon::test::getPathLabel() << ", matrix " << i;
+		EXPECT_TRUE(argon::test::isNear(lhs * rhs, product, 1e-5f))
+			<< argon::test::getPathLabel() << ", matrix " << i;
+		EXPECT_TRUE(product[3] == argon::math::Vector4::c_wAxis) << "The product is not affine";
+	}
+}
+
+TEST(AffineTransform, Kind)
+{
+	using Kind = argon::math::AffineTransform::Kind;
+
+	argon::test::Random random;
+	const argon::math::Quaternion rotation = random.getQuaternion();
+	const argon::math::Vector3 translation = random.getVector3();
+
+	EXPECT_EQ(Kind::Rigid, argon::math::AffineTransform().getKind());
+	EXPECT_EQ(Kind::Rigid, argon::math::AffineTransform(rotation, translation).getKind());
+	EXPECT_EQ(Kind::Rigid, argon::math::AffineTransform(rotation,
+		argon::math::Vector3(1.f, 1.f, 1.f), translation).getKind()) << "Unit scaling is rigid";
+	EXPECT_EQ(Kind::General, argon::math::AffineTransform(rotation,
+		argon::math::Vector3(1.f, 2.f, 1.f), translation).getKind());
+	EXPECT_EQ(Kind::General, argon::math::AffineTransform(random.getRigidMatrix4()).getKind())
+		<< "Matrices are general unless told otherwise";
+
+	const argon::math::AffineTransform rigid(random.getRigidMatrix4(), Kind::Rigid);
+	const argon::math::AffineTransform general(getShearedMatrix4(random));
+
+	EXPECT_EQ(Kind::Rigid, (rigid * rigid).getKind());
+	EXPECT_EQ(Kind::General, (rigid * general).getKind());
+	EXPECT_EQ(Kind::General, (general * rigid).getKind());
+	EXPECT_EQ(Kind::Rigid, rigid.getInverted().getKind());
+	EXPECT_EQ(Kind::General, general.getInverted().getKind());
+
+	argon::math::AffineTransform accumulated;
+	accumulated *= rigid;
+	EXPECT_TRUE(accumulated.isRigid());
+	accumulated *= general;
+	EXPECT_FALSE(accumulated.isRigid()) << "The kind is not kept by operator*=";
+}
+
+TEST(AffineTransform, Operations)
+{
+	argon::test::Random random;
+
+	for (argon::int32 i = 0; i < NUM_MATRICES; ++i)
+	{
+		const argon::math::Matrix4 rigidMatrix = random.getRigidMatrix4();
+		const argon::math::Matrix4 generalMatrix = getShearedMatrix4(random);
+		const argon::math::AffineTransform rigid(rigidMatrix, argon::math::AffineTransform::Kind::Rigid);
+		const argon::math::AffineTransform general(generalMatrix);
+
+		EXPECT_TRUE(argon::test::isNear(rigidMatrix.getInverted(), rigid.getInverted().getMatrix4(), 1e-4f))
+			<< argon::test::getPathLabel() << ", transform " << i;
+		EXPECT_TRUE(argon::test::isNear(generalMatrix.getInverted(), general.getInverted().getMatrix4(), 1e-4f))
+			<< argon::test::getPathLabel() << ", transform " << i;
+		EXPECT_TRUE(argon::test::isNear(multiply(generalMatrix, rigidMatrix),
+			(general * rigid).getMatrix4(), 1e-5f)) << argon::test::getPathLabel() << ", transform " << i;
+
+		const argon::math::Vector3 point = random.getVector3();
+		EXPECT_TRUE(argon::test::isNear(generalMatrix * point, general * point, 1e-5f))
+			<< argon::test::getPathLabel() << ", transform " << i;
+	}
+}
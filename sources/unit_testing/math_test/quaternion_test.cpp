@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include <math/quaternion.hpp>
+#include <math/vector3.hpp>
+
+#include "math_test_utils.hpp"
+
+TEST(Quaternion, SlerpFollowsTheArc)
+{
+	const argon::math::Vector3 axis(0.f, 1.f, 0.f);
+	const argon::float32 angle = 1.5f;
+	const argon::math::Quaternion from(1.f, 0.f, 0.f, 0.f);
+	const argon::math::Quaternion to(axis, angle);
+
+	// The interpolated rotation turns by the same fraction of the angle,
+	// the half angle used to be taken as cos instead of acos of the dot product
+	for (const argon::float32 t : {0.f, 0.25f, 0.5f, 0.9f, 1.f})
+	{
+		EXPECT_TRUE(argon::test::isNear(argon::math::Quaternion(axis, angle * t), from.slerp(to, t), 1e-5f))
+			<< argon::test::getPathLabel() << ", t " << t;
+	}
+}
+
+TEST(Quaternion, SlerpSpecialCases)
+{
+	const argon::math::Quaternion identity(1.f, 0.f, 0.f, 0.f);
+
+	EXPECT_TRUE(argon::test::isNear(identity, identity.slerp(identity, 0.5f), 0.f))
+		<< "Equal quaternions";
+	EXPECT_TRUE(argon::test::isNear(identity,
+		identity.slerp(argon::math::Quaternion(-1.f, 0.f, 0.f, 0.f), 0.5f), 0.f))
+		<< "Opposite quaternions are the same rotation, the first one is kept";
+
+	const argon::math::Quaternion close(0.99999988f, 0.0004f, 0.f, 0.f);
+	EXPECT_TRUE(argon::test::isNear(argon::math::Quaternion(0.99999994f, 0.0002f, 0.f, 0.f),
+		identity.slerp(close, 0.3f), 1e-6f)) << "Nearly equal quaternions are averaged";
+}
@@ -0,0 +1,140 @@
+#include <cstring>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <memory/containers.hpp>
+#include <memory/linear_arena.hpp>
+
+namespace
+{
+bool isAligned(const void *p, argon::sizet alignment)
+{
+	return reinterpret_cast<argon::uintptr>(p) % alignment == 0;
+}
+} // namespace
+
+TEST(LinearArena, Alignment)
+{
+	argon::memory::LinearArena arena(1024);
+
+	for (argon::sizet alignment = 1; alignment <= 256; alignment <<= 1)
+	{
+		// Odd sizes leave the current pointer unaligned for the next allocation
+		for (argon::sizet size : {1u, 3u, 17u, 100u})
+		{
+			EXPECT_TRUE(isAligned(arena.allocate(size, alignment), alignment))
+				<< "Size " << size << ", alignment " << alignment;
+		}
+	}
+
+	EXPECT_TRUE(isAligned(arena.allocate(1), alignof(std::max_align_t)))
+		<< "Default alignment should fit any scalar type";
+	EXPECT_TRUE(isAligned(arena.allocate(4000, 512), 512))
+		<< "Allocation larger than a chunk should be aligned too";
+}
+
+TEST(LinearArena, Growth)
+{
+	constexpr argon::sizet CHUNK_SIZE = 1024;
+	constexpr argon::sizet NUM_ALLOCATIONS = 100;
+	constexpr argon::sizet SIZE = 96;
+
+	argon::memory::LinearArena arena(CHUNK_SIZE);
+	EXPECT_EQ(arena.getCapacity(), 0u)
+		<< "Chunks should be allocated on first use";
+
+	argon::vector<argon::uint8*> allocations;
+	for (argon::sizet i = 0; i < NUM_ALLOCATIONS; ++i)
+	{
+		allocations.push_back(static_cast<argon::uint8*>(arena.allocate(SIZE, 16)));
+		std::memset(allocations.back(), static_cast<int>(i), SIZE);
+	}
+
+	EXPECT_GT(arena.getCapacity(), CHUNK_SIZE);
+	EXPECT_GE(arena.getUsed(), NUM_ALLOCATIONS * SIZE);
+
+	// Earlier chunks are kept, nothing is moved or overwritten by the growth
+	for (argon::sizet i = 0; i < NUM_ALLOCATIONS; ++i)
+	{
+		for (argon::sizet j = 0; j < SIZE; ++j)
+		{
+			ASSERT_EQ(allocations[i][j], static_cast<argon::uint8>(i))
+				<< "Allocation " << i << " was overwritten";
+		}
+	}
+
+	const argon::sizet capacity = arena.getCapacity();
+	EXPECT_NE(arena.allocate(CHUNK_SIZE * 4), nullptr);
+	EXPECT_GE(arena.getCapacity(), capacity + CHUNK_SIZE * 4)
+		<< "Allocation larger than a chunk should get its own chunk";
+}
+
+TEST(LinearArena, ResetReuse)
+{
+	argon::memory::LinearArena arena(1024);
+
+	auto fill = [&arena]()
+	{
+		void *first = arena.allocate(64);
+		for (argon::sizet i = 0; i < 50; ++i)
+		{
+			arena.allocate(100);
+		}
+
+		return first;
+	};
+
+	fill();
+	const argon::sizet used = arena.getUsed();
+	arena.reset();
+
+	EXPECT_EQ(arena.getUsed(), 0u);
+	EXPECT_EQ(arena.getPeak(), used);
+
+	// The chunks are merged by the first reset, the same usage fits into the merged chunk
+	const argon::sizet capacity = arena.getCapacity();
+	void *first = fill();
+	EXPECT_EQ(arena.getCapacity(), capacity)
+		<< "Steady usage should not allocate after a reset";
+	arena.reset();
+
+	EXPECT_EQ(fill(), first)
+		<< "Memory should be reused after a reset";
+	EXPECT_EQ(arena.getCapacity(), capacity);
+}
+
+TEST(LinearArena, FrameArenas)
+{
+	argon::memory::LinearArena &arena = argon::memory::getFrameArena();
+	argon::memory::LinearArena *otherArena = nullptr;
+
+	{
+		argon::frame_vector<argon::uint32> values;
+		for (argon::uint32 i = 0; i < 10000; ++i)
+		{
+			values.push_back(i);
+		}
+
+		for (argon::uint32 i = 0; i < 10000; ++i)
+		{
+			ASSERT_EQ(values[i], i);
+		}
+
+		std::thread thread([&otherArena]()
+		{
+			otherArena = &argon::memory::getFrameArena();
+			otherArena->allocate(100);
+		});
+		thread.join();
+	}
+
+	EXPECT_NE(&arena, otherArena)
+		<< "Every thread should have its own arena";
+	EXPECT_GE(arena.getUsed(), 10000 * sizeof(argon::uint32));
+
+	argon::memory::resetFrameArenas();
+	EXPECT_EQ(arena.getUsed(), 0u);
+}
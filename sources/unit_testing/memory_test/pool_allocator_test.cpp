@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <memory/containers.hpp>
+#include <memory/pool_allocator.hpp>
+
+TEST(FixedPool, BlockSize)
+{
+	EXPECT_EQ(argon::memory::FixedPool(1).getBlockSize(), sizeof(void*))
+		<< "Free blocks should fit the link to the next one";
+	EXPECT_EQ(argon::memory::FixedPool(24).getBlockSize(), 32u)
+		<< "Blocks should be rounded up to the alignment";
+	EXPECT_EQ(argon::memory::FixedPool(100).getBlockSize(), 112u);
+
+	for (argon::sizet size : {8u, 24u, 100u, 512u})
+	{
+		argon::memory::FixedPool pool(size);
+		const argon::sizet alignment = std::min(pool.getBlockSize(), argon::memory::FixedPool::ALIGNMENT);
+
+		for (argon::uint32 i = 0; i < 100; ++i)
+		{
+			EXPECT_EQ(reinterpret_cast<argon::uintptr>(pool.allocate()) % alignment, 0u)
+				<< "Block size " << pool.getBlockSize();
+		}
+	}
+}
+
+TEST(FixedPool, Reuse)
+{
+	argon::memory::FixedPool pool(64);
+
+	void *first = pool.allocate();
+	void *second = pool.allocate();
+	EXPECT_NE(first, second);
+
+	pool.deallocate(first);
+	EXPECT_EQ(pool.allocate(), first)
+		<< "Freed blocks should be reused first";
+
+	// Past the first chunk, every block is distinct
+	const argon::sizet numBlocks = argon::memory::FixedPool::CHUNK_SIZE / pool.getBlockSize() * 2 + 1;
+	argon::vector<void*> blocks = {first, second};
+	for (argon::sizet i = 2; i < numBlocks; ++i)
+	{
+		blocks.push_back(pool.allocate());
+	}
+
+	std::sort(blocks.begin(), blocks.end());
+	EXPECT_TRUE(std::adjacent_find(blocks.begin(), blocks.end()) == blocks.end())
+		<< "A block was handed out twice";
+
+	for (void *block : blocks)
+	{
+		pool.deallocate(block);
+	}
+
+	EXPECT_TRUE(std::binary_search(blocks.begin(), blocks.end(), pool.allocate()))
+		<< "Blocks of all the chunks should be reused";
+}
+
+TEST(ThreadPool, SizeClasses)
+{
+	EXPECT_EQ(&argon::memory::getThreadPool(1), &argon::memory::getThreadPool(argon::memory::MIN_POOL_BLOCK_SIZE));
+	EXPECT_EQ(&argon::memory::getThreadPool(17), &argon::memory::getThreadPool(32));
+	EXPECT_NE(&argon::memory::getThreadPool(32), &argon::memory::getThreadPool(33));
+	EXPECT_GE(argon::memory::getThreadPool(argon::memory::MAX_POOL_BLOCK_SIZE).getBlockSize(),
+		argon::memory::MAX_POOL_BLOCK_SIZE);
+}
+
+TEST(ThreadPool, ReuseAcrossThreads)
+{
+	constexpr argon::sizet SIZE = 48;
+
+	argon::memory::FixedPool *otherPool = nullptr;
+	void *block = argon::memory::getThreadPool(SIZE).allocate();
+	void *reused = nullptr;
+
+	// The block freed on the other thread joins the pool of that thread
+	std::thread([&]()
+	{
+		otherPool = &argon::memory::getThreadPool(SIZE);
+		otherPool->deallocate(block);
+		reused = otherPool->allocate();
+		otherPool->deallocate(reused);
+	}).join();
+
+	EXPECT_NE(otherPool, &argon::memory::getThreadPool(SIZE))
+		<< "Every thread should have its own pools";
+	EXPECT_EQ(reused, block);
+
+	// The pools of the exited thread are taken over by the next one, with the freed block
+	argon::memory::FixedPool *nextPool = nullptr;
+	std::thread([&]()
+	{
+		nextPool = &argon::memory::getThreadPool(SIZE);
+		reused = nextPool->allocate();
+		nextPool->deallocate(reused);
+	}).join();
+
+	EXPECT_EQ(nextPool, otherPool);
+	EXPECT_EQ(reused, block);
+}
+
+TEST(PoolAllocator, Containers)
+{
+	argon::pool_map<argon::uint32, argon::uint32> values;
+	argon::pool_list<argon::vector<argon::uint32>> lists;
+	for (argon::uint32 i = 0; i < 10000; ++i)
+	{
+		values[i] = i;
+		lists.push_back(argon::vector<argon::uint32>(i % 8, i));
+	}
+
+	// The nodes are freed on the other thread and the pools are used there
+	std::thread([&values]()
+	{
+		values.clear();
+
+		argon::pool_unordered_set<argon::uint32> set;
+		for (argon::uint32 i = 0; i < 1000; ++i)
+		{
+			set.insert(i);
+		}
+
+		EXPECT_EQ(set.size(), 1000u);
+	}).join();
+
+	for (argon::uint32 i = 0; i < 10000; ++i)
+	{
+		values[i] = i * 2;
+	}
+
+	argon::uint32 i = 0;
+	for (const auto &[key, value] : values)
+	{
+		ASSERT_EQ(key, i);
+		ASSERT_EQ(value, i * 2);
+		++i;
+	}
+
+	i = 0;
+	for (const auto &list : lists)
+	{
+		ASSERT_EQ(list.size(), i % 8);
+		++i;
+	}
+
+	argon::pmr::unordered_map<argon::uint32, argon::uint32> map(argon::memory::getPoolResource());
+	for (argon::uint32 j = 0; j < 1000; ++j)
+	{
+		map[j] = j;
+	}
+
+	EXPECT_EQ(map.size(), 1000u);
+	EXPECT_EQ(map[999], 999u);
+}
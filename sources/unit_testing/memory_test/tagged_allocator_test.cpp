@@ -0,0 +1,111 @@
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <data_structures/standard_containers.hpp>
+
+#include <memory/containers.hpp>
+#include <memory/tagged_allocator.hpp>
+
+TEST(TaggedAllocator, Stats)
+{
+	constexpr argon::memory::MemoryTag TAG = argon::memory::MemoryTag::Debug;
+	const argon::memory::MemoryStats before = argon::memory::getMemoryStats(TAG);
+
+	{
+		argon::tagged_vector<argon::float64, TAG> values(1000);
+		const argon::memory::MemoryStats stats = argon::memory::getMemoryStats(TAG);
+
+		EXPECT_EQ(stats.m_currentBytes, before.m_currentBytes + 1000 * sizeof(argon::float64));
+		EXPECT_GE(stats.m_peakBytes, stats.m_currentBytes);
+		EXPECT_EQ(stats.m_numAllocations, before.m_numAllocations + 1);
+		EXPECT_EQ(stats.m_numDeallocations, before.m_numDeallocations);
+	}
+
+	const argon::memory::MemoryStats after = argon::memory::getMemoryStats(TAG);
+	EXPECT_EQ(after.m_currentBytes, before.m_currentBytes);
+	EXPECT_GE(after.m_peakBytes, before.m_currentBytes + 1000 * sizeof(argon::float64))
+		<< "Peak should be kept after the memory is freed";
+	EXPECT_EQ(after.m_numDeallocations, before.m_numDeallocations + 1);
+
+	EXPECT_STREQ(argon::memory::getMemoryTagName(TAG), "Debug");
+	EXPECT_STREQ(argon::memory::getMemoryTagName(argon::memory::MemoryTag::Render), "Render");
+}
+
+TEST(TaggedAllocator, Alignment)
+{
+	constexpr argon::memory::MemoryTag TAG = argon::memory::MemoryTag::Debug;
+
+	for (argon::sizet alignment = 1; alignment <= 256; alignment <<= 1)
+	{
+		void *memory = argon::memory::allocateTagged(24, alignment, TAG);
+		EXPECT_EQ(reinterpret_cast<argon::uintptr>(memory) % alignment, 0u)
+			<< "Alignment " << alignment;
+		argon::memory::deallocateTagged(memory, 24, alignment, TAG);
+	}
+}
+
+TEST(TaggedAllocator, BalanceAcrossThreads)
+{
+	constexpr argon::memory::MemoryTag TAG = argon::memory::MemoryTag::Debug;
+	constexpr argon::uint32 NUM_THREADS = 4;
+	constexpr argon::uint32 NUM_ALLOCATIONS = 10000;
+
+	const argon::memory::MemoryStats before = argon::memory::getMemoryStats(TAG);
+
+	argon::vector<std::thread> threads;
+	for (argon::uint32 i = 0; i < NUM_THREADS; ++i)
+	{
+		threads.emplace_back([i]()
+		{
+			argon::vector<void*> allocations;
+			for (argon::uint32 j = 0; j < NUM_ALLOCATIONS; ++j)
+			{
+				allocations.push_back(argon::memory::allocateTagged(i + 1, 8, TAG));
+
+				// Frees a part while allocating, the current bytes go up and down
+				if (j % 3 == 0)
+				{
+					argon::memory::deallocateTagged(allocations.back(), i + 1, 8, TAG);
+					allocations.pop_back();
+				}
+			}
+
+			for (void *memory : allocations)
+			{
+				argon::memory::deallocateTagged(memory, i + 1, 8, TAG);
+			}
+		});
+	}
+
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+
+	const argon::memory::MemoryStats after = argon::memory::getMemoryStats(TAG);
+	EXPECT_EQ(after.m_currentBytes, before.m_currentBytes)
+		<< "Every allocation was freed";
+	EXPECT_EQ(after.m_numAllocations - before.m_numAllocations, NUM_THREADS * NUM_ALLOCATIONS);
+	EXPECT_EQ(after.m_numDeallocations - before.m_numDeallocations, NUM_THREADS * NUM_ALLOCATIONS);
+	EXPECT_GE(after.m_peakBytes, before.m_currentBytes + NUM_ALLOCATIONS * 2 / 3);
+}
+
+TEST(TaggedAllocator, Resource)
+{
+	constexpr argon::memory::MemoryTag TAG = argon::memory::MemoryTag::Debug;
+	const argon::memory::MemoryStats before = argon::memory::getMemoryStats(TAG);
+
+	{
+		argon::pmr::vector<argon::uint32> values(argon::memory::getTaggedResource(TAG));
+		values.resize(10);
+
+		EXPECT_EQ(argon::memory::getMemoryStats(TAG).m_currentBytes,
+			before.m_currentBytes + 10 * sizeof(argon::uint32));
+	}
+
+	const argon::memory::MemoryStats after = argon::memory::getMemoryStats(TAG);
+	EXPECT_EQ(after.m_currentBytes, before.m_currentBytes);
+	EXPECT_EQ(after.m_numAllocations - before.m_numAllocations,
+		after.m_numDeallocations - before.m_numDeallocations);
+}